@@ -350,6 +350,7 @@ void ComplexGeoData::setElementMap(const std::vector<MappedElement>& map)
 {
     _elementMap = std::make_shared<Data::ElementMap>();  // Get rid of the old one, if any, but make
                                                          // sure the memory exists for the new data.
+    _elementMap->reserve(map.size());
     for (auto& element : map) {
         _elementMap->setElementName(element.index, element.name, Tag);
     }
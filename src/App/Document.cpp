@@ -757,6 +757,30 @@ int Document::getUndoMode() const
 }
 
 unsigned int Document::getUndoMemSize() const
+{
+    // data the saved properties share with the current ones takes no extra memory
+    std::set<const void*> counted;
+    for (auto obj : d->objectArray) {
+        std::vector<Property*> props;
+        obj->getPropertyList(props);
+        for (auto prop : props) {
+            if (auto data = prop->getSharedData()) {
+                counted.insert(data);
+            }
+        }
+    }
+
+    unsigned int size = 0;
+    for (auto transaction : mUndoTransactions) {
+        size += transaction->getMemSize(counted);
+    }
+    for (auto transaction : mRedoTransactions) {
+        size += transaction->getMemSize(counted);
+    }
+    return size;
+}
+
+unsigned int Document::getUndoLimit() const
 {
     return d->UndoMemSize;
 }
@@ -144,6 +144,8 @@ public:
     boost::signals2::signal<void(const App::DocumentObject&, const App::Property&)> signalChangedObject;
     /// signal on manually called DocumentObject::touch()
     boost::signals2::signal<void(const App::DocumentObject&)> signalTouchedObject;
+    /// signal on status changes of an Object without a property change, e.g. purgeTouched()
+    boost::signals2::signal<void(const App::DocumentObject&)> signalChangedObjectStatus;
     /// signal on relabeled Object
     boost::signals2::signal<void(const App::DocumentObject&)> signalRelabelObject;
     /// signal on activated Object
@@ -453,6 +455,8 @@ public:
     void setUndoLimit(unsigned int UndoMemSize = 0);
     /// Returns the actual memory consumption of the Undo redo stuff.
     unsigned int getUndoMemSize() const;
+    /// Returns the Undo limit in Byte
+    unsigned int getUndoLimit() const;
     /// Set the Undo limit as stack size
     void setMaxUndoStackSize(unsigned int UndoMaxStackSize = 20);  // NOLINT
     /// Set the Undo limit as stack size
@@ -228,6 +228,41 @@ void DocumentObject::touch(bool noRecompute)
     }
 }
 
+/**
+ * @brief Reset the touched state of this document object.
+ * Unlike touch() this is no modification of the document. The status change
+ * is announced with Document::signalChangedObjectStatus.
+ */
+void DocumentObject::purgeTouched()
+{
+    StatusBits.reset(ObjectStatus::Touch);
+    StatusBits.reset(ObjectStatus::Enforce);
+    setPropertyStatus(0, false);
+    if (_pDoc) {
+        _pDoc->signalChangedObjectStatus(*this);
+    }
+}
+
+void DocumentObject::setStatus(ObjectStatus pos, bool on)
+{
+    if (StatusBits.test(size_t(pos)) == on) {
+        return;
+    }
+    StatusBits.set(size_t(pos), on);
+    switch (pos) {
+        case ObjectStatus::Touch:
+        case ObjectStatus::Error:
+        case ObjectStatus::Enforce:
+        case ObjectStatus::Freeze:
+            if (_pDoc) {
+                _pDoc->signalChangedObjectStatus(*this);
+            }
+            break;
+        default:
+            break;
+    }
+}
+
 /**
  * @brief Set this document object freezed.
  * A freezed document object does not recompute ever.
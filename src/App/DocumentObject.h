@@ -179,12 +179,7 @@ public:
     /// Test if this document object must be recomputed
     bool mustRecompute() const;
     /// reset this document object touched
-    void purgeTouched()
-    {
-        StatusBits.reset(ObjectStatus::Touch);
-        StatusBits.reset(ObjectStatus::Enforce);
-        setPropertyStatus(0, false);
-    }
+    void purgeTouched();
     /// set this feature to error
     bool isError() const
     {
@@ -197,7 +192,7 @@ public:
     /// remove the error from the object
     void purgeError()
     {
-        StatusBits.reset(ObjectStatus::Error);
+        setStatus(ObjectStatus::Error, false);
     }
     /// returns true if this objects is currently recomputing
     bool isRecomputing() const
@@ -232,10 +227,7 @@ public:
     {
         return StatusBits.test(size_t(pos));
     }
-    void setStatus(ObjectStatus pos, bool on)
-    {
-        StatusBits.set(size_t(pos), on);
-    }
+    void setStatus(ObjectStatus pos, bool on);
     //@}
 
     int isExporting() const;
@@ -737,11 +729,11 @@ protected:
 
     void setError()
     {
-        StatusBits.set(ObjectStatus::Error);
+        setStatus(ObjectStatus::Error, true);
     }
     void resetError()
     {
-        StatusBits.reset(ObjectStatus::Error);
+        setStatus(ObjectStatus::Error, false);
     }
     void setDocument(App::Document* doc);
 
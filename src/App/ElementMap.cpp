@@ -1,5 +1,6 @@
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <algorithm>
 #include <unordered_map>
 #ifndef FC_DEBUG
 #include <random>
@@ -811,6 +812,26 @@ unsigned long ElementMap::size() const
     return mappedNames.size() + childElementSize;
 }
 
+void ElementMap::reserve(std::size_t count)
+{
+    mappedNames.reserve(mappedNames.size() + count);
+}
+
+std::size_t ElementMap::MappedNameHash::operator()(const MappedName& name) const
+{
+    // FNV-1a over data and postfix, so that names only differing in the split
+    // between data and postfix get the same hash
+    const std::size_t prime = sizeof(std::size_t) > 4 ? 1099511628211ULL : 16777619UL;
+    std::size_t hash = sizeof(std::size_t) > 4 ? 14695981039346656037ULL : 2166136261UL;
+    for (const QByteArray* bytes : {&name.dataBytes(), &name.postfixBytes()}) {
+        for (char c : *bytes) {
+            hash ^= static_cast<unsigned char>(c);
+            hash *= prime;
+        }
+    }
+    return hash;
+}
+
 bool ElementMap::empty() const
 {
     return mappedNames.empty() && childElementSize == 0;
@@ -1072,8 +1093,15 @@ void ElementMap::collectChildMaps(std::map<const ElementMap*, int>& childMapSet,
         }
     }
 
-    for (auto& mappedName : this->mappedNames) {
-        addPostfix(mappedName.first.constPostfix(), postfixMap, postfixes);
+    // walk the names by their indexed names to get a stable order of the postfixes
+    for (auto& indexedName : this->indexedNames) {
+        for (auto& ref : indexedName.second.names) {
+            for (auto* nameRef = &ref; nameRef; nameRef = nameRef->next.get()) {
+                if (nameRef->name) {
+                    addPostfix(nameRef->name.constPostfix(), postfixMap, postfixes);
+                }
+            }
+        }
     }
 
     childMaps.push_back(this);
@@ -1302,6 +1330,10 @@ std::vector<MappedElement> ElementMap::getAll() const
     for (auto& mappedName : this->mappedNames) {
         ret.emplace_back(mappedName.first, mappedName.second);
     }
+    // the names are stored unordered, return them sorted as before
+    std::sort(ret.begin(), ret.end(), [](const MappedElement& a, const MappedElement& b) {
+        return a.name < b.name;
+    });
     for (auto& childElement : this->childElements) {
         auto& child = *childElement.childMap;
         IndexedName idx(child.indexedName);
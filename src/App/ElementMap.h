@@ -37,6 +37,7 @@
 #include <functional>
 #include <map>
 #include <memory>
+#include <unordered_map>
 
 
 namespace Data
@@ -152,6 +153,11 @@ public:
 
     bool empty() const;
 
+    /** Prepares the map for \c count more names, e.g. before mapping all the
+     * sub-elements of a new shape, to avoid rehashing while adding them.
+     */
+    void reserve(std::size_t count);
+
     IndexedName find(const MappedName& name, ElementIDRefs* sids = nullptr) const;
 
     MappedName find(const IndexedName& idx, ElementIDRefs* sids = nullptr) const;
@@ -303,7 +309,13 @@ private:
 
     std::map<const char*, IndexedElements, CStringComp> indexedNames;
 
-    std::map<MappedName, IndexedName, std::less<>> mappedNames;
+    /// Hashes the concatenation of data and postfix, consistent with MappedName::operator==()
+    struct MappedNameHash
+    {
+        std::size_t operator()(const MappedName& name) const;
+    };
+
+    std::unordered_map<MappedName, IndexedName, MappedNameHash> mappedNames;
 
     struct ChildMapInfo
     {
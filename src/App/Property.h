@@ -262,6 +262,24 @@ public:
     virtual Property* Copy() const = 0;
     /// Paste the value from the property (mainly for Undo/Redo and transactions)
     virtual void Paste(const Property& from) = 0;
+    /** Returns the data shared between this property and its copies, or nullptr
+     * Properties with heavy data may let Copy() and Paste() share it, and only make a
+     * private copy when it is about to be modified. The returned pointer identifies the
+     * shared data, so that its memory is only counted once, e.g. in the undo stack.
+     */
+    virtual const void* getSharedData() const
+    {
+        return nullptr;
+    }
+    /** Returns a copy whose data file can be written by another thread, or nullptr
+     * The copy must not share anything that the property may change in the meantime, and
+     * its SaveDocFile() must not access the document. Used for background saving, e.g.
+     * by the auto recovery.
+     */
+    virtual Property* copyForBackgroundSave() const
+    {
+        return nullptr;
+    }
 
     /// Called when a child property has changed value
     virtual void hasSetChildValue(Property&)
@@ -523,6 +541,12 @@ public:
     {
         return this->testStatus(Status::Ordered);
     }
+
+    /// Lists hold plain values, so their copies can be saved by another thread
+    Property* copyForBackgroundSave() const override
+    {
+        return Copy();
+    }
 };
 
 /** Helper class to implement PropertyLists */
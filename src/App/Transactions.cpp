@@ -116,7 +116,17 @@ int Transaction::getLastID()
 
 unsigned int Transaction::getMemSize() const
 {
-    return 0;
+    std::set<const void*> counted;
+    return getMemSize(counted);
+}
+
+unsigned int Transaction::getMemSize(std::set<const void*>& counted) const
+{
+    unsigned int size = 0;
+    for (const auto& info : _Objects) {
+        size += info.second->getMemSize(counted);
+    }
+    return size;
 }
 
 void Transaction::Save(Base::Writer& /*writer*/) const
@@ -424,7 +434,26 @@ void TransactionObject::addOrRemoveProperty(const Property* pcProp, bool add)
 
 unsigned int TransactionObject::getMemSize() const
 {
-    return 0;
+    std::set<const void*> counted;
+    return getMemSize(counted);
+}
+
+unsigned int TransactionObject::getMemSize(std::set<const void*>& counted) const
+{
+    unsigned int size = 0;
+    for (const auto& v : _PropChangeMap) {
+        const Property* prop = v.second.property;
+        if (!prop) {
+            continue;
+        }
+        // data shared with other copies of the property is only counted once
+        const void* data = prop->getSharedData();
+        if (data && !counted.insert(data).second) {
+            continue;
+        }
+        size += prop->getMemSize();
+    }
+    return size;
 }
 
 void TransactionObject::Save(Base::Writer& /*writer*/) const
@@ -25,6 +25,7 @@
 #ifndef APP_TRANSACTION_H
 #define APP_TRANSACTION_H
 
+#include <set>
 #include <unordered_map>
 #include <Base/Factory.h>
 #include <Base/Persistence.h>
@@ -66,6 +67,8 @@ public:
     std::string Name;
 
     unsigned int getMemSize() const override;
+    /// Returns the memory used by the transaction without the shared data already in \a counted
+    unsigned int getMemSize(std::set<const void*>& counted) const;
     void Save(Base::Writer& writer) const override;
     /// This method is used to restore properties from an XML document.
     void Restore(Base::XMLReader& reader) override;
@@ -118,6 +121,8 @@ public:
     void addOrRemoveProperty(const Property* pcProp, bool add);
 
     unsigned int getMemSize() const override;
+    /// Returns the memory used by the saved properties without the shared data already in \a counted
+    unsigned int getMemSize(std::set<const void*>& counted) const;
     void Save(Base::Writer& writer) const override;
     /// This method is used to restore properties from an XML document.
     void Restore(Base::XMLReader& reader) override;
@@ -36,6 +36,8 @@
 #include <xercesc/parsers/XercesDOMParser.hpp>
 #include <xercesc/sax/ErrorHandler.hpp>
 #include <xercesc/sax/SAXParseException.hpp>
+#include <mutex>
+#include <shared_mutex>
 #include <sstream>
 #include <string>
 #include <utility>
@@ -432,6 +434,13 @@ Base::Reference<ParameterGrp> ParameterGrp::_GetGroup(const char* Name)
         return rParamGrp;
     }
 
+    // fast path for an already created group that is still part of this one
+    auto it = _GroupMap.find(Name);
+    if (it != _GroupMap.end() && it->second.isValid() && it->second->_pGroupNode
+        && !it->second->_Detached) {
+        return it->second;
+    }
+
     DOMElement* pcTemp {};
 
     // search if Group node already there
@@ -676,6 +685,104 @@ ParameterGrp::GetAttributeMap(ParamType Type, const char* sFilter) const
     return res;
 }
 
+bool ParameterGrp::GetCachedValue(ParamType Type, const char* Name, std::string& Value) const
+{
+    auto index = static_cast<std::size_t>(Type) - static_cast<std::size_t>(ParamType::FCText);
+    if (index >= _Values.size() || !Name) {
+        return false;
+    }
+
+    auto lookup = [&]() {
+        const auto& values = _Values[index];
+        auto it = values.find(std::string_view(Name));
+        if (it == values.end()) {
+            return false;
+        }
+        Value = it->second;
+        return true;
+    };
+
+    {
+        std::shared_lock<std::shared_mutex> lock(_CacheMutex);
+        if (_CacheValid) {
+            return lookup();
+        }
+    }
+
+    std::unique_lock<std::shared_mutex> lock(_CacheMutex);
+    if (!_CacheValid) {
+        BuildCache();
+    }
+    return lookup();
+}
+
+void ParameterGrp::SetCachedValue(ParamType Type, const char* Name, const char* Value)
+{
+    auto index = static_cast<std::size_t>(Type) - static_cast<std::size_t>(ParamType::FCText);
+    if (index >= _Values.size()) {
+        return;
+    }
+
+    std::unique_lock<std::shared_mutex> lock(_CacheMutex);
+    if (_CacheValid) {
+        _Values[index].insert_or_assign(Name, Value);
+    }
+}
+
+void ParameterGrp::InvalidateCache()
+{
+    std::unique_lock<std::shared_mutex> lock(_CacheMutex);
+    _CacheValid = false;
+    for (auto& values : _Values) {
+        values.clear();
+    }
+}
+
+void ParameterGrp::BuildCache() const
+{
+    for (auto& values : _Values) {
+        values.clear();
+    }
+
+    if (_pGroupNode) {
+        for (DOMNode* clChild = _pGroupNode->getFirstChild(); clChild != nullptr;
+             clChild = clChild->getNextSibling()) {
+            if (clChild->getNodeType() != DOMNode::ELEMENT_NODE) {
+                continue;
+            }
+            ParamType Type = TypeValue(StrX(clChild->getNodeName()).c_str());
+            auto index =
+                static_cast<std::size_t>(Type) - static_cast<std::size_t>(ParamType::FCText);
+            if (index >= _Values.size()) {
+                continue;
+            }
+            DOMNode* attr =
+                clChild->getAttributes()->getNamedItem(XStrLiteral("Name").unicodeForm());
+            if (!attr) {
+                continue;
+            }
+
+            std::string Value;
+            if (Type == ParamType::FCText) {
+                DOMNode* pcText = clChild->getFirstChild();
+                if (pcText) {
+                    Value = StrXUTF8(pcText->getNodeValue()).c_str();
+                }
+            }
+            else {
+                Value = StrX(static_cast<DOMElement*>(clChild)->getAttribute(
+                                 XStrLiteral("Value").unicodeForm()))
+                            .c_str();
+            }
+
+            // like FindElement() the first element of a name wins
+            _Values[index].emplace(StrX(attr->getNodeValue()).c_str(), std::move(Value));
+        }
+    }
+
+    _CacheValid = true;
+}
+
 void ParameterGrp::_Notify(ParamType Type, const char* Name, const char* Value)
 {
     if (_Manager) {
@@ -710,6 +817,7 @@ void ParameterGrp::_SetAttribute(ParamType T, const char* Name, const char* Valu
         // set the value only if different
         if (strcmp(StrX(pcElem->getAttribute(attr.unicodeForm())).c_str(), Value) != 0) {
             pcElem->setAttribute(attr.unicodeForm(), XStr(Value).unicodeForm());
+            SetCachedValue(T, Name, Value);
             // trigger observer
             _Notify(T, Name, Value);
         }
@@ -726,15 +834,14 @@ bool ParameterGrp::GetBool(const char* Name, bool bPreset) const
     }
 
     // check if Element in group
-    DOMElement* pcElem = FindElement(_pGroupNode, "FCBool", Name);
+    std::string Value;
     // if not return preset
-    if (!pcElem) {
+    if (!GetCachedValue(ParamType::FCBool, Name, Value)) {
         return bPreset;
     }
 
     // if yes check the value and return
-    return (strcmp(StrX(pcElem->getAttribute(XStrLiteral("Value").unicodeForm())).c_str(), "1")
-            == 0);
+    return Value == "1";
 }
 
 void ParameterGrp::SetBool(const char* Name, bool bValue)
@@ -805,13 +912,13 @@ long ParameterGrp::GetInt(const char* Name, long lPreset) const
     }
 
     // check if Element in group
-    DOMElement* pcElem = FindElement(_pGroupNode, "FCInt", Name);
+    std::string Value;
     // if not return preset
-    if (!pcElem) {
+    if (!GetCachedValue(ParamType::FCInt, Name, Value)) {
         return lPreset;
     }
     // if yes check the value and return
-    return atol(StrX(pcElem->getAttribute(XStrLiteral("Value").unicodeForm())).c_str());
+    return atol(Value.c_str());
 }
 
 void ParameterGrp::SetInt(const char* Name, long lValue)
@@ -874,17 +981,15 @@ unsigned long ParameterGrp::GetUnsigned(const char* Name, unsigned long lPreset)
     }
 
     // check if Element in group
-    DOMElement* pcElem = FindElement(_pGroupNode, "FCUInt", Name);
+    std::string Value;
     // if not return preset
-    if (!pcElem) {
+    if (!GetCachedValue(ParamType::FCUInt, Name, Value)) {
         return lPreset;
     }
 
     // if yes check the value and return
     const int base = 10;
-    return strtoul(StrX(pcElem->getAttribute(XStrLiteral("Value").unicodeForm())).c_str(),
-                   nullptr,
-                   base);
+    return strtoul(Value.c_str(), nullptr, base);
 }
 
 void ParameterGrp::SetUnsigned(const char* Name, unsigned long lValue)
@@ -954,13 +1059,13 @@ double ParameterGrp::GetFloat(const char* Name, double dPreset) const
     }
 
     // check if Element in group
-    DOMElement* pcElem = FindElement(_pGroupNode, "FCFloat", Name);
+    std::string Value;
     // if not return preset
-    if (!pcElem) {
+    if (!GetCachedValue(ParamType::FCFloat, Name, Value)) {
         return dPreset;
     }
     // if yes check the value and return
-    return atof(StrX(pcElem->getAttribute(XStrLiteral("Value").unicodeForm())).c_str());
+    return atof(Value.c_str());
 }
 
 void ParameterGrp::SetFloat(const char* Name, double dValue)
@@ -1046,12 +1151,14 @@ void ParameterGrp::SetASCII(const char* Name, const char* sValue)
             XERCES_CPP_NAMESPACE_QUALIFIER DOMDocument* pDocument = _pGroupNode->getOwnerDocument();
             DOMText* pText = pDocument->createTextNode(XUTF8Str(sValue).unicodeForm());
             pcElem->appendChild(pText);
+            SetCachedValue(ParamType::FCText, Name, sValue);
             if (isNew || sValue[0] != 0) {
                 _Notify(ParamType::FCText, Name, sValue);
             }
         }
         else if (strcmp(StrXUTF8(pcElem2->getNodeValue()).c_str(), sValue) != 0) {
             pcElem2->setNodeValue(XUTF8Str(sValue).unicodeForm());
+            SetCachedValue(ParamType::FCText, Name, sValue);
             _Notify(ParamType::FCText, Name, sValue);
         }
         // trigger observer
@@ -1066,20 +1173,16 @@ std::string ParameterGrp::GetASCII(const char* Name, const char* pPreset) const
     }
 
     // check if Element in group
-    DOMElement* pcElem = FindElement(_pGroupNode, "FCText", Name);
+    std::string Value;
     // if not return preset
-    if (!pcElem) {
+    if (!GetCachedValue(ParamType::FCText, Name, Value)) {
         if (!pPreset) {
             return {};
         }
         return {pPreset};
     }
-    // if yes check the value and return
-    DOMNode* pcElem2 = pcElem->getFirstChild();
-    if (pcElem2) {
-        return {StrXUTF8(pcElem2->getNodeValue()).c_str()};
-    }
-    return {};
+    // if yes return the value
+    return Value;
 }
 
 std::vector<std::string> ParameterGrp::GetASCIIs(const char* sFilter) const
@@ -1161,6 +1264,7 @@ void ParameterGrp::RemoveASCII(const char* Name)
 
     DOMNode* node = _pGroupNode->removeChild(pcElem);
     node->release();
+    InvalidateCache();
 
     // trigger observer
     _Notify(ParamType::FCText, Name, nullptr);
@@ -1182,6 +1286,7 @@ void ParameterGrp::RemoveBool(const char* Name)
 
     DOMNode* node = _pGroupNode->removeChild(pcElem);
     node->release();
+    InvalidateCache();
 
     // trigger observer
     _Notify(ParamType::FCBool, Name, nullptr);
@@ -1204,6 +1309,7 @@ void ParameterGrp::RemoveFloat(const char* Name)
 
     DOMNode* node = _pGroupNode->removeChild(pcElem);
     node->release();
+    InvalidateCache();
 
     // trigger observer
     _Notify(ParamType::FCFloat, Name, nullptr);
@@ -1225,6 +1331,7 @@ void ParameterGrp::RemoveInt(const char* Name)
 
     DOMNode* node = _pGroupNode->removeChild(pcElem);
     node->release();
+    InvalidateCache();
 
     // trigger observer
     _Notify(ParamType::FCInt, Name, nullptr);
@@ -1246,6 +1353,7 @@ void ParameterGrp::RemoveUnsigned(const char* Name)
 
     DOMNode* node = _pGroupNode->removeChild(pcElem);
     node->release();
+    InvalidateCache();
 
     // trigger observer
     _Notify(ParamType::FCUInt, Name, nullptr);
@@ -1363,6 +1471,7 @@ void ParameterGrp::Clear(bool notify)
         DOMNode* node = _pGroupNode->removeChild(child);
         node->release();
     }
+    InvalidateCache();
 
     for (auto& v : params) {
         _Notify(v.first, v.second.c_str(), nullptr);
@@ -1541,6 +1650,7 @@ void ParameterGrp::NotifyAll()
 void ParameterGrp::_Reset()
 {
     _pGroupNode = nullptr;
+    InvalidateCache();
     for (auto& v : _GroupMap) {
         v.second->_Reset();
     }
@@ -1870,6 +1980,7 @@ int ParameterManager::LoadDocument(const XERCES_CPP_NAMESPACE_QUALIFIER InputSou
     }
 
     _pGroupNode = FindElement(rootElem, "FCParamGroup", "Root");
+    InvalidateCache();
 
     if (!_pGroupNode) {
         throw XMLBaseException("Malformed Parameter document: Root group not found");
@@ -1996,6 +2107,7 @@ void ParameterManager::CreateDocument()
     _pGroupNode = _pDocument->createElement(XStrLiteral("FCParamGroup").unicodeForm());
     _pGroupNode->setAttribute(XStrLiteral("Name").unicodeForm(), XStrLiteral("Root").unicodeForm());
     rootElem->appendChild(_pGroupNode);
+    InvalidateCache();
 }
 
 void ParameterManager::CheckDocument() const
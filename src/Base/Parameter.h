@@ -45,7 +45,12 @@ using PyObject = struct _object;
 #undef isalnum
 #endif
 
+#include <array>
 #include <map>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 #include <boost/signals2.hpp>
 #include <xercesc/util/XercesDefs.hpp>
@@ -465,6 +470,21 @@ protected:
     XERCES_CPP_NAMESPACE_QUALIFIER DOMNode*
     FindAttribute(XERCES_CPP_NAMESPACE_QUALIFIER DOMNode* Node, const char* Name) const;
 
+    /** @name Value cache
+     *  The values of a group are read once from the DOM and afterwards looked up
+     *  in hash tables. The DOM is only used as persistence format. Reading from the
+     *  cache is safe from several threads, modifications are expected to happen in
+     *  one thread only.
+     */
+    //@{
+    /// Looks up the value of the parameter, returns false if it doesn't exist
+    bool GetCachedValue(ParamType Type, const char* Name, std::string& Value) const;
+    /// Updates the cached value after it has been set in the DOM
+    void SetCachedValue(ParamType Type, const char* Name, const char* Value);
+    /// Marks the cache as outdated, it will be rebuilt from the DOM on next access
+    void InvalidateCache();
+    //@}
+
     /// DOM Node of the Base node of this group
     XERCES_CPP_NAMESPACE_QUALIFIER DOMElement* _pGroupNode;
     /// the own name
@@ -480,6 +500,23 @@ protected:
      * This is used to prevent anynew value/sub-group to be added in observer
      */
     bool _Clearing = false;
+
+private:
+    void BuildCache() const;
+
+    struct StringHash
+    {
+        using is_transparent = void;
+        std::size_t operator()(std::string_view str) const
+        {
+            return std::hash<std::string_view> {}(str);
+        }
+    };
+    using ValueMap = std::unordered_map<std::string, std::string, StringHash, std::equal_to<>>;
+    /// cached values, one map for each of FCText, FCBool, FCInt, FCUInt and FCFloat
+    mutable std::array<ValueMap, 5> _Values;
+    mutable bool _CacheValid = false;
+    mutable std::shared_mutex _CacheMutex;
 };
 
 /** The parameter serializer class
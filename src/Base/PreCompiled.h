@@ -76,6 +76,7 @@
 #include <queue>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <bitset>
 #include <algorithm>
 
@@ -24,6 +24,7 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+# include <limits>
 # include <QApplication>
 # include <QFile>
 # include <QDir>
@@ -36,6 +37,7 @@
 #include <App/Document.h>
 #include <App/DocumentObject.h>
 #include <Base/Console.h>
+#include <Base/Exception.h>
 #include <Base/FileInfo.h>
 #include <Base/Stream.h>
 #include <Base/TimeInfo.h>
@@ -133,6 +135,89 @@ void AutoSaver::slotDeleteDocument(const App::Document& Doc)
     }
 }
 
+namespace Gui {
+
+class RecoveryArchiveRunnable : public QRunnable
+{
+public:
+    RecoveryArchiveRunnable(std::unique_ptr<RecoverySnapshotWriter> writer, const char* dir,
+                            const std::string& docName, const AutoSaveProperty& saver)
+        : writer(std::move(writer))
+        , writing(saver.writing)
+        , docName(docName)
+        , touched(saver.touched)
+    {
+        dirName = QString::fromUtf8(dir);
+        fileName = QStringLiteral("fc_recovery_file.fcstd");
+        tmpName = QStringLiteral("%1.tmp%2").arg(fileName).arg(rand());
+        *this->writing = true;
+    }
+    ~RecoveryArchiveRunnable() override
+    {
+        *writing = false;
+    }
+    void run() override
+    {
+        Base::TimeElapsed startTime;
+        if (!writeArchive()) {
+            // Keep the changes for the next attempt
+            QMetaObject::invokeMethod(AutoSaver::instance(), [name = docName, props = touched]() {
+                AutoSaver::instance()->touchDocument(name, props);
+            }, Qt::QueuedConnection);
+            return;
+        }
+        Base::Console().Log("Write AutoRecovery file in %fs\n",
+            Base::TimeElapsed::diffTimeF(startTime, Base::TimeElapsed()));
+
+        // Replace the old file only once the new one is complete, see RecoveryRunnable
+        QMetaObject::invokeMethod(AutoSaver::instance(), "renameFile",
+                Qt::QueuedConnection, Q_ARG(QString,dirName)
+                ,Q_ARG(QString,fileName),Q_ARG(QString,tmpName));
+    }
+
+private:
+    bool writeArchive()
+    {
+        QString path = QStringLiteral("%1/%2").arg(dirName, tmpName);
+        try {
+            Base::FileInfo tmp(path.toUtf8().constData());
+            Base::ofstream file(tmp, std::ios::out | std::ios::binary);
+            if (!file.is_open()) {
+                Base::Console().Error("Failed to open AutoRecovery file '%s'\n",
+                                      path.toUtf8().constData());
+                return false;
+            }
+            writer->writeArchive(file);
+            file.close();
+            if (file.fail()) {
+                Base::Console().Error("Failed to write AutoRecovery file '%s'\n",
+                                      path.toUtf8().constData());
+                return false;
+            }
+        }
+        catch (const Base::Exception& e) {
+            Base::Console().Error("Failed to write AutoRecovery file: %s\n", e.what());
+            return false;
+        }
+        catch (const std::exception& e) {
+            Base::Console().Error("Failed to write AutoRecovery file: %s\n", e.what());
+            return false;
+        }
+        return true;
+    }
+
+private:
+    std::unique_ptr<RecoverySnapshotWriter> writer;
+    std::shared_ptr<std::atomic<bool>> writing;
+    std::string docName;
+    std::set<std::string> touched;
+    QString dirName;
+    QString fileName;
+    QString tmpName;
+};
+
+}
+
 void AutoSaver::saveDocument(const std::string& name, AutoSaveProperty& saver)
 {
     Gui::WaitCursor wc;
@@ -169,7 +254,10 @@ void AutoSaver::saveDocument(const std::string& name, AutoSaveProperty& saver)
         bool save = hGrp->GetBool("SaveThumbnail",true);
         hGrp->SetBool("SaveThumbnail",false);
 
-        getMainWindow()->showMessage(tr("Please wait until the AutoRecovery file has been saved..."), 5000);
+        if (auto mainWindow = getMainWindow()) {
+            mainWindow->showMessage(
+                tr("Please wait until the AutoRecovery file has been saved..."), 5000);
+        }
         //qApp->processEvents();
 
         Base::TimeElapsed startTime;
@@ -195,27 +283,33 @@ void AutoSaver::saveDocument(const std::string& name, AutoSaveProperty& saver)
             }
             // only create the file if something has changed
             else if (!saver.touched.empty()) {
-                std::string fn = doc->TransientDir.getValue();
-                fn += "/fc_recovery_file.fcstd";
-                Base::FileInfo tmp(fn);
-                Base::ofstream file(tmp, std::ios::out | std::ios::binary);
-                if (file.is_open())
-                {
-                    Base::ZipWriter writer(file);
-                    if (hGrp->GetBool("SaveBinaryBrep", true))
-                        writer.setMode("BinaryBrep");
-
-                    writer.setComment("AutoRecovery file");
-                    writer.setLevel(1); // apparently the fastest compression
-                    writer.putNextEntry("Document.xml");
-
-                    doc->Save(writer);
-
-                    // Special handling for Gui document.
-                    doc->signalSaveDocument(writer);
-
-                    // write additional files
-                    writer.writeFiles();
+                // Take a snapshot of the document and let a worker thread do the
+                // serialization of the data files, the compression and the writing.
+                auto writer = std::make_unique<RecoverySnapshotWriter>();
+                bool binary = hGrp->GetBool("SaveBinaryBrep", true);
+                if (binary)
+                    writer->setMode("BinaryBrep");
+
+                writer->putNextEntry("Document.xml");
+
+                // The XML reads the live objects, so it is written to a buffer here
+                doc->Save(*writer);
+
+                // Special handling for Gui document.
+                doc->signalSaveDocument(*writer);
+
+                // take copies of the properties that write additional files
+                writer->writeFiles();
+
+                auto runnable = new RecoveryArchiveRunnable(std::move(writer),
+                        doc->TransientDir.getValue(), name, saver);
+                // ASCII BREP is not reentrant, see PropertyPartShape::SaveDocFile
+                if (binary) {
+                    QThreadPool::globalInstance()->start(runnable);
+                }
+                else {
+                    runnable->run();
+                    delete runnable;
                 }
             }
         }
@@ -225,11 +319,23 @@ void AutoSaver::saveDocument(const std::string& name, AutoSaveProperty& saver)
     }
 }
 
+void AutoSaver::touchDocument(const std::string& name, const std::set<std::string>& props)
+{
+    auto it = saverMap.find(name);
+    if (it != saverMap.end())
+        it->second->touched.insert(props.begin(), props.end());
+}
+
 void AutoSaver::timerEvent(QTimerEvent * event)
 {
     int id = event->timerId();
     for (auto & it : saverMap) {
         if (it.second->timerId == id) {
+            // the previous recovery file is still being written, try again next time
+            if (*it.second->writing) {
+                FC_LOG("auto saver skips busy document " << it.first);
+                break;
+            }
             try {
                 saveDocument(it.first, *it.second);
                 it.second->touched.clear();
@@ -244,7 +350,8 @@ void AutoSaver::timerEvent(QTimerEvent * event)
 
 // ----------------------------------------------------------------------------
 
-AutoSaveProperty::AutoSaveProperty(const App::Document* doc) : timerId(-1)
+AutoSaveProperty::AutoSaveProperty(const App::Document* doc)
+  : timerId(-1), writing(std::make_shared<std::atomic<bool>>(false))
 {
     //NOLINTBEGIN
     documentNew = const_cast<App::Document*>(doc)->signalNewObject.connect
@@ -401,5 +508,100 @@ void RecoveryWriter::writeFiles()
     }
 }
 
+// ----------------------------------------------------------------------------
+
+RecoverySnapshotWriter::RecoverySnapshotWriter()
+{
+    // use the same stream settings as Base::ZipWriter
+#ifdef _MSC_VER
+    stream.imbue(std::locale::empty());
+#else
+    stream.imbue(std::locale::classic());
+#endif
+    stream.precision(std::numeric_limits<double>::digits10 + 1);
+    stream.setf(std::ios::fixed, std::ios::floatfield);
+}
+
+RecoverySnapshotWriter::~RecoverySnapshotWriter() = default;
+
+std::ostream& RecoverySnapshotWriter::Stream()
+{
+    return stream;
+}
+
+void RecoverySnapshotWriter::flushEntry()
+{
+    if (!entries.empty() && !entries.back().prop) {
+        entries.back().data += stream.str();
+    }
+    stream.str(std::string());
+}
+
+void RecoverySnapshotWriter::putNextEntry(const char* file, const char* obj)
+{
+    Writer::putNextEntry(file, obj);
+
+    flushEntry();
+    entries.emplace_back();
+    entries.back().fileName = file;
+}
+
+void RecoverySnapshotWriter::writeFiles()
+{
+    // use a while loop because it is possible that while
+    // processing the files new ones can be added
+    size_t index = 0;
+    while (index < FileList.size()) {
+        FileEntry entry = FileList[index];
+
+        // Properties that provide a copy for saving in another thread, e.g. lists or
+        // shapes, are written later in a thread. Everything else must be written now,
+        // e.g. the Gui document or properties that refer to files.
+        std::unique_ptr<App::Property> copy;
+        if (entry.Object->isDerivedFrom<App::Property>()) {
+            const auto* prop = static_cast<const App::Property*>(entry.Object);
+            copy.reset(prop->copyForBackgroundSave());
+        }
+        if (copy) {
+            flushEntry();
+            entries.emplace_back();
+            entries.back().fileName = entry.FileName;
+            entries.back().prop = std::move(copy);
+        }
+        else {
+            putNextEntry(entry.FileName.c_str());
+            indent = 0;
+            indBuf[0] = 0;
+            entry.Object->SaveDocFile(*this);
+        }
+
+        index++;
+    }
+
+    flushEntry();
+}
+
+void RecoverySnapshotWriter::writeArchive(std::ostream& os) const
+{
+    Base::ZipWriter writer(os);
+    writer.setModes(getModes());
+    writer.setComment("AutoRecovery file");
+    writer.setLevel(1); // apparently the fastest compression
+
+    for (const auto& entry : entries) {
+        writer.putNextEntry(entry.fileName.c_str());
+        if (entry.prop) {
+            entry.prop->SaveDocFile(writer);
+        }
+        else {
+            writer.Stream().write(entry.data.c_str(),
+                                  static_cast<std::streamsize>(entry.data.size()));
+        }
+    }
+
+    // files requested while writing the property copies
+    writer.writeFiles();
+}
+
 
 #include "moc_AutoSaver.cpp"
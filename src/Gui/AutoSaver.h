@@ -26,9 +26,13 @@
 
 #include <QObject>
 
+#include <atomic>
 #include <map>
+#include <memory>
 #include <set>
+#include <sstream>
 #include <string>
+#include <vector>
 #include <boost/signals2.hpp>
 #include <Base/Writer.h>
 
@@ -50,6 +54,8 @@ public:
     std::set<std::string> touched;
     std::string dirName;
     std::map<std::string, std::string> fileMap;
+    /// set while a compressed recovery file is written in the background
+    std::shared_ptr<std::atomic<bool>> writing;
 
 private:
     void slotNewObject(const App::DocumentObject&);
@@ -82,6 +88,11 @@ public:
      Enables or disables to create compreesed recovery files.
      */
     void setCompressed(bool on);
+    /*!
+     Marks the given properties of the document as touched again, e.g. after the
+     recovery file that should have saved them couldn't be written.
+     */
+    void touchDocument(const std::string& name, const std::set<std::string>& props);
 
 protected:
     void slotCreateDocument(const App::Document& Doc);
@@ -116,6 +127,43 @@ private:
     AutoSaveProperty& saver;
 };
 
+/*!
+ The class RecoverySnapshotWriter takes a snapshot of a document on the main thread
+ so that the compressed recovery file can be written by a worker thread.
+ The XML entries and most data files are buffered as strings. The data files of
+ properties that provide App::Property::copyForBackgroundSave(), e.g. lists and
+ shapes, are kept as such copies and serialized by writeArchive().
+ */
+class GuiExport RecoverySnapshotWriter : public Base::Writer
+{
+public:
+    RecoverySnapshotWriter();
+    ~RecoverySnapshotWriter() override;
+
+    std::ostream& Stream() override;
+    void putNextEntry(const char* filename, const char* objName = nullptr) override;
+    void writeFiles() override;
+
+    /*!
+     Writes the snapshot as zip archive to \a os. It doesn't access the document
+     and thus can be called from any thread.
+     */
+    void writeArchive(std::ostream& os) const;
+
+private:
+    struct Entry
+    {
+        std::string fileName;
+        std::string data;
+        std::unique_ptr<App::Property> prop;
+    };
+    void flushEntry();
+
+private:
+    std::vector<Entry> entries;
+    std::ostringstream stream;
+};
+
 } //namespace Gui
 
 
@@ -0,0 +1,222 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2024 The FreeCAD Project Association                     *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+
+#ifndef _PreComp_
+#include <algorithm>
+#include <Inventor/SoPickedPoint.h>
+#include <Inventor/actions/SoRayPickAction.h>
+#include <Inventor/details/SoFaceDetail.h>
+#include <Inventor/details/SoPointDetail.h>
+#include <Inventor/fields/SoMFInt32.h>
+#endif
+
+#include "TriangleBVH.h"
+
+
+using namespace Gui;
+
+namespace
+{
+// Number of triangles below which a node is not split any further
+constexpr int LeafSize = 8;
+}  // namespace
+
+TriangleBVH::TriangleBVH(SoMFInt32* coordIndex)
+    : coordIndex(coordIndex)
+    , indexSensor(indexChanged, this)
+{
+    // Invalidate right away rather than from the delay queue so that a pick directly after a
+    // change never uses the old triangles.
+    indexSensor.setPriority(0);
+    indexSensor.attach(coordIndex);
+}
+
+TriangleBVH::~TriangleBVH()
+{
+    indexSensor.detach();
+}
+
+void TriangleBVH::indexChanged(void* data, SoSensor* /*sensor*/)
+{
+    static_cast<TriangleBVH*>(data)->invalidate();
+}
+
+void TriangleBVH::invalidate()
+{
+    valid = false;
+    nodes.clear();
+    triangles.clear();
+}
+
+bool TriangleBVH::update(uint32_t coordId, const SbVec3f* coords, int numCoords)
+{
+    if (valid && this->coordId == coordId && this->numCoords == numCoords) {
+        return usable;
+    }
+
+    invalidate();
+    valid = true;
+    usable = false;
+    this->coordId = coordId;
+    this->numCoords = numCoords;
+
+    int numIndices = coordIndex->getNum();
+    const int32_t* indices = coordIndex->getValues(0);
+    int numTriangles = numIndices / 4;
+    if (!coords || numTriangles < MinTriangles || numIndices % 4 != 0) {
+        return false;
+    }
+    for (int i = 0; i < numIndices; i += 4) {
+        for (int j = 0; j < 3; ++j) {
+            if (indices[i + j] < 0 || indices[i + j] >= numCoords) {
+                return false;
+            }
+        }
+        if (indices[i + 3] >= 0) {
+            return false;
+        }
+    }
+
+    std::vector<SbVec3f> centers(numTriangles);
+    triangles.resize(numTriangles);
+    for (int i = 0; i < numTriangles; ++i) {
+        const int32_t* tri = indices + 4 * i;
+        centers[i] = (coords[tri[0]] + coords[tri[1]] + coords[tri[2]]) / 3.0F;
+        triangles[i] = i;
+    }
+    nodes.reserve(2 * numTriangles / LeafSize + 1);
+    buildNode(centers, coords, 0, numTriangles);
+    usable = true;
+    return true;
+}
+
+int TriangleBVH::buildNode(const std::vector<SbVec3f>& centers,
+                           const SbVec3f* coords,
+                           int first,
+                           int count)
+{
+    const int32_t* indices = coordIndex->getValues(0);
+    int index = static_cast<int>(nodes.size());
+    nodes.emplace_back();
+
+    SbBox3f box;
+    SbBox3f centerBox;
+    for (int i = first; i < first + count; ++i) {
+        const int32_t* tri = indices + 4 * triangles[i];
+        box.extendBy(coords[tri[0]]);
+        box.extendBy(coords[tri[1]]);
+        box.extendBy(coords[tri[2]]);
+        centerBox.extendBy(centers[triangles[i]]);
+    }
+    nodes[index].box = box;
+    nodes[index].first = first;
+
+    if (count <= LeafSize) {
+        nodes[index].count = count;
+        nodes[index].second = -1;
+        return index;
+    }
+
+    // Split at the median along the longest extent of the triangle centers
+    float dx {};
+    float dy {};
+    float dz {};
+    centerBox.getSize(dx, dy, dz);
+    int axis = dx >= dy && dx >= dz ? 0 : (dy >= dz ? 1 : 2);
+    int half = count / 2;
+    auto begin = triangles.begin() + first;
+    std::nth_element(begin, begin + half, begin + count, [&centers, axis](int a, int b) {
+        return centers[a][axis] < centers[b][axis];
+    });
+
+    buildNode(centers, coords, first, half);
+    int second = buildNode(centers, coords, first + half, count - half);
+    nodes[index].count = 0;
+    nodes[index].second = second;
+    return index;
+}
+
+void TriangleBVH::rayPick(SoRayPickAction* action,
+                          SoNode* node,
+                          const SbVec3f* coords,
+                          const DetailFunc& detailFunc) const
+{
+    if (nodes.empty()) {
+        return;
+    }
+
+    const int32_t* indices = coordIndex->getValues(0);
+    std::vector<int> stack;
+    stack.push_back(0);
+    while (!stack.empty()) {
+        const Node& current = nodes[stack.back()];
+        int currentIndex = stack.back();
+        stack.pop_back();
+        if (!action->intersect(current.box, FALSE)) {
+            continue;
+        }
+        if (current.count == 0) {
+            stack.push_back(current.second);
+            stack.push_back(currentIndex + 1);
+            continue;
+        }
+
+        for (int i = current.first; i < current.first + current.count; ++i) {
+            int triangle = triangles[i];
+            const int32_t* tri = indices + 4 * triangle;
+            const SbVec3f& v0 = coords[tri[0]];
+            const SbVec3f& v1 = coords[tri[1]];
+            const SbVec3f& v2 = coords[tri[2]];
+            SbVec3f intersection;
+            SbVec3f barycentric;
+            SbBool front {};
+            if (!action->intersect(v0, v1, v2, intersection, barycentric, front)
+                || !action->isBetweenPlanes(intersection)) {
+                continue;
+            }
+            SoPickedPoint* pp = action->addIntersection(intersection);
+            if (!pp) {
+                continue;
+            }
+
+            SbVec3f normal = (v1 - v0).cross(v2 - v0);
+            normal.normalize();
+            pp->setObjectNormal(normal);
+
+            auto detail = new SoFaceDetail;
+            detail->setFaceIndex(triangle);
+            detail->setNumPoints(3);
+            SoPointDetail point;
+            for (int j = 0; j < 3; ++j) {
+                point.setCoordinateIndex(tri[j]);
+                detail->setPoint(j, &point);
+            }
+            if (detailFunc) {
+                detailFunc(detail);
+            }
+            pp->setDetail(detail, node);
+        }
+    }
+}
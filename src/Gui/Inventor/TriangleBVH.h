@@ -0,0 +1,112 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2024 The FreeCAD Project Association                     *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#ifndef GUI_INVENTOR_TRIANGLEBVH_H
+#define GUI_INVENTOR_TRIANGLEBVH_H
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+#include <Inventor/SbBox3f.h>
+#include <Inventor/sensors/SoFieldSensor.h>
+#include <FCGlobal.h>
+
+class SoFaceDetail;
+class SoMFInt32;
+class SoNode;
+class SoRayPickAction;
+
+namespace Gui
+{
+
+/**
+ * @class TriangleBVH
+ * @brief Bounding volume hierarchy over the triangles of an indexed face set.
+ *
+ * Coin picks a shape by generating and testing each of its triangles, which makes preselection
+ * on large shapes and meshes stutter. Face set nodes keep an instance of this class which is
+ * built on the first pick and only tests the triangles whose boxes the pick ray passes.
+ *
+ * Only triangles given as @c v1,v2,v3,-1 in the coordinate index are handled, which is what the
+ * Part and Mesh face sets use. For anything else update() returns false and the node falls back
+ * to the default picking.
+ */
+class GuiExport TriangleBVH
+{
+public:
+    /// Callback to complete the detail of a picked triangle, e.g. with a part index
+    using DetailFunc = std::function<void(SoFaceDetail*)>;
+
+    /// Shapes with fewer triangles are picked as fast without a hierarchy
+    static constexpr int MinTriangles = 256;
+
+    /// Invalidates the hierarchy whenever \a coordIndex changes
+    explicit TriangleBVH(SoMFInt32* coordIndex);
+    TriangleBVH(const TriangleBVH&) = delete;
+    TriangleBVH(TriangleBVH&&) = delete;
+    TriangleBVH& operator=(const TriangleBVH&) = delete;
+    TriangleBVH& operator=(TriangleBVH&&) = delete;
+    ~TriangleBVH();
+
+    /** Makes sure the hierarchy matches the coordinates and rebuilds it if needed.
+     * @param coordId: the node id of the coordinate element the coordinates come from
+     * @return false if the hierarchy cannot be used for these coordinates
+     */
+    bool update(uint32_t coordId, const SbVec3f* coords, int numCoords);
+    /// Marks the hierarchy as out of date
+    void invalidate();
+
+    /** Adds the intersections of the pick ray with the triangles to \a action.
+     * The ray of the action must already be in the object space of \a node.
+     */
+    void rayPick(SoRayPickAction* action,
+                 SoNode* node,
+                 const SbVec3f* coords,
+                 const DetailFunc& detailFunc = {}) const;
+
+private:
+    int buildNode(const std::vector<SbVec3f>& centers, const SbVec3f* coords, int first, int count);
+    static void indexChanged(void* data, SoSensor* sensor);
+
+    struct Node
+    {
+        SbBox3f box;
+        int first;
+        // Number of triangles of a leaf, 0 for an inner node
+        int count;
+        // Index of the second child of an inner node, the first one follows its parent
+        int second;
+    };
+    SoMFInt32* coordIndex;
+    SoFieldSensor indexSensor;
+    std::vector<Node> nodes;
+    std::vector<int> triangles;
+    uint32_t coordId = 0;
+    int numCoords = 0;
+    bool valid = false;
+    bool usable = false;
+};
+
+}  // namespace Gui
+
+#endif  // GUI_INVENTOR_TRIANGLEBVH_H
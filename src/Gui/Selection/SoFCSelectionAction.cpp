@@ -58,6 +58,7 @@
 # include <Inventor/nodes/SoProfileCoordinate2.h>
 # include <Inventor/nodes/SoProfileCoordinate3.h>
 # include <Inventor/nodes/SoSeparator.h>
+# include <Inventor/nodes/SoShape.h>
 # include <Inventor/nodes/SoSwitch.h>
 # include <Inventor/nodes/SoTransformation.h>
 #endif
@@ -1055,6 +1056,8 @@ void
 SoBoxSelectionRenderAction::initClass()
 {
     SO_ACTION_INIT_CLASS(SoBoxSelectionRenderAction, SoGLRenderAction);
+
+    SO_ACTION_ADD_METHOD(SoShape, renderShape);
 }
 
 SoBoxSelectionRenderAction::SoBoxSelectionRenderAction()
@@ -1098,6 +1101,13 @@ SoBoxSelectionRenderAction::constructorCommon()
     PRIVATE(this)->highlightPath = nullptr;
 }
 
+void
+SoBoxSelectionRenderAction::renderShape(SoAction * action, SoNode * node)
+{
+    ++static_cast<SoBoxSelectionRenderAction*>(action)->shapeCount;
+    SoNode::GLRenderS(action, node);
+}
+
 SoBoxSelectionRenderAction::~SoBoxSelectionRenderAction()
 {
     // clear highlighting node
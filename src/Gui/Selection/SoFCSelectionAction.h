@@ -333,6 +333,10 @@ public:
     unsigned short getLinePattern() const;
     void setLineWidth(const float width);
     float getLineWidth() const;
+    /// Number of shapes rendered since the last call of resetShapeCount().
+    /// Shapes replayed from a render cache are not traversed and not counted.
+    int getShapeCount() const { return shapeCount; }
+    void resetShapeCount() { shapeCount = 0; }
 
 protected:
     SbBool hlVisible;
@@ -340,8 +344,10 @@ protected:
 private:
     void constructorCommon();
     void drawBoxes(SoPath * pathtothis, const SoPathList * pathlist);
+    static void renderShape(SoAction * action, SoNode * node);
 
     SoBoxSelectionRenderActionP * pimpl;
+    int shapeCount{0};
 };
 
 /**
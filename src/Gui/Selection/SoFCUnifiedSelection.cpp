@@ -23,6 +23,7 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+# include <algorithm>
 # include <Inventor/SoFullPath.h>
 # include <Inventor/SoPickedPoint.h>
 # include <Inventor/actions/SoCallbackAction.h>
@@ -30,6 +31,7 @@
 # include <Inventor/actions/SoGetPrimitiveCountAction.h>
 # include <Inventor/actions/SoGLRenderAction.h>
 # include <Inventor/actions/SoHandleEventAction.h>
+# include <Inventor/actions/SoRayPickAction.h>
 # include <Inventor/actions/SoWriteAction.h>
 # include <Inventor/bundles/SoMaterialBundle.h>
 # include <Inventor/details/SoFaceDetail.h>
@@ -46,6 +48,7 @@
 # include <Inventor/elements/SoShapeStyleElement.h>
 # include <Inventor/elements/SoSwitchElement.h>
 # include <Inventor/elements/SoTextureEnabledElement.h>
+# include <Inventor/elements/SoViewVolumeElement.h>
 # include <Inventor/events/SoLocation2Event.h>
 # include <Inventor/events/SoMouseButtonEvent.h>
 # include <Inventor/misc/SoChildList.h>
@@ -1092,6 +1095,7 @@ std::unordered_map<SoAction*,SoFCSelectionRoot::Stack> SoFCSelectionRoot::Action
 SoFCSelectionRoot::ColorStack SoFCSelectionRoot::SelColorStack;
 SoFCSelectionRoot::ColorStack SoFCSelectionRoot::HlColorStack;
 SoFCSelectionRoot* SoFCSelectionRoot::ShapeColorNode;
+std::unordered_map<const SoNode*,std::size_t> SoFCSelectionRoot::SecondaryContextCounts;
 
 SO_NODE_SOURCE(SoFCSelectionRoot)
 
@@ -1106,7 +1110,28 @@ SoFCSelectionRoot::SoFCSelectionRoot(bool trackCacheMode)
     SO_NODE_SET_SF_ENUM_TYPE(selectionStyle, SelectStyles);
 }
 
-SoFCSelectionRoot::~SoFCSelectionRoot() = default;
+SoFCSelectionRoot::~SoFCSelectionRoot()
+{
+    for(auto &v : contextMap2)
+        countSecondaryContext(v.first,false);
+}
+
+void SoFCSelectionRoot::countSecondaryContext(const Stack &key, bool add) {
+    // The nodes are only used as keys here, they may have been deleted already
+    auto count = [add](const SoNode *node) {
+        auto &n = SecondaryContextCounts[node];
+        if(add)
+            ++n;
+        else if(n <= 1)
+            SecondaryContextCounts.erase(node);
+        else
+            --n;
+    };
+    count(this);
+    // the last one is the node the context is for, it is below this root
+    for(std::size_t i=0; i+1<key.size(); ++i)
+        count(key[i]);
+}
 
 void SoFCSelectionRoot::initClass()
 {
@@ -1198,14 +1223,20 @@ std::pair<bool,SoFCSelectionContextBasePtr*> SoFCSelectionRoot::findActionContex
         auto back = dynamic_cast<SoFCSelectionRoot*>(stack.back());
         if (back != nullptr) {
             stack.back() = _node;
-            if(create)
-                res.second = &back->contextMap2[stack];
+            if(create) {
+                auto inserted = back->contextMap2.emplace(stack,SoFCSelectionContextBasePtr());
+                if(inserted.second)
+                    back->countSecondaryContext(stack,true);
+                res.second = &inserted.first->second;
+            }
             else {
                 auto it = back->contextMap2.find(stack);
                 if(it!=back->contextMap2.end()) {
                     res.second = &it->second;
-                    if(erase)
+                    if(erase) {
+                        back->countSecondaryContext(it->first,false);
                         back->contextMap2.erase(it);
+                    }
                 }
             }
             stack.back() = back;
@@ -1293,16 +1324,71 @@ void SoFCSelectionRoot::renderPrivate(SoGLRenderAction * action, bool inPath) {
         return;
     }
     SelStack.push_back(this);
-    if(_renderPrivate(action,inPath)) {
-        if(inPath)
-            SoSeparator::GLRenderInPath(action);
-        else
-            SoSeparator::GLRenderBelowPath(action);
-    }
+    if(_renderPrivate(action,inPath))
+        renderChildren(action,inPath);
     SelStack.pop_back();
     SelStack.nodeSet.erase(this);
 }
 
+bool SoFCSelectionRoot::canShareRenderCache() const {
+    // A shared cache is recorded through whichever path comes first, so
+    // anything that may render the paths differently must disable it.
+    if(ShapeColorNode || !SelColorStack.empty() || !HlColorStack.empty())
+        return false;
+    if(SecondaryContextCounts.count(this))
+        return false;
+    return !hasActiveContext();
+}
+
+bool SoFCSelectionRoot::hasActiveContext() const {
+    // The contexts of the nodes below are kept by the first selection root of
+    // the path, keyed by the selection roots leading to the node. Only look at
+    // those on a path through this node.
+    if(SelStack.empty())
+        return false;
+    auto front = dynamic_cast<SoFCSelectionRoot*>(SelStack.front());
+    if(!front)
+        return false;
+    for(auto &v : front->contextMap) {
+        const Stack &key = v.first;
+        if(front != this && std::find(key.begin()+key.offset, key.end(), this) == key.end())
+            continue;
+        if(auto ctx = std::dynamic_pointer_cast<SoFCSelectionContext>(v.second)) {
+            if(ctx->isSelected() || ctx->isHighlighted())
+                return true;
+        }
+        else if(auto ctx = std::dynamic_pointer_cast<SelContext>(v.second)) {
+            if(ctx->selAll || ctx->hlAll || ctx->hideAll)
+                return true;
+        }
+        else if(v.second)
+            return true;
+    }
+    return false;
+}
+
+void SoFCSelectionRoot::renderChildren(SoGLRenderAction * action, bool inPath) {
+    if(inPath) {
+        SoSeparator::GLRenderInPath(action);
+        return;
+    }
+    if(!shareRenderCache) {
+        SoSeparator::GLRenderBelowPath(action);
+        return;
+    }
+    if(canShareRenderCache()) {
+        // SoFCSeparator keeps the caching mode in sync with the user setting
+        inherited::GLRenderBelowPath(action);
+        return;
+    }
+    // Traverse without touching the shared cache, so that it stays valid for
+    // when the other paths render the same again.
+    auto state = action->getState();
+    state->push();
+    SoGroup::GLRenderBelowPath(action);
+    state->pop();
+}
+
 bool SoFCSelectionRoot::_renderPrivate(SoGLRenderAction * action, bool inPath) {
     auto ctx2 = std::static_pointer_cast<SelContext>(getNodeContext2(SelStack,this,SelContext::merge));
     if(ctx2 && ctx2->hideAll)
@@ -1355,10 +1441,7 @@ bool SoFCSelectionRoot::_renderPrivate(SoGLRenderAction * action, bool inPath) {
     }
 
     if(!ctx) {
-        if(inPath)
-            SoSeparator::GLRenderInPath(action);
-        else
-            SoSeparator::GLRenderBelowPath(action);
+        renderChildren(action,inPath);
     } else {
         bool selPushed;
         bool hlPushed;
@@ -1383,10 +1466,7 @@ bool SoFCSelectionRoot::_renderPrivate(SoGLRenderAction * action, bool inPath) {
         if((hlPushed = ctx->hlAll))
             HlColorStack.push_back(ctx->hlColor);
 
-        if(inPath)
-            SoSeparator::GLRenderInPath(action);
-        else
-            SoSeparator::GLRenderBelowPath(action);
+        renderChildren(action,inPath);
 
         if(selPushed) {
             SelColorStack.pop_back();
@@ -1497,11 +1577,51 @@ void SoFCSelectionRoot::pick(SoPickAction * action) {
 
 void SoFCSelectionRoot::rayPick(SoRayPickAction * action) {
     BEGIN_ACTION;
-    if(doActionPrivate(stack,action))
+    if(doActionPrivate(stack,action) && !cullTestPick(stack,action))
         inherited::rayPick(action);
     END_ACTION;
 }
 
+SoGetBoundingBoxAction *SoFCSelectionRoot::PickBBoxAction;
+
+bool SoFCSelectionRoot::cullTestPick(Stack &stack, SoRayPickAction *action) {
+    // Coin only culls a separator with a valid bounding box cache, which selection roots don't
+    // have because they may show differently depending on the path. So keep our own box for
+    // each path, computed through that path so that any state from above applies.
+    if(pickCulling.getValue() == SoSeparator::OFF
+            || action->getCurPathCode() == SoAction::IN_PATH)
+        return false;
+
+    auto state = action->getState();
+    auto viewVolume = static_cast<const SoReplacedElement*>(
+            state->getConstElement(SoViewVolumeElement::getClassStackIndex()));
+    uint32_t cameraId = viewVolume ? viewVolume->getNodeId() : 0;
+    if(pickBBoxNodeId != getNodeId()) {
+        pickBBoxMap.clear();
+        pickBBoxNodeId = getNodeId();
+    }
+    auto res = pickBBoxMap.emplace(stack,PickBBox());
+    auto &pickBBox = res.first->second;
+    if(res.second || pickBBox.cameraId != cameraId) {
+        SoGetBoundingBoxAction bboxAction(action->getViewportRegion());
+        auto path = action->getCurPath()->copy();
+        path->ref();
+        bboxAction.setResetPath(path, TRUE, SoGetBoundingBoxAction::TRANSFORM);
+        // Hidden elements are still included so that the box covers every path to this node
+        auto prevAction = PickBBoxAction;
+        PickBBoxAction = &bboxAction;
+        bboxAction.apply(path);
+        PickBBoxAction = prevAction;
+        path->unref();
+        pickBBox.bbox = bboxAction.getBoundingBox();
+        pickBBox.cameraId = cameraId;
+    }
+    if(pickBBox.bbox.isEmpty())
+        return false;
+    action->setObjectSpace();
+    return !action->intersect(pickBBox.bbox, TRUE);
+}
+
 void SoFCSelectionRoot::handleEvent(SoHandleEventAction * action) {
     BEGIN_ACTION;
     inherited::handleEvent(action);
@@ -1523,7 +1643,7 @@ void SoFCSelectionRoot::getPrimitiveCount(SoGetPrimitiveCountAction * action) {
 void SoFCSelectionRoot::getBoundingBox(SoGetBoundingBoxAction * action)
 {
     BEGIN_ACTION;
-    if(doActionPrivate(stack,action))
+    if(action == PickBBoxAction || doActionPrivate(stack,action))
         inherited::getBoundingBox(action);
     END_ACTION;
 }
@@ -27,6 +27,7 @@
 #include <unordered_map>
 #include <unordered_set>
 
+#include <Inventor/SbBox3f.h>
 #include <Inventor/elements/SoLazyElement.h>
 #include <Inventor/fields/SoSFBool.h>
 #include <Inventor/fields/SoSFColor.h>
@@ -307,6 +308,23 @@ public:
         overrideColor = false;
     }
 
+    /** Share the render cache of this node between all paths leading to it
+     *
+     * A linked scene graph is referenced by every element of a link array. With
+     * sharing enabled, the render cache recorded through one path is replayed for
+     * all the others, so that each instance costs a single cached draw. The cache
+     * is bypassed while any node below is selected or highlighted, or has a
+     * secondary context on a path through this node, because these may render
+     * each instance differently.
+     */
+    void setShareRenderCache(bool enable) {
+        shareRenderCache = enable;
+    }
+
+    bool isShareRenderCache() const {
+        return shareRenderCache;
+    }
+
     enum SelectStyles {
         Full, Box, PassThrough
     };
@@ -319,6 +337,9 @@ protected:
 
     void renderPrivate(SoGLRenderAction *, bool inPath);
     bool _renderPrivate(SoGLRenderAction *, bool inPath);
+    void renderChildren(SoGLRenderAction *, bool inPath);
+    bool canShareRenderCache() const;
+    bool hasActiveContext() const;
 
     class Stack : public std::vector<SoNode*> {
     public:
@@ -342,6 +363,10 @@ protected:
     using ContextMap = std::map<Stack,SoFCSelectionContextBasePtr,StackComp>;
     ContextMap contextMap;
     ContextMap contextMap2;//holding secondary context
+    // Number of secondary contexts kept by or on a path through each selection root
+    static std::unordered_map<const SoNode*,std::size_t> SecondaryContextCounts;
+    void countSecondaryContext(const Stack &key, bool add);
+    bool shareRenderCache = false;
 
     struct SelContext: SoFCSelectionContextBase {
     public:
@@ -363,6 +388,18 @@ protected:
     SoColorPacker shapeColorPacker;
 
     bool doActionPrivate(Stack &stack, SoAction *);
+
+    // Skip the whole sub-tree when picking if the ray misses its bounding box. The box is kept
+    // in local coordinates for each path, the same way as the selection contexts, and
+    // recomputed when the sub-tree or the camera changes.
+    bool cullTestPick(Stack &stack, SoRayPickAction *action);
+    struct PickBBox {
+        SbBox3f bbox;
+        uint32_t cameraId = 0;
+    };
+    std::map<Stack,PickBBox,StackComp> pickBBoxMap;
+    uint32_t pickBBoxNodeId = 0;
+    static SoGetBoundingBoxAction *PickBBoxAction;
 };
 
 /**
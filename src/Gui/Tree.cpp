@@ -997,7 +997,7 @@ void TreeWidget::_updateStatus(bool delay) {
     }
 
     if (!delay) {
-        if (!ChangedObjects.empty() || !NewObjects.empty())
+        if (!ChangedObjects.empty() || !NewObjects.empty() || !StatusObjects.empty())
             onUpdateStatus();
         return;
     }
@@ -2837,6 +2837,7 @@ void TreeWidget::slotNewDocument(const Gui::Document& Doc, bool isMainDoc)
 {
     if (Doc.getDocument()->testStatus(App::Document::TempDoc))
         return;
+    fullStatusUpdate = true;
     auto item = new DocumentItem(&Doc, this->rootItem);
     if (isMainDoc)
         this->expandItem(item);
@@ -2941,6 +2942,13 @@ void TreeWidget::slotTouchedObject(const App::DocumentObject& obj) {
     _updateStatus();
 }
 
+void TreeWidget::slotChangedObjectStatus(const App::DocumentObject& obj) {
+    if (Q_UNLIKELY(thread() != QThread::currentThread()))
+        return;
+    StatusObjects.insert(const_cast<App::DocumentObject*>(&obj));
+    _updateStatus();
+}
+
 void TreeWidget::slotShowHidden(const Gui::Document& Doc)
 {
     auto it = DocumentMap.find(&Doc);
@@ -3013,6 +3021,17 @@ struct UpdateDisabler {
     }
 };
 
+static void testItemTreeStatus(DocumentObjectItem* item)
+{
+    item->testStatus(false);
+    // The visibility of a child item may be controlled by its parent
+    for (int i = 0, count = item->childCount(); i < count; ++i) {
+        auto child = item->child(i);
+        if (child->type() == TreeWidget::ObjectType)
+            testItemTreeStatus(static_cast<DocumentObjectItem*>(child));
+    }
+}
+
 void TreeWidget::onUpdateStatus()
 {
     if (this->state() == DraggingState || App::GetApplication().isRestoring()) {
@@ -3099,10 +3118,32 @@ void TreeWidget::onUpdateStatus()
         updateChildren(iter->first, iter->second, v.second.test(CS_Output), false);
     }
 
-    FC_LOG("update item status");
+    // Use a local copy in case of nested calls
+    auto localStatusObjects = StatusObjects;
+    StatusObjects.clear();
+    for (auto& v : localChangedObjects)
+        localStatusObjects.insert(v.first);
+
     TimingInit();
-    for (auto pos = DocumentMap.begin(); pos != DocumentMap.end(); ++pos) {
-        pos->second->testStatus();
+    FC_TIME_INIT(t);
+    if (fullStatusUpdate || localStatusObjects.size() > ObjectTable.size() / 2) {
+        fullStatusUpdate = false;
+        for (auto pos = DocumentMap.begin(); pos != DocumentMap.end(); ++pos) {
+            pos->second->testStatus();
+        }
+        FC_TIME_LOG(t, "update status of all " << ObjectTable.size() << " objects");
+    }
+    else {
+        for (auto obj : localStatusObjects) {
+            auto iter = ObjectTable.find(obj);
+            if (iter == ObjectTable.end())
+                continue;
+            for (auto& data : iter->second) {
+                for (auto item : data->items)
+                    testItemTreeStatus(item);
+            }
+        }
+        FC_TIME_LOG(t, "update status of " << localStatusObjects.size() << " objects");
     }
     TimingPrint();
 
@@ -3122,6 +3163,8 @@ void TreeWidget::onUpdateStatus()
                 std::bind(&TreeWidget::slotChangeObject, this, sp::_1, sp::_2));
             docItem->connectTouchedObject = doc->signalTouchedObject.connect(
                 std::bind(&TreeWidget::slotTouchedObject, this, sp::_1));
+            docItem->connectChgObjectStatus = doc->signalChangedObjectStatus.connect(
+                std::bind(&TreeWidget::slotChangedObjectStatus, this, sp::_1));
             //NOLINTEND
         }
 
@@ -3798,6 +3841,8 @@ DocumentItem::DocumentItem(const Gui::Document* doc, QTreeWidgetItem* parent)
             std::bind(&TreeWidget::slotChangeObject, getTree(), sp::_1, sp::_2));
         connectTouchedObject = doc->getDocument()->signalTouchedObject.connect(
             std::bind(&TreeWidget::slotTouchedObject, getTree(), sp::_1));
+        connectChgObjectStatus = doc->getDocument()->signalChangedObjectStatus.connect(
+            std::bind(&TreeWidget::slotChangedObjectStatus, getTree(), sp::_1));
     }
     connectEdtObject = doc->signalInEdit.connect(std::bind(&DocumentItem::slotInEdit, this, sp::_1));
     connectResObject = doc->signalResetEdit.connect(std::bind(&DocumentItem::slotResetEdit, this, sp::_1));
@@ -3823,6 +3868,7 @@ DocumentItem::~DocumentItem()
     connectDelObject.disconnect();
     connectChgObject.disconnect();
     connectTouchedObject.disconnect();
+    connectChgObjectStatus.disconnect();
     connectEdtObject.disconnect();
     connectResObject.disconnect();
     connectHltObject.disconnect();
@@ -3999,6 +4045,7 @@ void TreeWidget::slotDeleteObject(const Gui::ViewProviderDocumentObject& view) {
 void TreeWidget::_slotDeleteObject(const Gui::ViewProviderDocumentObject& view, DocumentItem* deletingDoc)
 {
     auto obj = view.getObject();
+    StatusObjects.erase(obj);
     auto itEntry = ObjectTable.find(obj);
     if (itEntry == ObjectTable.end())
         return;
@@ -4372,6 +4419,7 @@ void TreeWidget::slotChangeObject(
     if (itEntry == ObjectTable.end() || itEntry->second.empty())
         return;
 
+    StatusObjects.insert(obj);
     _updateStatus();
 
     // Let's not waste time on the newly added Visibility property in
@@ -4689,18 +4737,18 @@ void DocumentItem::slotScrollToObject(const Gui::ViewProviderDocumentObject& obj
 }
 
 void DocumentItem::slotRecomputedObject(const App::DocumentObject& obj) {
-    if (obj.isValid())
-        return;
     slotRecomputed(*obj.getDocument(), { const_cast<App::DocumentObject*>(&obj) });
 }
 
 void DocumentItem::slotRecomputed(const App::Document&, const std::vector<App::DocumentObject*>& objs) {
     auto tree = getTree();
     for (auto obj : objs) {
+        // Recomputing resets the touched status without any change notification
+        tree->StatusObjects.insert(obj);
         if (!obj->isValid())
             tree->ChangedObjects[obj].set(TreeWidget::CS_Error);
     }
-    if (!tree->ChangedObjects.empty())
+    if (!objs.empty())
         tree->_updateStatus();
 }
 
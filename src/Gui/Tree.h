@@ -25,6 +25,7 @@
 #define GUI_TREE_H
 
 #include <unordered_map>
+#include <unordered_set>
 #include <QElapsedTimer>
 #include <QStyledItemDelegate>
 #include <QTreeWidget>
@@ -217,6 +218,7 @@ private:
     void slotDeleteObject(const Gui::ViewProviderDocumentObject&);
     void slotChangeObject(const Gui::ViewProviderDocumentObject&, const App::Property &prop);
     void slotTouchedObject(const App::DocumentObject&);
+    void slotChangedObjectStatus(const App::DocumentObject&);
 
     void changeEvent(QEvent *e) override;
     void setupText();
@@ -264,6 +266,13 @@ private:
     };
     std::unordered_map<App::DocumentObject*,std::bitset<32> > ChangedObjects;
 
+    // Objects whose item status (overlay icons, visibility) may be out of date.
+    // Only their items are tested on the next status update instead of all items.
+    // Status changes without a property change, e.g. DocumentObject::purgeTouched(),
+    // are announced by App::Document::signalChangedObjectStatus.
+    std::unordered_set<App::DocumentObject*> StatusObjects;
+    bool fullStatusUpdate = true;
+
     std::unordered_map<std::string,std::vector<long> > NewObjects;
 
     static std::set<TreeWidget*> Instances;
@@ -388,6 +397,7 @@ private:
     Connection connectDelObject;
     Connection connectChgObject;
     Connection connectTouchedObject;
+    Connection connectChgObjectStatus;
     Connection connectEdtObject;
     Connection connectResObject;
     Connection connectHltObject;
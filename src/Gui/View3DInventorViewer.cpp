@@ -416,6 +416,7 @@ void View3DInventorViewer::init()
 
     shading = true;
     fpsEnabled = false;
+    renderedShapes = 0;
     vboEnabled = false;
 
     attachSelection();
@@ -1324,6 +1325,11 @@ void View3DInventorViewer::setEnabledFPSCounter(bool on)
     fpsEnabled = on;
 }
 
+View3DInventorViewer::RenderStatistics View3DInventorViewer::getRenderStatistics() const
+{
+    return {framesPerSecond[0], framesPerSecond[1], renderedShapes};
+}
+
 void View3DInventorViewer::setEnabledVBO(bool on)
 {
     vboEnabled = on;
@@ -2438,6 +2444,10 @@ void View3DInventorViewer::renderScene()
     SoGLWidgetElement::set(state, qobject_cast<QtGLWidget*>(this->getGLWidget()));
     SoGLRenderActionElement::set(state, glra);
     SoGLVBOActivatedElement::set(state, this->vboEnabled);
+    auto boxAction = dynamic_cast<SoBoxSelectionRenderAction*>(glra);
+    if (boxAction) {
+        boxAction->resetShapeCount();
+    }
     drawSingleBackground(col);
     glra->apply(this->backgroundroot);
 
@@ -2483,6 +2493,10 @@ void View3DInventorViewer::renderScene()
         this->drawAxisCross();
     }
 
+    if (boxAction) {
+        renderedShapes = boxAction->getShapeCount();
+    }
+
 #if defined (ENABLE_GL_DEPTH_RANGE)
     // using the main portion of z-buffer again (for frontbuffer highlighting)
     glDepthRange(0.1,1.0);
@@ -436,6 +436,12 @@ public:
     void changeRotationCenterPosition(const SbVec3f& newCenter);
 
     void setEnabledFPSCounter(bool on);
+    struct RenderStatistics {
+        float drawTime;         // averaged time spent rendering a frame in ms
+        float framesPerSecond;  // averaged frame rate
+        int shapeCount;         // shapes traversed in the last frame, excluding render caches
+    };
+    RenderStatistics getRenderStatistics() const;
     void setEnabledNaviCube(bool on);
     bool isEnabledNaviCube() const;
     void setNaviCubeCorner(int);
@@ -546,6 +552,7 @@ private:
 
     //stuff needed to draw the fps counter
     bool fpsEnabled;
+    int renderedShapes;
     bool vboEnabled;
     bool naviCubeEnabled;
 
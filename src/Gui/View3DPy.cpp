@@ -232,6 +232,12 @@ void View3DInventorPy::init_type()
         "setCornerCrossSize(int): Defines corner axis cross size");
     add_noargs_method("getCornerCrossSize",&View3DInventorPy::getCornerCrossSize,
         "getCornerCrossSize(): Returns current corner axis cross size");
+    add_noargs_method("getRenderStatistics",&View3DInventorPy::getRenderStatistics,
+        "getRenderStatistics() -> dictionary\n"
+        "\n"
+        "Return the averaged draw time in ms and frame rate, and the number of\n"
+        "shapes rendered in the last frame. Shapes replayed from a render cache\n"
+        "are not counted.");
     add_noargs_method("cast_to_base", &View3DInventorPy::cast_to_base, "cast_to_base() cast to MDIView class");
 }
 
@@ -2568,6 +2574,17 @@ Py::Object View3DInventorPy::getCornerCrossSize()
     return Py::Long(size);
 }
 
+Py::Object View3DInventorPy::getRenderStatistics()
+{
+    View3DInventorViewer::RenderStatistics stats =
+        getView3DInventorPtr()->getViewer()->getRenderStatistics();
+    Py::Dict dict;
+    dict.setItem("DrawTime", Py::Float(stats.drawTime));
+    dict.setItem("FramesPerSecond", Py::Float(stats.framesPerSecond));
+    dict.setItem("Shapes", Py::Long(stats.shapeCount));
+    return dict;
+}
+
 Py::Object View3DInventorPy::cast_to_base()
 {
     return Gui::MDIViewPy::create(getView3DInventorPtr());
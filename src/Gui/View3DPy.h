@@ -124,6 +124,7 @@ public:
     Py::Object isCornerCrossVisible();
     Py::Object setCornerCrossSize(const Py::Tuple& args);
     Py::Object getCornerCrossSize();
+    Py::Object getRenderStatistics();
 
 private:
     void setDefaultCameraHeight(float);
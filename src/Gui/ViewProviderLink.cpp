@@ -378,12 +378,20 @@ public:
             if(!update)
                 return pcSnapshot;
         }else{
-            if(ViewParams::instance()->getUseSelectionRoot())
-                pcSnapshot = new SoFCSelectionRoot;
-            else
+            if(ViewParams::instance()->getUseSelectionRoot()) {
+                // The snapshot is shared by all links to this object, so let
+                // them replay a single render cache instead of traversing the
+                // linked scene graph once per instance. The caching mode
+                // follows the user setting.
+                auto root = new SoFCSelectionRoot(true);
+                root->setShareRenderCache(true);
+                pcSnapshot = root;
+            }
+            else {
                 pcSnapshot = new SoSeparator;
-            pcSnapshot->boundingBoxCaching = SoSeparator::OFF;
-            pcSnapshot->renderCaching = SoSeparator::OFF;
+                pcSnapshot->boundingBoxCaching = SoSeparator::OFF;
+                pcSnapshot->renderCaching = SoSeparator::OFF;
+            }
             std::ostringstream ss;
             ss << pcLinked->getObject()->getNameInDocument()
                 << "(" << type << ')';
@@ -23,8 +23,15 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <algorithm>
+#include <atomic>
 #include <boost/core/ignore_unused.hpp>
 #include <cmath>
+#include <functional>
+#include <future>
+#include <limits>
+#include <sstream>
+#include <typeinfo>
 #include <vector>
 #include <unordered_map>
 #endif
@@ -40,11 +47,15 @@
 #include <App/Link.h>
 #include <App/PropertyPythonObject.h>
 #include <Base/Console.h>
+#include <Base/Exception.h>
+#include <Base/FileInfo.h>
+#include <Base/Stream.h>
 #include <Base/Placement.h>
 #include <Base/Rotation.h>
 #include <Base/Tools.h>
 #include <Base/Interpreter.h>
 
+#include <Mod/Part/App/PartFeature.h>
 #include <Mod/Part/App/TopoShape.h>
 #include <Mod/Part/App/AttachExtension.h>
 
@@ -105,12 +116,20 @@ PROPERTY_SOURCE(Assembly::AssemblyObject, App::Part)
 
 AssemblyObject::AssemblyObject()
     : mbdAssembly(std::make_shared<ASMTAssembly>())
+    , checkDragInterferences(false)
     , bundleFixed(false)
+    , simulationFrameCount(0)
+    , recordedFrames(0)
+    , simulationStart(0.0)
+    , simulationStep(0.0)
 {
     mbdAssembly->externalSystem->freecadAssemblyObject = this;
 }
 
-AssemblyObject::~AssemblyObject() = default;
+AssemblyObject::~AssemblyObject()
+{
+    waitForSimulationFrames();
+}
 
 PyObject* AssemblyObject::getPyObject()
 {
@@ -134,14 +153,24 @@ App::DocumentObjectExecReturn* AssemblyObject::execute()
 }
 
 int AssemblyObject::solve(bool enableRedo, bool updateJCS)
+{
+    ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Assembly");
+
+    // Parts held together by fixed joints can be given to the solver as a single body. This
+    // changes the solver input and thus possibly the result, so it is opt-in.
+    Base::StateLocker lock(bundleFixed, bundleFixed || hGrp->GetBool("MergeRigidParts", false));
+
+    return solveMbd(enableRedo, updateJCS, true);
+}
+
+int AssemblyObject::solveMbd(bool enableRedo, bool updateJCS, bool splitComponents)
 {
     ensureIdentityPlacements();
 
-    mbdAssembly = makeMbdAssembly();
-    objectPartMap.clear();
     motions.clear();
 
-    auto groundedObjs = fixGroundedParts();
+    auto groundedObjs = getGroundedParts();
     if (groundedObjs.empty()) {
         // If no part fixed we can't solve.
         return -6;
@@ -151,25 +180,106 @@ int AssemblyObject::solve(bool enableRedo, bool updateJCS)
 
     removeUnconnectedJoints(joints, groundedObjs);
 
-    jointParts(joints);
+    FC_TIME_INIT(t);
+
+    ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Assembly");
+    std::string key;
+    if (hGrp->GetBool("KeepSolverModel", true)) {
+        key = getMbdModelKey(joints, groundedObjs, splitComponents);
+    }
+
+    // Rebuilding the solver model is the expensive part for large assemblies, so reuse the one of
+    // the previous solve if the joints still connect the same parts in the same way.
+    if (key.empty() || key != mbdModelKey || !updateMbdModel()) {
+        std::vector<std::vector<App::DocumentObject*>> jointSets;
+        if (splitComponents) {
+            jointSets = getIndependentJointSets(joints, groundedObjs);
+        }
+        else {
+            jointSets.push_back(joints);
+        }
+
+        // Each set of joints gets its own solver model. The parts that cannot move are in all of
+        // them, the other ones in a single one.
+        std::unordered_map<App::DocumentObject*, MbDPartData> partMap;
+        mbdComponents.clear();
+        componentPartMaps.clear();
+        componentItems.clear();
+        componentJoints.clear();
+        for (auto& jointSet : jointSets) {
+            mbdAssembly = makeMbdAssembly();
+            objectPartMap.clear();
+            mbdItems.clear();
+
+            fixGroundedParts();
+            jointParts(jointSet);
+
+            partMap.insert(objectPartMap.begin(), objectPartMap.end());
+            mbdComponents.push_back(mbdAssembly);
+            componentPartMaps.push_back(std::move(objectPartMap));
+            componentItems.push_back(std::move(mbdItems));
+            componentJoints.push_back(std::move(jointSet));
+        }
+        objectPartMap = std::move(partMap);
+        mbdAssembly = mbdComponents.front();
+
+        FC_TIME_LOG(t,
+                    "Build solver model (" << objectPartMap.size() << " parts, " << joints.size()
+                                           << " joints, " << mbdComponents.size()
+                                           << " independent sets)");
+    }
+    else {
+        FC_TIME_LOG(t, "Update solver model (" << objectPartMap.size() << " parts)");
+    }
+    mbdModelKey.clear();
 
     if (enableRedo) {
         savePlacementsForUndo();
     }
 
-    try {
-        // mbdAssembly->runPreDrag();  // solve() is causing some issues with limits.
-        mbdAssembly->runKINEMATIC();
+    std::vector<std::string> errors(mbdComponents.size());
+    auto runComponents = [this, &errors](std::atomic<size_t>& next) {
+        for (size_t i = next++; i < mbdComponents.size(); i = next++) {
+            try {
+                // runPreDrag() is causing some issues with limits.
+                mbdComponents[i]->runKINEMATIC();
+            }
+            catch (const std::exception& e) {
+                errors[i] = e.what();
+            }
+            catch (...) {
+                errors[i] = "unhandled exception";
+            }
+        }
+    };
+
+    // Off by default until OndselSolver is known to be reentrant.
+    std::atomic<size_t> next(0);
+    size_t threadCount = 1;
+    if (hGrp->GetBool("ParallelSolve", false)) {
+        threadCount = std::min<size_t>(std::max(1U, std::thread::hardware_concurrency()),
+                                       mbdComponents.size());
     }
-    catch (const std::exception& e) {
-        FC_ERR("Solve failed: " << e.what());
-        return -1;
+    std::vector<std::future<void>> tasks;
+    for (size_t i = 1; i < threadCount; ++i) {
+        tasks.push_back(std::async(std::launch::async, runComponents, std::ref(next)));
     }
-    catch (...) {
-        FC_ERR("Solve failed: unhandled exception");
-        return -1;
+    runComponents(next);
+    for (auto& task : tasks) {
+        task.get();
     }
 
+    for (auto& error : errors) {
+        if (!error.empty()) {
+            FC_ERR("Solve failed: " << error);
+            return -1;
+        }
+    }
+    FC_TIME_LOG(t, "Solve");
+
+    mbdModelKey = key;
+
     setNewPlacements();
 
     redrawJointPlacements(joints);
@@ -181,6 +291,15 @@ int AssemblyObject::generateSimulation(App::DocumentObject* sim)
 {
     mbdAssembly = makeMbdAssembly();
     objectPartMap.clear();
+    mbdItems.clear();
+    mbdComponents = {mbdAssembly};
+    componentPartMaps.clear();
+    mbdModelKey.clear();
+
+    simulationObjects.clear();
+    simulationFrames.clear();
+    simulationFrameCount = 0;
+    recordedFrames = 0;
 
     motions = getMotionsFromSimulation(sim);
 
@@ -210,9 +329,111 @@ int AssemblyObject::generateSimulation(App::DocumentObject* sim)
 
     motions.clear();
 
+    auto valueOf = [](DocumentObject* docObj, const char* propName) {
+        auto* prop = dynamic_cast<App::PropertyFloat*>(docObj->getPropertyByName(propName));
+        if (!prop) {
+            return 0.0;
+        }
+        return prop->getValue();
+    };
+    simulationStart = valueOf(sim, "aTimeStart");
+    simulationStep = valueOf(sim, "cTimeStepOutput");
+
+    recordSimulationFrames();
+
     return 0;
 }
 
+void AssemblyObject::recordSimulationFrames()
+{
+    simulationFrameCount = mbdAssembly->numberOfFrames();
+
+    std::vector<MbDPartData> parts;
+    for (auto& pair : objectPartMap) {
+        if (!pair.first || !pair.second.part) {
+            continue;
+        }
+        if (!dynamic_cast<App::PropertyPlacement*>(pair.first->getPropertyByName("Placement"))) {
+            continue;
+        }
+        simulationObjects.push_back(pair.first);
+        parts.push_back(pair.second);
+    }
+    simulationFrames.resize(simulationFrameCount * parts.size() * FrameValueCount);
+
+    // Moving the solver model from frame to frame is slow for long simulations, so the placements
+    // of the frames are copied in the background and can be played back as soon as recorded.
+    auto record = [this, assembly = mbdAssembly, parts = std::move(parts)]() {
+        try {
+            for (size_t i = 0; i < simulationFrameCount; ++i) {
+                assembly->updateForFrame(i);
+
+                double* values = &simulationFrames[i * parts.size() * FrameValueCount];
+                for (auto& data : parts) {
+                    Base::Placement plc = getMbdPlacement(data.part);
+                    if (!data.offsetPlc.isIdentity()) {
+                        plc = plc * data.offsetPlc;
+                    }
+                    const Base::Vector3d& pos = plc.getPosition();
+                    values[0] = pos.x;
+                    values[1] = pos.y;
+                    values[2] = pos.z;
+                    plc.getRotation().getValue(values[3], values[4], values[5], values[6]);
+                    values += FrameValueCount;
+                }
+                recordedFrames.store(i + 1, std::memory_order_release);
+            }
+        }
+        catch (const std::exception& e) {
+            FC_ERR("Recording of simulation frames failed: " << e.what());
+        }
+        catch (...) {
+            FC_ERR("Recording of simulation frames failed");
+        }
+    };
+    simulationRecorder = std::async(std::launch::async, std::move(record));
+}
+
+void AssemblyObject::waitForSimulationFrames()
+{
+    if (simulationRecorder.valid()) {
+        simulationRecorder.wait();
+    }
+}
+
+void AssemblyObject::exportSimulationFrames(const std::string& fileName)
+{
+    waitForSimulationFrames();
+
+    size_t frameCount = recordedFrames.load();
+    if (frameCount == 0) {
+        throw Base::RuntimeError("No simulation frames to export");
+    }
+
+    Base::FileInfo fi(fileName);
+    Base::ofstream file(fi, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!file) {
+        throw Base::FileException("Cannot open file", fi);
+    }
+
+    // Header, the names of the objects and then for each frame and each object its position and
+    // rotation quaternion, all little endian.
+    Base::OutputStream str(file);
+    str.setByteOrder(Base::Stream::LittleEndian);
+    file.write("FCSIMFRM", 8);
+    str << uint32_t(1) << uint64_t(frameCount) << uint32_t(simulationObjects.size())
+        << simulationStart << simulationStep;
+    for (auto* obj : simulationObjects) {
+        std::string name = obj->getFullName();
+        str << uint32_t(name.size());
+        file.write(name.c_str(), std::streamsize(name.size()));
+    }
+    size_t valueCount = frameCount * simulationObjects.size() * FrameValueCount;
+    for (size_t i = 0; i < valueCount; ++i) {
+        str << simulationFrames[i];
+    }
+}
+
 std::vector<App::DocumentObject*> AssemblyObject::getMotionsFromSimulation(App::DocumentObject* sim)
 {
     if (!sim) {
@@ -229,31 +450,51 @@ std::vector<App::DocumentObject*> AssemblyObject::getMotionsFromSimulation(App::
 
 int Assembly::AssemblyObject::updateForFrame(size_t index, bool updateJCS)
 {
-    if (!mbdAssembly) {
+    if (index >= simulationFrameCount) {
         return -1;
     }
 
-    auto nfrms = mbdAssembly->numberOfFrames();
-    if (index >= nfrms) {
-        return -1;
+    if (recordedFrames.load(std::memory_order_acquire) <= index) {
+        waitForSimulationFrames();
+        if (recordedFrames.load() <= index) {
+            return -1;
+        }
+    }
+
+    // Play back the recorded placements, no need to go through the solver model.
+    const double* values = &simulationFrames[index * simulationObjects.size() * FrameValueCount];
+    for (auto* obj : simulationObjects) {
+        auto* propPlacement =
+            static_cast<App::PropertyPlacement*>(obj->getPropertyByName("Placement"));
+        Base::Placement newPlacement(Base::Vector3d(values[0], values[1], values[2]),
+                                     Base::Rotation(values[3], values[4], values[5], values[6]));
+        if (!propPlacement->getValue().isSame(newPlacement)) {
+            propPlacement->setValue(newPlacement);
+            obj->purgeTouched();
+        }
+        values += FrameValueCount;
     }
 
-    mbdAssembly->updateForFrame(index);
-    setNewPlacements();
     auto jointDocs = getJoints(updateJCS);
-    redrawJointPlacements(jointDocs);
+    for (auto* joint : jointDocs) {
+        if (joint->Visibility.getValue()) {
+            // Hidden joints are not redrawn as its quite slow as its python code.
+            redrawJointPlacement(joint);
+        }
+    }
     return 0;
 }
 
 size_t Assembly::AssemblyObject::numberOfFrames()
 {
-    return mbdAssembly->numberOfFrames();
+    return simulationFrameCount;
 }
 
 void AssemblyObject::preDrag(std::vector<App::DocumentObject*> dragParts)
 {
     bundleFixed = true;
-    solve();
+    // The dragged parts are moved through a single solver model.
+    solveMbd(false, true, false);
     bundleFixed = false;
 
     draggedParts.clear();
@@ -282,6 +523,16 @@ void AssemblyObject::preDrag(std::vector<App::DocumentObject*> dragParts)
         draggedParts.push_back(part);
     }
 
+    ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Assembly");
+    checkDragInterferences = hGrp->GetBool("CheckInterference", false);
+    dragInterferences.clear();
+    if (checkDragInterferences) {
+        updateInterferenceChecker();
+        // Only report the parts that start to interfere during the drag.
+        dragInterferences = findInterferences(false);
+    }
+
     mbdAssembly->runPreDrag();
 }
 
@@ -298,21 +549,7 @@ void AssemblyObject::doDragStep()
             auto mbdPart = getMbDPart(part);
             dragMbdParts.push_back(mbdPart);
 
-            // Update the MBD part's position
-            Base::Placement plc = getPlacementFromProp(part, "Placement");
-            Base::Vector3d pos = plc.getPosition();
-            mbdPart->updateMbDFromPosition3D(
-                std::make_shared<FullColumn<double>>(ListD {pos.x, pos.y, pos.z}));
-
-            // Update the MBD part's rotation
-            Base::Rotation rot = plc.getRotation();
-            Base::Matrix4D mat;
-            rot.getValue(mat);
-            Base::Vector3d r0 = mat.getRow(0);
-            Base::Vector3d r1 = mat.getRow(1);
-            Base::Vector3d r2 = mat.getRow(2);
-            mbdPart
-                ->updateMbDFromRotationMatrix(r0.x, r0.y, r0.z, r1.x, r1.y, r1.z, r2.x, r2.y, r2.z);
+            updateMbdPartPlacement(mbdPart, getPlacementFromProp(part, "Placement"));
         }
 
         // Timing mbdAssembly->runDragStep()
@@ -330,6 +567,21 @@ void AssemblyObject::doDragStep()
                     redrawJointPlacement(joint);
                 }
             }
+
+            if (checkDragInterferences) {
+                auto interferences = findInterferences(false);
+                for (auto& pair : interferences) {
+                    if (!std::binary_search(dragInterferences.begin(),
+                                            dragInterferences.end(),
+                                            pair)) {
+                        Base::Console().Warning(
+                            "%s interferes with %s\n",
+                            interferenceObjects[pair.first]->Label.getValue(),
+                            interferenceObjects[pair.second]->Label.getValue());
+                    }
+                }
+                dragInterferences.swap(interferences);
+            }
         }
     }
     catch (...) {
@@ -356,28 +608,43 @@ Base::Placement AssemblyObject::getMbdPlacement(std::shared_ptr<ASMTPart> mbdPar
 
 bool AssemblyObject::validateNewPlacements()
 {
+    // The grounded parts are in every solver model, each of them can have moved them.
+    std::vector<const std::unordered_map<App::DocumentObject*, MbDPartData>*> partMaps;
+    if (componentPartMaps.size() == mbdComponents.size()) {
+        for (auto& partMap : componentPartMaps) {
+            partMaps.push_back(&partMap);
+        }
+    }
+    else {
+        partMaps.push_back(&objectPartMap);
+    }
+
     // First we check if a grounded object has moved. It can happen that they flip.
     auto groundedParts = getGroundedParts();
     for (auto* obj : groundedParts) {
         auto* propPlacement =
             dynamic_cast<App::PropertyPlacement*>(obj->getPropertyByName("Placement"));
-        if (propPlacement) {
-            Base::Placement oldPlc = propPlacement->getValue();
-
-            auto it = objectPartMap.find(obj);
-            if (it != objectPartMap.end()) {
-                std::shared_ptr<MbD::ASMTPart> mbdPart = it->second.part;
-                Base::Placement newPlacement = getMbdPlacement(mbdPart);
-                if (!it->second.offsetPlc.isIdentity()) {
-                    newPlacement = newPlacement * it->second.offsetPlc;
-                }
+        if (!propPlacement) {
+            continue;
+        }
+        Base::Placement oldPlc = propPlacement->getValue();
 
-                if (!oldPlc.isSame(newPlacement)) {
-                    Base::Console().Warning(
-                        "Assembly : Ignoring bad solve, a grounded object (%s) moved.\n",
-                        obj->getFullLabel());
-                    return false;
-                }
+        for (auto* partMap : partMaps) {
+            auto it = partMap->find(obj);
+            if (it == partMap->end()) {
+                continue;
+            }
+            std::shared_ptr<MbD::ASMTPart> mbdPart = it->second.part;
+            Base::Placement newPlacement = getMbdPlacement(mbdPart);
+            if (!it->second.offsetPlc.isIdentity()) {
+                newPlacement = newPlacement * it->second.offsetPlc;
+            }
+
+            if (!oldPlc.isSame(newPlacement)) {
+                Base::Console().Warning(
+                    "Assembly : Ignoring bad solve, a grounded object (%s) moved.\n",
+                    obj->getFullLabel());
+                return false;
             }
         }
     }
@@ -391,6 +658,95 @@ bool AssemblyObject::validateNewPlacements()
 void AssemblyObject::postDrag()
 {
     mbdAssembly->runPostDrag();  // Do this after last drag
+
+    checkDragInterferences = false;
+    dragInterferences.clear();
+}
+
+std::vector<std::pair<App::DocumentObject*, App::DocumentObject*>>
+AssemblyObject::checkInterferences(bool exact)
+{
+    updateInterferenceChecker();
+
+    std::vector<std::pair<App::DocumentObject*, App::DocumentObject*>> result;
+    for (auto& pair : findInterferences(exact)) {
+        result.emplace_back(interferenceObjects[pair.first], interferenceObjects[pair.second]);
+    }
+    return result;
+}
+
+void AssemblyObject::updateInterferenceChecker()
+{
+    std::vector<App::DocumentObject*> objs;
+    std::vector<std::vector<App::DocumentObject*>> paths;
+    std::vector<PartApp::TopoShape> shapes;
+    std::vector<App::DocumentObject*> path;
+    std::function<void(const std::vector<App::DocumentObject*>&)> collect;
+    collect = [&](const std::vector<App::DocumentObject*>& group) {
+        for (auto* obj : group) {
+            if (obj->isDerivedFrom<App::LocalCoordinateSystem>()
+                || obj->isDerivedFrom<App::DatumElement>()
+                || !dynamic_cast<App::PropertyPlacement*>(obj->getPropertyByName("Placement"))) {
+                continue;
+            }
+
+            // The parts of a sub-assembly are checked one by one, against each other too.
+            if (auto* subAssembly = dynamic_cast<AssemblyLink*>(obj)) {
+                path.push_back(subAssembly);
+                collect(subAssembly->Group.getValues());
+                path.pop_back();
+                continue;
+            }
+
+            // Without the placement of the object, it is given to each check.
+            PartApp::TopoShape shape = PartApp::Feature::getTopoShape(obj,
+                                                                      nullptr,
+                                                                      false,
+                                                                      nullptr,
+                                                                      nullptr,
+                                                                      true,
+                                                                      false);
+            if (shape.isNull()) {
+                continue;
+            }
+            objs.push_back(obj);
+            paths.push_back(path);
+            shapes.push_back(shape);
+        }
+    };
+    collect(Group.getValues());
+
+    bool changed = objs != interferenceObjects || paths != interferencePaths;
+    for (size_t i = 0; !changed && i < shapes.size(); ++i) {
+        changed = !shapes[i].getShape().IsPartner(interferenceShapes[i].getShape());
+    }
+    if (!changed) {
+        return;
+    }
+
+    FC_TIME_INIT(t);
+    interferenceChecker.clear();
+    for (auto& shape : shapes) {
+        interferenceChecker.addPart(shape);
+    }
+    interferenceObjects = std::move(objs);
+    interferencePaths = std::move(paths);
+    interferenceShapes = std::move(shapes);
+    FC_TIME_LOG(t, "Interference checker (" << interferenceObjects.size() << " parts)");
+}
+
+std::vector<std::pair<int, int>> AssemblyObject::findInterferences(bool exact)
+{
+    std::vector<Base::Placement> placements;
+    placements.reserve(interferenceObjects.size());
+    for (size_t i = 0; i < interferenceObjects.size(); ++i) {
+        Base::Placement plc;
+        for (auto* subAssembly : interferencePaths[i]) {
+            plc = plc * getPlacementFromProp(subAssembly, "Placement");
+        }
+        placements.push_back(plc * getPlacementFromProp(interferenceObjects[i], "Placement"));
+    }
+    return interferenceChecker.findInterferences(placements, exact);
 }
 
 void AssemblyObject::savePlacementsForUndo()
@@ -449,10 +805,19 @@ void AssemblyObject::clearUndo()
     previousPositions.clear();
 }
 
+void AssemblyObject::resetSolverModel()
+{
+    mbdModelKey.clear();
+}
+
 void AssemblyObject::exportAsASMT(std::string fileName)
 {
     mbdAssembly = makeMbdAssembly();
     objectPartMap.clear();
+    mbdItems.clear();
+    mbdComponents = {mbdAssembly};
+    componentPartMaps.clear();
+    mbdModelKey.clear();
     fixGroundedParts();
 
     std::vector<App::DocumentObject*> joints = getJoints();
@@ -554,6 +919,9 @@ void AssemblyObject::recomputeJointPlacements(std::vector<App::DocumentObject*>
 
 std::shared_ptr<ASMTAssembly> AssemblyObject::makeMbdAssembly()
 {
+    // The simulation frames are recorded from the previous model.
+    waitForSimulationFrames();
+
     auto assembly = CREATE<ASMTAssembly>::With();
     assembly->externalSystem->freecadAssemblyObject = this;
     assembly->setName("OndselAssembly");
@@ -565,6 +933,20 @@ std::shared_ptr<ASMTAssembly> AssemblyObject::makeMbdAssembly()
     return assembly;
 }
 
+template<typename T>
+std::shared_ptr<T> AssemblyObject::findMbdItem(const std::string& name) const
+{
+    auto it = mbdItems.find(name);
+    std::shared_ptr<T> item;
+    if (it != mbdItems.end()) {
+        item = std::dynamic_pointer_cast<T>(it->second);
+    }
+    if (!item) {
+        throw Base::RuntimeError("Solver model has no " + name);
+    }
+    return item;
+}
+
 App::DocumentObject* AssemblyObject::getJointOfPartConnectingToGround(App::DocumentObject* part,
                                                                       std::string& name)
 {
@@ -825,12 +1207,20 @@ void AssemblyObject::fixGroundedPart(App::DocumentObject* obj,
         return;
     }
 
+    std::shared_ptr<ASMTPart> mbdPart = getMbDPart(obj);
+    if (mbdPart->name != obj->getFullName()) {
+        // Bundled by a fixed joint with a grounded object that was fixed before.
+        return;
+    }
+
     std::string markerName1 = "marker-" + obj->getFullName();
+    if (updatingMbdModel) {
+        setMbdMarkerPlacement(findMbdItem<ASMTMarker>("/OndselAssembly/" + markerName1), plc);
+        return;
+    }
     auto mbdMarker1 = makeMbdMarker(markerName1, plc);
     mbdAssembly->addMarker(mbdMarker1);
 
-    std::shared_ptr<ASMTPart> mbdPart = getMbDPart(obj);
-
     std::string markerName2 = "FixingMarker";
     Base::Placement basePlc = Base::Placement();
     auto mbdMarker2 = makeMbdMarker(markerName2, basePlc);
@@ -838,6 +1228,7 @@ void AssemblyObject::fixGroundedPart(App::DocumentObject* obj,
 
     markerName1 = "/OndselAssembly/" + mbdMarker1->name;
     markerName2 = "/OndselAssembly/" + mbdPart->name + "/" + mbdMarker2->name;
+    mbdItems[markerName1] = mbdMarker1;
 
     auto mbdJoint = CREATE<ASMTFixedJoint>::With();
     mbdJoint->setName(name);
@@ -1067,7 +1458,12 @@ void AssemblyObject::jointParts(std::vector<App::DocumentObject*> joints)
 
         std::vector<std::shared_ptr<MbD::ASMTJoint>> mbdJoints = makeMbdJoint(joint);
         for (auto& mbdJoint : mbdJoints) {
+            if (updatingMbdModel) {
+                updateMbdJoint(*findMbdItem<ASMTJoint>(mbdJoint->name), *mbdJoint);
+                continue;
+            }
             mbdAssembly->addJoint(mbdJoint);
+            mbdItems[mbdJoint->name] = mbdJoint;
         }
     }
 }
@@ -1390,6 +1786,27 @@ AssemblyObject::makeMbdJoint(App::DocumentObject* joint)
     mbdJoint->setMarkerI(fullMarkerNameI);
     mbdJoint->setMarkerJ(fullMarkerNameJ);
 
+    // When updating the solver model only the limit value can have changed, the enabled limits
+    // are part of the model key.
+    auto addLimit = [&](auto limit,
+                        const char* suffix,
+                        const char* type,
+                        const std::string& value) {
+        std::string name = joint->getFullName() + suffix;
+        if (updatingMbdModel) {
+            findMbdItem<typename decltype(limit)::element_type>(name)->setlimit(value);
+            return;
+        }
+        limit->setName(name);
+        limit->setMarkerI(fullMarkerNameI);
+        limit->setMarkerJ(fullMarkerNameJ);
+        limit->settype(type);
+        limit->setlimit(value);
+        limit->settol("1.0e-9");
+        mbdAssembly->addLimit(limit);
+        mbdItems[name] = limit;
+    };
+
     // Add limits if needed.
     if (jointType == JointType::Slider || jointType == JointType::Cylindrical) {
         auto* pLenMin = dynamic_cast<App::PropertyFloat*>(joint->getPropertyByName("LengthMin"));
@@ -1419,25 +1836,17 @@ AssemblyObject::makeMbdJoint(App::DocumentObject* joint)
             }
 
             if (minEnabled) {
-                auto limit = ASMTTranslationLimit::With();
-                limit->setName(joint->getFullName() + "-LimitLenMin");
-                limit->setMarkerI(fullMarkerNameI);
-                limit->setMarkerJ(fullMarkerNameJ);
-                limit->settype("=>");
-                limit->setlimit(std::to_string(minLength));
-                limit->settol("1.0e-9");
-                mbdAssembly->addLimit(limit);
+                addLimit(ASMTTranslationLimit::With(),
+                         "-LimitLenMin",
+                         "=>",
+                         std::to_string(minLength));
             }
 
             if (maxEnabled) {
-                auto limit2 = ASMTTranslationLimit::With();
-                limit2->setName(joint->getFullName() + "-LimitLenMax");
-                limit2->setMarkerI(fullMarkerNameI);
-                limit2->setMarkerJ(fullMarkerNameJ);
-                limit2->settype("=<");
-                limit2->setlimit(std::to_string(maxLength));
-                limit2->settol("1.0e-9");
-                mbdAssembly->addLimit(limit2);
+                addLimit(ASMTTranslationLimit::With(),
+                         "-LimitLenMax",
+                         "=<",
+                         std::to_string(maxLength));
             }
         }
     }
@@ -1468,25 +1877,17 @@ AssemblyObject::makeMbdJoint(App::DocumentObject* joint)
             }
 
             if (minEnabled) {
-                auto limit = ASMTRotationLimit::With();
-                limit->setName(joint->getFullName() + "-LimitRotMin");
-                limit->setMarkerI(fullMarkerNameI);
-                limit->setMarkerJ(fullMarkerNameJ);
-                limit->settype("=>");
-                limit->setlimit(std::to_string(minAngle) + "*pi/180.0");
-                limit->settol("1.0e-9");
-                mbdAssembly->addLimit(limit);
+                addLimit(ASMTRotationLimit::With(),
+                         "-LimitRotMin",
+                         "=>",
+                         std::to_string(minAngle) + "*pi/180.0");
             }
 
             if (maxEnabled) {
-                auto limit2 = ASMTRotationLimit::With();
-                limit2->setName(joint->getFullName() + "-LimitRotMax");
-                limit2->setMarkerI(fullMarkerNameI);
-                limit2->setMarkerJ(fullMarkerNameJ);
-                limit2->settype("=<");
-                limit2->setlimit(std::to_string(maxAngle) + "*pi/180.0");
-                limit2->settol("1.0e-9");
-                mbdAssembly->addLimit(limit2);
+                addLimit(ASMTRotationLimit::With(),
+                         "-LimitRotMax",
+                         "=<",
+                         std::to_string(maxAngle) + "*pi/180.0");
             }
         }
     }
@@ -1594,15 +1995,30 @@ std::string AssemblyObject::handleOneSideOfJoint(App::DocumentObject* joint,
 
     MbDPartData data = getMbDData(part);
     std::shared_ptr<ASMTPart> mbdPart = data.part;
+    Base::Placement plc = getJcsPlacementInPart(joint, propRefName, propPlcName);
+    // check if we need to add an offset in case of bundled parts.
+    if (!data.offsetPlc.isIdentity()) {
+        plc = data.offsetPlc * plc;
+    }
+
+    return addMbdMarker(joint, mbdPart, plc);
+}
+
+Base::Placement AssemblyObject::getJcsPlacementInPart(App::DocumentObject* joint,
+                                                      const char* propRefName,
+                                                      const char* propPlcName)
+{
+    App::DocumentObject* part = getMovingPartFromRef(this, joint, propRefName);
+    App::DocumentObject* obj = getObjFromRef(joint, propRefName);
     Base::Placement plc = getPlacementFromProp(joint, propPlcName);
     // Now we have plc which is the JCS placement, but its relative to the Object, not to the
     // containing Part.
 
-    if (obj->getNameInDocument() != part->getNameInDocument()) {
+    if (part && obj && obj->getNameInDocument() != part->getNameInDocument()) {
 
         auto* ref = dynamic_cast<App::PropertyXLinkSub*>(joint->getPropertyByName(propRefName));
         if (!ref) {
-            return "";
+            return plc;
         }
 
         Base::Placement obj_global_plc = getGlobalPlacement(obj, ref);
@@ -1611,16 +2027,7 @@ std::string AssemblyObject::handleOneSideOfJoint(App::DocumentObject* joint,
         Base::Placement part_global_plc = getGlobalPlacement(part, ref);
         plc = part_global_plc.inverse() * plc;
     }
-    // check if we need to add an offset in case of bundled parts.
-    if (!data.offsetPlc.isIdentity()) {
-        plc = data.offsetPlc * plc;
-    }
-
-    std::string markerName = joint->getFullName();
-    auto mbdMarker = makeMbdMarker(markerName, plc);
-    mbdPart->addMarker(mbdMarker);
-
-    return "/OndselAssembly/" + mbdPart->name + "/" + markerName;
+    return plc;
 }
 
 void AssemblyObject::getRackPinionMarkers(App::DocumentObject* joint,
@@ -1707,11 +2114,7 @@ void AssemblyObject::getRackPinionMarkers(App::DocumentObject* joint,
         plc1 = data1.offsetPlc * plc1;
     }
 
-    std::string markerName = joint->getFullName();
-    auto mbdMarker = makeMbdMarker(markerName, plc1);
-    mbdPart->addMarker(mbdMarker);
-
-    markerNameI = "/OndselAssembly/" + mbdPart->name + "/" + markerName;
+    markerNameI = addMbdMarker(joint, mbdPart, plc1);
 }
 
 int AssemblyObject::slidingPartIndex(App::DocumentObject* joint)
@@ -1769,6 +2172,9 @@ AssemblyObject::MbDPartData AssemblyObject::getMbDData(App::DocumentObject* part
     }
 
     // part has not been associated with an ASMTPart before
+    if (updatingMbdModel) {
+        throw Base::RuntimeError("Solver model has no part " + part->getFullName());
+    }
     std::string str = part->getFullName();
     Base::Placement plc = getPlacementFromProp(part, "Placement");
     std::shared_ptr<ASMTPart> mbdPart = makeMbdPart(str, plc);
@@ -1785,15 +2191,27 @@ AssemblyObject::MbDPartData AssemblyObject::getMbDData(App::DocumentObject* part
                 if (jointType == JointType::Fixed) {
                     App::DocumentObject* part1 = getMovingPartFromRef(this, joint, "Reference1");
                     App::DocumentObject* part2 = getMovingPartFromRef(this, joint, "Reference2");
-                    App::DocumentObject* partToAdd = currentPart == part1 ? part2 : part1;
+                    bool isFirst = currentPart == part1;
+                    App::DocumentObject* partToAdd = isFirst ? part2 : part1;
 
-                    if (objectPartMap.find(partToAdd) != objectPartMap.end()) {
+                    if (!partToAdd || objectPartMap.find(partToAdd) != objectPartMap.end()) {
                         // already added
                         continue;
                     }
 
-                    Base::Placement plci = getPlacementFromProp(partToAdd, "Placement");
-                    MbDPartData partData = {mbdPart, plc.inverse() * plci};
+                    // The fixed joint gives where partToAdd is relative to currentPart, even if
+                    // it was not solved yet.
+                    Base::Placement jcsCurrent =
+                        getJcsPlacementInPart(joint,
+                                              isFirst ? "Reference1" : "Reference2",
+                                              isFirst ? "Placement1" : "Placement2");
+                    Base::Placement jcsToAdd =
+                        getJcsPlacementInPart(joint,
+                                              isFirst ? "Reference2" : "Reference1",
+                                              isFirst ? "Placement2" : "Placement1");
+                    Base::Placement offsetPlc =
+                        objectPartMap[currentPart].offsetPlc * jcsCurrent * jcsToAdd.inverse();
+                    MbDPartData partData = {mbdPart, offsetPlc};
                     objectPartMap[partToAdd] = partData;  // Store the association
 
                     // Recursively call for partToAdd
@@ -1817,6 +2235,251 @@ std::shared_ptr<ASMTPart> AssemblyObject::getMbDPart(App::DocumentObject* part)
     return getMbDData(part).part;
 }
 
+void AssemblyObject::updateMbdPartPlacement(std::shared_ptr<ASMTPart> mbdPart,
+                                            const Base::Placement& plc)
+{
+    // Update the MBD part's position
+    Base::Vector3d pos = plc.getPosition();
+    mbdPart->updateMbDFromPosition3D(
+        std::make_shared<FullColumn<double>>(ListD {pos.x, pos.y, pos.z}));
+
+    // Update the MBD part's rotation
+    Base::Rotation rot = plc.getRotation();
+    Base::Matrix4D mat;
+    rot.getValue(mat);
+    Base::Vector3d r0 = mat.getRow(0);
+    Base::Vector3d r1 = mat.getRow(1);
+    Base::Vector3d r2 = mat.getRow(2);
+    mbdPart->updateMbDFromRotationMatrix(r0.x, r0.y, r0.z, r1.x, r1.y, r1.z, r2.x, r2.y, r2.z);
+}
+
+std::vector<std::vector<App::DocumentObject*>> AssemblyObject::getIndependentJointSets(
+    const std::vector<App::DocumentObject*>& joints,
+    const std::unordered_set<App::DocumentObject*>& groundedObjs)
+{
+    std::vector<std::pair<App::DocumentObject*, App::DocumentObject*>> jointEnds;
+    jointEnds.reserve(joints.size());
+    for (auto* joint : joints) {
+        jointEnds.emplace_back(getMovingPartFromRef(this, joint, "Reference1"),
+                               getMovingPartFromRef(this, joint, "Reference2"));
+    }
+
+    // The parts that cannot move: the grounded ones and, when bundling, the ones fixed to them.
+    // They do not tie the parts joined to them together.
+    std::unordered_set<App::DocumentObject*> fixedParts = groundedObjs;
+    if (bundleFixed) {
+        std::vector<App::DocumentObject*> stack(groundedObjs.begin(), groundedObjs.end());
+        while (!stack.empty()) {
+            App::DocumentObject* part = stack.back();
+            stack.pop_back();
+            for (size_t i = 0; i < joints.size(); ++i) {
+                auto [part1, part2] = jointEnds[i];
+                App::DocumentObject* other =
+                    part == part1 ? part2 : (part == part2 ? part1 : nullptr);
+                if (other && getJointType(joints[i]) == JointType::Fixed
+                    && fixedParts.insert(other).second) {
+                    stack.push_back(other);
+                }
+            }
+        }
+    }
+    auto isMoving = [&fixedParts](App::DocumentObject* part) {
+        return part && fixedParts.find(part) == fixedParts.end();
+    };
+
+    // Union-find of the moving parts through the joints.
+    std::unordered_map<App::DocumentObject*, App::DocumentObject*> parents;
+    auto findRoot = [&parents](App::DocumentObject* part) {
+        while (parents[part] != part) {
+            parents[part] = parents[parents[part]];
+            part = parents[part];
+        }
+        return part;
+    };
+    for (auto [part1, part2] : jointEnds) {
+        if (isMoving(part1)) {
+            parents.emplace(part1, part1);
+        }
+        if (isMoving(part2)) {
+            parents.emplace(part2, part2);
+        }
+        if (isMoving(part1) && isMoving(part2)) {
+            parents[findRoot(part1)] = findRoot(part2);
+        }
+    }
+
+    std::vector<std::vector<App::DocumentObject*>> jointSets;
+    std::vector<App::DocumentObject*> fixedJoints;
+    std::unordered_map<App::DocumentObject*, size_t> setIndices;
+    for (size_t i = 0; i < joints.size(); ++i) {
+        auto [part1, part2] = jointEnds[i];
+        App::DocumentObject* part = isMoving(part1) ? part1 : (isMoving(part2) ? part2 : nullptr);
+        if (!part) {
+            // Nothing to solve for this joint, keep it with the first set.
+            fixedJoints.push_back(joints[i]);
+            continue;
+        }
+        auto res = setIndices.emplace(findRoot(part), jointSets.size());
+        if (res.second) {
+            jointSets.emplace_back();
+        }
+        jointSets[res.first->second].push_back(joints[i]);
+    }
+
+    if (jointSets.empty()) {
+        jointSets.emplace_back();
+    }
+    jointSets.front().insert(jointSets.front().end(), fixedJoints.begin(), fixedJoints.end());
+
+    return jointSets;
+}
+
+std::string
+AssemblyObject::getMbdModelKey(const std::vector<App::DocumentObject*>& joints,
+                               const std::unordered_set<App::DocumentObject*>& groundedObjs,
+                               bool splitComponents)
+{
+    // Only what decides which items the solver model has and how they are connected, the values
+    // of the items are updated by updateMbdModel().
+    std::ostringstream key;
+    key << bundleFixed << splitComponents << '|';
+
+    std::vector<App::DocumentObject*> grounded(groundedObjs.begin(), groundedObjs.end());
+    std::sort(grounded.begin(), grounded.end());
+    for (auto* obj : grounded) {
+        if (obj) {
+            key << obj->getFullName() << ';';
+        }
+    }
+    key << '|';
+
+    for (auto* joint : joints) {
+        if (!joint) {
+            continue;
+        }
+        JointType type = getJointType(joint);
+        key << joint->getFullName() << '{' << static_cast<int>(type) << ';';
+        if (type == JointType::Distance) {
+            key << static_cast<int>(getDistanceType(joint)) << ';';
+        }
+
+        for (const char* propName : {"Reference1", "Reference2"}) {
+            App::DocumentObject* part = getMovingPartFromRef(this, joint, propName);
+            key << (part ? part->getFullName() : std::string()) << ';';
+        }
+
+        for (const char* propName :
+             {"EnableLengthMin", "EnableLengthMax", "EnableAngleMin", "EnableAngleMax"}) {
+            if (auto* prop = dynamic_cast<App::PropertyBool*>(joint->getPropertyByName(propName))) {
+                key << prop->getValue();
+            }
+        }
+
+        // The parts bundled by fixed joints are placed relative to each other when building the
+        // model.
+        if (bundleFixed && type == JointType::Fixed) {
+            key.precision(std::numeric_limits<double>::max_digits10);
+            for (auto [refName, plcName] :
+                 {std::pair("Reference1", "Placement1"), std::pair("Reference2", "Placement2")}) {
+                Base::Placement plc = getJcsPlacementInPart(joint, refName, plcName);
+                const Base::Vector3d& pos = plc.getPosition();
+                double q0, q1, q2, q3;
+                plc.getRotation().getValue(q0, q1, q2, q3);
+                key << ';' << pos.x << ',' << pos.y << ',' << pos.z << ',' << q0 << ',' << q1
+                    << ',' << q2 << ',' << q3;
+            }
+        }
+        key << '}';
+    }
+
+    return key.str();
+}
+
+bool AssemblyObject::updateMbdModel()
+{
+    if (!mbdAssembly || objectPartMap.empty() || componentPartMaps.size() != mbdComponents.size()
+        || componentItems.size() != mbdComponents.size()
+        || componentJoints.size() != mbdComponents.size()) {
+        return false;
+    }
+
+    // Only the objects the ASMTParts were made from, the ones bundled with them follow from the
+    // fixed joints. The parts that cannot move have an ASMTPart in every solver model.
+    for (auto& partMap : componentPartMaps) {
+        for (auto& pair : partMap) {
+            App::DocumentObject* obj = pair.first;
+            std::shared_ptr<ASMTPart> mbdPart = pair.second.part;
+            if (!obj || !obj->isAttachedToDocument() || !mbdPart) {
+                return false;
+            }
+            if (mbdPart->name == obj->getFullName()) {
+                updateMbdPartPlacement(mbdPart, getPlacementFromProp(obj, "Placement"));
+            }
+        }
+    }
+
+    // Going through the same steps as when building the model gives the markers, joints and
+    // limits their current values.
+    std::unordered_map<App::DocumentObject*, MbDPartData> partMap;
+    partMap.swap(objectPartMap);
+    bool updated = true;
+    {
+        Base::StateLocker lock(updatingMbdModel);
+        try {
+            for (size_t i = 0; i < mbdComponents.size(); ++i) {
+                mbdAssembly = mbdComponents[i];
+                objectPartMap = componentPartMaps[i];
+                mbdItems = componentItems[i];
+
+                fixGroundedParts();
+                jointParts(componentJoints[i]);
+            }
+        }
+        catch (const Base::Exception& e) {
+            FC_LOG("Rebuild solver model: " << e.what());
+            updated = false;
+        }
+    }
+    objectPartMap.swap(partMap);
+    mbdAssembly = mbdComponents.front();
+    mbdItems.clear();
+
+    return updated;
+}
+
+namespace
+{
+template<typename Joint, typename Value>
+void copyMbdJointValue(ASMTJoint& mbdJoint, const ASMTJoint& values, Value Joint::*member)
+{
+    if (auto* joint = dynamic_cast<Joint*>(&mbdJoint)) {
+        joint->*member = dynamic_cast<const Joint&>(values).*member;
+    }
+}
+}  // namespace
+
+void AssemblyObject::updateMbdJoint(ASMTJoint& mbdJoint, const ASMTJoint& values)
+{
+    // The type of some joints depends on their values, e.g. an angle joint of 0 degrees is made
+    // of parallel axes.
+    if (typeid(mbdJoint) != typeid(values)) {
+        throw Base::RuntimeError("Joint type of " + mbdJoint.name + " changed");
+    }
+
+    // The values set by makeMbdJointOfType().
+    copyMbdJointValue(mbdJoint, values, &ASMTAngleJoint::theIzJz);
+    copyMbdJointValue(mbdJoint, values, &ASMTRackPinionJoint::pitchRadius);
+    copyMbdJointValue(mbdJoint, values, &ASMTScrewJoint::pitch);
+    copyMbdJointValue(mbdJoint, values, &ASMTGearJoint::radiusI);
+    copyMbdJointValue(mbdJoint, values, &ASMTGearJoint::radiusJ);
+    copyMbdJointValue(mbdJoint, values, &ASMTSphSphJoint::distanceIJ);
+    copyMbdJointValue(mbdJoint, values, &ASMTRevCylJoint::distanceIJ);
+    copyMbdJointValue(mbdJoint, values, &ASMTCylSphJoint::distanceIJ);
+    copyMbdJointValue(mbdJoint, values, &ASMTPlanarJoint::offset);
+    copyMbdJointValue(mbdJoint, values, &ASMTLineInPlaneJoint::offset);
+    copyMbdJointValue(mbdJoint, values, &ASMTPointInPlaneJoint::offset);
+}
+
 std::shared_ptr<ASMTPart>
 AssemblyObject::makeMbdPart(std::string& name, Base::Placement plc, double mass)
 {
@@ -1849,7 +2512,14 @@ std::shared_ptr<ASMTMarker> AssemblyObject::makeMbdMarker(std::string& name, Bas
 {
     auto mbdMarker = CREATE<ASMTMarker>::With();
     mbdMarker->setName(name);
+    setMbdMarkerPlacement(mbdMarker, plc);
+
+    return mbdMarker;
+}
 
+void AssemblyObject::setMbdMarkerPlacement(std::shared_ptr<ASMTMarker> mbdMarker,
+                                           const Base::Placement& plc)
+{
     Base::Vector3d pos = plc.getPosition();
     mbdMarker->setPosition3D(pos.x, pos.y, pos.z);
 
@@ -1861,10 +2531,26 @@ std::shared_ptr<ASMTMarker> AssemblyObject::makeMbdMarker(std::string& name, Bas
     Base::Vector3d r1 = mat.getRow(1);
     Base::Vector3d r2 = mat.getRow(2);
     mbdMarker->setRotationMatrix(r0.x, r0.y, r0.z, r1.x, r1.y, r1.z, r2.x, r2.y, r2.z);
+}
 
-    return mbdMarker;
+std::string AssemblyObject::addMbdMarker(App::DocumentObject* joint,
+                                         std::shared_ptr<ASMTPart> mbdPart,
+                                         Base::Placement& plc)
+{
+    std::string markerName = joint->getFullName();
+    std::string fullMarkerName = "/OndselAssembly/" + mbdPart->name + "/" + markerName;
+    if (updatingMbdModel) {
+        setMbdMarkerPlacement(findMbdItem<ASMTMarker>(fullMarkerName), plc);
+    }
+    else {
+        auto mbdMarker = makeMbdMarker(markerName, plc);
+        mbdPart->addMarker(mbdMarker);
+        mbdItems[fullMarkerName] = mbdMarker;
+    }
+    return fullMarkerName;
 }
 
+
 std::vector<ObjRef> AssemblyObject::getDownstreamParts(App::DocumentObject* part,
                                                        App::DocumentObject* joint)
 {
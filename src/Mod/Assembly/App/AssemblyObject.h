@@ -26,11 +26,15 @@
 #define ASSEMBLY_AssemblyObject_H
 
 
+#include <atomic>
+#include <future>
+
 #include <Mod/Assembly/AssemblyGlobal.h>
 
 #include <App/FeaturePython.h>
 #include <App/Part.h>
 #include <App/PropertyLinks.h>
+#include "InterferenceChecker.h"
 #include "SimulationGroup.h"
 
 #include <OndselSolver/enum.h>
@@ -39,6 +43,7 @@ namespace MbD
 {
 class ASMTPart;
 class ASMTAssembly;
+class ASMTItem;
 class ASMTJoint;
 class ASMTMarker;
 class ASMTPart;
@@ -94,8 +99,10 @@ public:
     being in an active transaction (joint creation).*/
     int solve(bool enableRedo = false, bool updateJCS = true);
     int generateSimulation(App::DocumentObject* sim);
-    int updateForFrame(size_t index, bool updateJCS = true);
+    int updateForFrame(size_t index, bool updateJCS = false);
     size_t numberOfFrames();
+    // Writes the placements of all the frames of the last simulation to a binary file.
+    void exportSimulationFrames(const std::string& fileName);
     void preDrag(std::vector<App::DocumentObject*> dragParts);
     void doDragStep();
     void postDrag();
@@ -105,6 +112,15 @@ public:
 
     void exportAsASMT(std::string fileName);
 
+    /* Returns the pairs of parts that interpenetrate at their current placements. If exact is
+    false, the pairs are found from the tessellations of the parts only.*/
+    std::vector<std::pair<App::DocumentObject*, App::DocumentObject*>>
+    checkInterferences(bool exact = true);
+
+    /* The solver model is kept between solves and only the part placements are updated when the
+    joints and grounded parts did not change. This forces the next solve to rebuild it.*/
+    void resetSolverModel();
+
     Base::Placement getMbdPlacement(std::shared_ptr<MbD::ASMTPart> mbdPart);
     bool validateNewPlacements();
     void setNewPlacements();
@@ -121,6 +137,12 @@ public:
     std::shared_ptr<MbD::ASMTPart>
     makeMbdPart(std::string& name, Base::Placement plc = Base::Placement(), double mass = 1.0);
     std::shared_ptr<MbD::ASMTPart> getMbDPart(App::DocumentObject* obj);
+    // Placement of the JCS of one side of a joint relative to the part moved by the solver.
+    Base::Placement getJcsPlacementInPart(App::DocumentObject* joint,
+                                          const char* propRefName,
+                                          const char* propPlcName);
+    static void updateMbdPartPlacement(std::shared_ptr<MbD::ASMTPart> mbdPart,
+                                       const Base::Placement& plc);
     // To help the solver, during dragging, we are bundling parts connected by a fixed joint.
     // So several assembly components are bundled in a single ASMTPart.
     // So we need to store the plc of each bundled object relative to the bundle origin (first obj
@@ -132,6 +154,12 @@ public:
     };
     MbDPartData getMbDData(App::DocumentObject* obj);
     std::shared_ptr<MbD::ASMTMarker> makeMbdMarker(std::string& name, Base::Placement& plc);
+    static void setMbdMarkerPlacement(std::shared_ptr<MbD::ASMTMarker> mbdMarker,
+                                      const Base::Placement& plc);
+    // Adds the marker of the joint to the part, returns its full name.
+    std::string addMbdMarker(App::DocumentObject* joint,
+                             std::shared_ptr<MbD::ASMTPart> mbdPart,
+                             Base::Placement& plc);
     std::vector<std::shared_ptr<MbD::ASMTJoint>> makeMbdJoint(App::DocumentObject* joint);
     std::shared_ptr<MbD::ASMTJoint> makeMbdJointOfType(App::DocumentObject* joint,
                                                        JointType jointType);
@@ -190,15 +218,73 @@ public:
     std::vector<App::DocumentObject*> getMotionsFromSimulation(App::DocumentObject* sim);
 
 private:
+    int solveMbd(bool enableRedo, bool updateJCS, bool splitComponents);
+    void recordSimulationFrames();
+    void waitForSimulationFrames();
+    // Splits the joints in sets that can be solved independently of each other: the parts they
+    // move are only connected through grounded parts.
+    std::vector<std::vector<App::DocumentObject*>>
+    getIndependentJointSets(const std::vector<App::DocumentObject*>& joints,
+                            const std::unordered_set<App::DocumentObject*>& groundedObjs);
+    std::string getMbdModelKey(const std::vector<App::DocumentObject*>& joints,
+                               const std::unordered_set<App::DocumentObject*>& groundedObjs,
+                               bool splitComponents);
+    // Gives the solver models the current part placements and joint values, returns false if
+    // they must be rebuilt.
+    bool updateMbdModel();
+    static void updateMbdJoint(MbD::ASMTJoint& mbdJoint, const MbD::ASMTJoint& values);
+    template<typename T>
+    std::shared_ptr<T> findMbdItem(const std::string& name) const;
+    // Gives the shapes of the parts to interferenceChecker if they changed.
+    void updateInterferenceChecker();
+    std::vector<std::pair<int, int>> findInterferences(bool exact);
+
     std::shared_ptr<MbD::ASMTAssembly> mbdAssembly;
+    // The solver models of the independent sets of joints, mbdAssembly is the first one.
+    std::vector<std::shared_ptr<MbD::ASMTAssembly>> mbdComponents;
 
     std::unordered_map<App::DocumentObject*, MbDPartData> objectPartMap;
+    // The parts of each model of mbdComponents, the grounded ones are in all of them.
+    std::vector<std::unordered_map<App::DocumentObject*, MbDPartData>> componentPartMaps;
+    // The markers, joints and limits of mbdAssembly by their full name, and the ones of each
+    // model of mbdComponents.
+    std::unordered_map<std::string, std::shared_ptr<MbD::ASMTItem>> mbdItems;
+    std::vector<std::unordered_map<std::string, std::shared_ptr<MbD::ASMTItem>>> componentItems;
+    // The joints each model of mbdComponents was built from.
+    std::vector<std::vector<App::DocumentObject*>> componentJoints;
+    // Set while updateMbdModel() goes through the steps of building the models, the existing
+    // items get the values instead of new ones being added.
+    bool updatingMbdModel {false};
     std::vector<std::pair<App::DocumentObject*, double>> objMasses;
     std::vector<App::DocumentObject*> draggedParts;
     std::vector<App::DocumentObject*> motions;
 
     std::vector<std::pair<App::DocumentObject*, Base::Placement>> previousPositions;
 
+    // Placements of the parts moved by the last simulation, for each frame and each object of
+    // simulationObjects: its position and its rotation quaternion.
+    static constexpr size_t FrameValueCount = 7;
+    std::vector<App::DocumentObject*> simulationObjects;
+    std::vector<double> simulationFrames;
+    size_t simulationFrameCount;
+    std::atomic<size_t> recordedFrames;
+    std::future<void> simulationRecorder;
+    double simulationStart;
+    double simulationStep;
+
+    // Describes how the joints connect the parts in mbdComponents, empty if they must be rebuilt
+    // on the next solve.
+    std::string mbdModelKey;
+
+    InterferenceChecker interferenceChecker;
+    std::vector<App::DocumentObject*> interferenceObjects;
+    // The sub-assemblies each of interferenceObjects is in, the outermost first.
+    std::vector<std::vector<App::DocumentObject*>> interferencePaths;
+    std::vector<Part::TopoShape> interferenceShapes;
+    // Interferences at the last drag step, only if they are checked while dragging.
+    std::vector<std::pair<int, int>> dragInterferences;
+    bool checkDragInterferences;
+
     bool bundleFixed;
     // void handleChangedPropertyType(Base::XMLReader &reader, const char *TypeName, App::Property
     // *prop) override;
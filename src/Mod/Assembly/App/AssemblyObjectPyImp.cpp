@@ -92,13 +92,14 @@ PyObject* AssemblyObjectPy::ensureIdentityPlacements(PyObject* args)
 PyObject* AssemblyObjectPy::updateForFrame(PyObject* args)
 {
     unsigned long index {};
+    PyObject* updateJCS = Py_True;
 
-    if (!PyArg_ParseTuple(args, "k", &index)) {
+    if (!PyArg_ParseTuple(args, "k|O!", &index, &PyBool_Type, &updateJCS)) {
         throw Py::RuntimeError("updateForFrame requires an integer index");
     }
     PY_TRY
     {
-        this->getAssemblyObjectPtr()->updateForFrame(index);
+        this->getAssemblyObjectPtr()->updateForFrame(index, Base::asBoolean(updateJCS));
     }
     PY_CATCH;
 
@@ -189,6 +190,52 @@ PyObject* AssemblyObjectPy::exportAsASMT(PyObject* args)
     Py_Return;
 }
 
+PyObject* AssemblyObjectPy::exportSimulationFrames(PyObject* args)
+{
+    char* utf8Name;
+    if (!PyArg_ParseTuple(args, "et", "utf-8", &utf8Name)) {
+        return nullptr;
+    }
+
+    std::string fileName = utf8Name;
+    PyMem_Free(utf8Name);
+
+    if (fileName.empty()) {
+        PyErr_SetString(PyExc_ValueError, "Passed string is empty");
+        return nullptr;
+    }
+
+    PY_TRY
+    {
+        this->getAssemblyObjectPtr()->exportSimulationFrames(fileName);
+    }
+    PY_CATCH;
+
+    Py_Return;
+}
+
+PyObject* AssemblyObjectPy::checkInterferences(PyObject* args)
+{
+    PyObject* exact = Py_True;
+    if (!PyArg_ParseTuple(args, "|O!", &PyBool_Type, &exact)) {
+        return nullptr;
+    }
+
+    PY_TRY
+    {
+        Py::List ret;
+        auto pairs = getAssemblyObjectPtr()->checkInterferences(Base::asBoolean(exact));
+        for (auto& pair : pairs) {
+            Py::Tuple tuple(2);
+            tuple.setItem(0, Py::Object(pair.first->getPyObject(), true));
+            tuple.setItem(1, Py::Object(pair.second->getPyObject(), true));
+            ret.append(tuple);
+        }
+        return Py::new_reference_to(ret);
+    }
+    PY_CATCH;
+}
+
 Py::List AssemblyObjectPy::getJoints() const
 {
     Py::List ret;
@@ -0,0 +1,493 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2024 The FreeCAD Project Association                     *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+#ifndef _PreComp_
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+#include <BRepAlgoAPI_Common.hxx>
+#include <BRepGProp.hxx>
+#include <GProp_GProps.hxx>
+#include <TopExp_Explorer.hxx>
+#endif
+
+#include "InterferenceChecker.h"
+
+
+using namespace Assembly;
+
+namespace
+{
+
+// Triangles per leaf of the hierarchies.
+constexpr uint32_t LeafSize = 4;
+
+// The common of two parts must be larger than this fraction of the smallest one to confirm they
+// interfere.
+constexpr double VolumeRatio = 1e-6;
+
+double coordinate(const Base::Vector3d& point, int axis)
+{
+    return axis == 0 ? point.x : (axis == 1 ? point.y : point.z);
+}
+
+// True if the boxes overlap by more than tolerance along each axis.
+bool boxesOverlap(const Base::BoundBox3d& a, const Base::BoundBox3d& b, double tolerance)
+{
+    return a.MinX < b.MaxX - tolerance && b.MinX < a.MaxX - tolerance
+        && a.MinY < b.MaxY - tolerance && b.MinY < a.MaxY - tolerance
+        && a.MinZ < b.MaxZ - tolerance && b.MinZ < a.MaxZ - tolerance;
+}
+
+// Rays to find if a point is inside of a part go in this direction, which is not parallel to the
+// faces usually found in models.
+const Base::Vector3d& rayDirection()
+{
+    static const Base::Vector3d direction = Base::Vector3d(0.5773, 0.5774, 0.5775).Normalize();
+    return direction;
+}
+
+bool rayHitsBox(const Base::Vector3d& origin,
+                const Base::Vector3d& direction,
+                const Base::BoundBox3d& box)
+{
+    double tmin = 0.0;
+    double tmax = std::numeric_limits<double>::max();
+    const double mins[3] = {box.MinX, box.MinY, box.MinZ};
+    const double maxs[3] = {box.MaxX, box.MaxY, box.MaxZ};
+    for (int axis = 0; axis < 3; ++axis) {
+        double o = coordinate(origin, axis);
+        double d = coordinate(direction, axis);
+        double t1 = (mins[axis] - o) / d;
+        double t2 = (maxs[axis] - o) / d;
+        tmin = std::max(tmin, std::min(t1, t2));
+        tmax = std::min(tmax, std::max(t1, t2));
+    }
+    return tmin <= tmax;
+}
+
+// Möller-Trumbore, t is set to the distance along the ray.
+bool rayHitsTriangle(const Base::Vector3d& origin,
+                     const Base::Vector3d& direction,
+                     const Base::Vector3d& p0,
+                     const Base::Vector3d& p1,
+                     const Base::Vector3d& p2,
+                     double& t)
+{
+    Base::Vector3d edge1 = p1 - p0;
+    Base::Vector3d edge2 = p2 - p0;
+    Base::Vector3d pvec = direction % edge2;
+    double det = edge1 * pvec;
+    if (std::fabs(det) < std::numeric_limits<double>::epsilon()) {
+        return false;
+    }
+    Base::Vector3d tvec = origin - p0;
+    double u = (tvec * pvec) / det;
+    if (u < 0.0 || u > 1.0) {
+        return false;
+    }
+    Base::Vector3d qvec = tvec % edge1;
+    double v = (direction * qvec) / det;
+    if (v < 0.0 || u + v > 1.0) {
+        return false;
+    }
+    t = (edge2 * qvec) / det;
+    return t >= 0.0;
+}
+
+}  // namespace
+
+int InterferenceChecker::addPart(const Part::TopoShape& shape)
+{
+    PartData part;
+    part.shape = shape;
+
+    if (!shape.isNull()) {
+        part.deflection = shape.getAccuracy();
+
+        std::vector<Part::TopoShape::Facet> facets;
+        shape.getFaces(part.points, facets, part.deflection);
+        part.triangles.reserve(facets.size() * 3);
+        for (const auto& facet : facets) {
+            const Base::Vector3d& p0 = part.points[facet.I1];
+            const Base::Vector3d& p1 = part.points[facet.I2];
+            const Base::Vector3d& p2 = part.points[facet.I3];
+            if (((p1 - p0) % (p2 - p0)).Sqr() < std::numeric_limits<double>::epsilon()) {
+                // degenerated
+                continue;
+            }
+            part.triangles.push_back(facet.I1);
+            part.triangles.push_back(facet.I2);
+            part.triangles.push_back(facet.I3);
+        }
+        if (!part.triangles.empty()) {
+            buildHierarchy(part);
+        }
+
+        if (TopExp_Explorer(shape.getShape(), TopAbs_SOLID).More()) {
+            GProp_GProps props;
+            BRepGProp::VolumeProperties(shape.getShape(), props);
+            part.volume = props.Mass();
+        }
+    }
+
+    parts.push_back(std::move(part));
+    return partCount() - 1;
+}
+
+void InterferenceChecker::clear()
+{
+    parts.clear();
+}
+
+void InterferenceChecker::buildHierarchy(PartData& part)
+{
+    auto count = static_cast<uint32_t>(part.triangles.size() / 3);
+
+    std::vector<Base::BoundBox3d> boxes(count);
+    std::vector<Base::Vector3d> centers(count);
+    for (uint32_t i = 0; i < count; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            const Base::Vector3d& point = part.points[part.triangles[i * 3 + j]];
+            boxes[i].Add(point);
+            centers[i] += point;
+        }
+        centers[i] /= 3.0;
+    }
+
+    std::vector<uint32_t> order(count);
+    std::iota(order.begin(), order.end(), 0);
+
+    // Median split along the longest side of the boxes, until few triangles are left.
+    struct Range
+    {
+        uint32_t node;
+        uint32_t begin;
+        uint32_t end;
+    };
+    part.nodes.clear();
+    part.nodes.reserve(2 * (count / LeafSize + 1));
+    part.nodes.emplace_back();
+    std::vector<Range> stack {{0, 0, count}};
+    while (!stack.empty()) {
+        Range range = stack.back();
+        stack.pop_back();
+
+        Base::BoundBox3d box;
+        for (uint32_t i = range.begin; i < range.end; ++i) {
+            box.Add(boxes[order[i]]);
+        }
+
+        Node& node = part.nodes[range.node];
+        node.box = box;
+        if (range.end - range.begin <= LeafSize) {
+            node.first = range.begin;
+            node.second = range.end;
+            node.leaf = true;
+            continue;
+        }
+
+        int axis = 0;
+        if (box.LengthY() > box.LengthX()) {
+            axis = 1;
+        }
+        if (box.LengthZ() > std::max(box.LengthX(), box.LengthY())) {
+            axis = 2;
+        }
+        uint32_t middle = range.begin + (range.end - range.begin) / 2;
+        std::nth_element(order.begin() + range.begin,
+                         order.begin() + middle,
+                         order.begin() + range.end,
+                         [&](uint32_t a, uint32_t b) {
+                             return coordinate(centers[a], axis) < coordinate(centers[b], axis);
+                         });
+
+        auto left = static_cast<uint32_t>(part.nodes.size());
+        node.first = left;
+        node.second = left + 1;
+        node.leaf = false;
+        part.nodes.emplace_back();  // invalidates node
+        part.nodes.emplace_back();
+        stack.push_back({left, range.begin, middle});
+        stack.push_back({left + 1, middle, range.end});
+    }
+
+    std::vector<uint32_t> triangles;
+    triangles.reserve(part.triangles.size());
+    for (uint32_t index : order) {
+        triangles.push_back(part.triangles[index * 3]);
+        triangles.push_back(part.triangles[index * 3 + 1]);
+        triangles.push_back(part.triangles[index * 3 + 2]);
+    }
+    part.triangles.swap(triangles);
+}
+
+bool InterferenceChecker::trianglesOverlap(const Base::Vector3d* a,
+                                           const Base::Vector3d* b,
+                                           double tolerance)
+{
+    // Separating axis test: the triangles are apart, or only touch, if their projections on one of
+    // the normals or on one of the cross products of their edges overlap by less than tolerance.
+    auto isSeparating = [&](const Base::Vector3d& axis) {
+        double length = axis.Length();
+        if (length < std::numeric_limits<double>::epsilon()) {
+            return false;
+        }
+        double minA = std::numeric_limits<double>::max();
+        double maxA = -minA;
+        double minB = minA;
+        double maxB = -minA;
+        for (int i = 0; i < 3; ++i) {
+            double valueA = (a[i] * axis) / length;
+            double valueB = (b[i] * axis) / length;
+            minA = std::min(minA, valueA);
+            maxA = std::max(maxA, valueA);
+            minB = std::min(minB, valueB);
+            maxB = std::max(maxB, valueB);
+        }
+        return minA > maxB - tolerance || minB > maxA - tolerance;
+    };
+
+    const Base::Vector3d edgesA[3] = {a[1] - a[0], a[2] - a[1], a[0] - a[2]};
+    const Base::Vector3d edgesB[3] = {b[1] - b[0], b[2] - b[1], b[0] - b[2]};
+    if (isSeparating(edgesA[0] % edgesA[1]) || isSeparating(edgesB[0] % edgesB[1])) {
+        return false;
+    }
+    for (const auto& edgeA : edgesA) {
+        for (const auto& edgeB : edgesB) {
+            if (isSeparating(edgeA % edgeB)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+bool InterferenceChecker::isInside(const PartData& part,
+                                   const Base::Vector3d& point,
+                                   double tolerance)
+{
+    // A point is inside if a ray from it crosses the surface an odd number of times. Points closer
+    // to the surface than tolerance along the ray are not.
+    const Base::Vector3d& direction = rayDirection();
+    int crossings = 0;
+    double nearest = std::numeric_limits<double>::max();
+
+    std::vector<uint32_t> stack {0};
+    while (!stack.empty()) {
+        const Node& node = part.nodes[stack.back()];
+        stack.pop_back();
+        if (!rayHitsBox(point, direction, node.box)) {
+            continue;
+        }
+        if (!node.leaf) {
+            stack.push_back(node.first);
+            stack.push_back(node.second);
+            continue;
+        }
+        for (uint32_t i = node.first; i < node.second; ++i) {
+            const uint32_t* triangle = &part.triangles[i * 3];
+            double t {};
+            if (rayHitsTriangle(point,
+                                direction,
+                                part.points[triangle[0]],
+                                part.points[triangle[1]],
+                                part.points[triangle[2]],
+                                t)) {
+                ++crossings;
+                nearest = std::min(nearest, t);
+            }
+        }
+    }
+
+    return crossings % 2 == 1 && nearest > tolerance;
+}
+
+bool InterferenceChecker::hasPointInside(const PartData& container,
+                                         const PartData& part,
+                                         const Base::Matrix4D& toContainer,
+                                         double tolerance)
+{
+    // Only called when the surfaces do not cross: part is either entirely inside of container or
+    // entirely out of it, one of its points decides. It is taken just under a face, so that parts
+    // sharing faces are found but not parts only in contact.
+    double depth = 2.0 * tolerance;
+    for (size_t i = 0; i < part.triangles.size(); i += 3) {
+        const Base::Vector3d& p0 = part.points[part.triangles[i]];
+        const Base::Vector3d& p1 = part.points[part.triangles[i + 1]];
+        const Base::Vector3d& p2 = part.points[part.triangles[i + 2]];
+        Base::Vector3d center = (p0 + p1 + p2) / 3.0;
+
+        // The orientation of the triangles is not known, take the side inside of part.
+        Base::Vector3d offset = ((p1 - p0) % (p2 - p0)).Normalize() * depth;
+        for (const auto& point : {center - offset, center + offset}) {
+            if (!isInside(part, point, tolerance)) {
+                continue;
+            }
+            Base::Vector3d inContainer = toContainer * point;
+            return container.nodes.front().box.IsInBox(inContainer)
+                && isInside(container, inContainer, tolerance);
+        }
+    }
+    return false;
+}
+
+bool InterferenceChecker::partsOverlap(const PartData& partA,
+                                       const Base::Placement& plcA,
+                                       const PartData& partB,
+                                       const Base::Placement& plcB,
+                                       double tolerance) const
+{
+    // Everything is done in the coordinates of partA.
+    Base::Matrix4D toA = (plcA.inverse() * plcB).toMatrix();
+
+    std::vector<std::pair<uint32_t, uint32_t>> stack {{0, 0}};
+    while (!stack.empty()) {
+        auto [indexA, indexB] = stack.back();
+        stack.pop_back();
+        const Node& nodeA = partA.nodes[indexA];
+        const Node& nodeB = partB.nodes[indexB];
+        if (!boxesOverlap(nodeA.box, nodeB.box.Transformed(toA), tolerance)) {
+            continue;
+        }
+
+        if (nodeA.leaf && nodeB.leaf) {
+            for (uint32_t j = nodeB.first; j < nodeB.second; ++j) {
+                Base::Vector3d b[3];
+                for (int k = 0; k < 3; ++k) {
+                    b[k] = toA * partB.points[partB.triangles[j * 3 + k]];
+                }
+                for (uint32_t i = nodeA.first; i < nodeA.second; ++i) {
+                    Base::Vector3d a[3];
+                    for (int k = 0; k < 3; ++k) {
+                        a[k] = partA.points[partA.triangles[i * 3 + k]];
+                    }
+                    if (trianglesOverlap(a, b, tolerance)) {
+                        return true;
+                    }
+                }
+            }
+            continue;
+        }
+
+        // Go down the largest node first.
+        if (nodeB.leaf
+            || (!nodeA.leaf
+                && nodeA.box.CalcDiagonalLength() >= nodeB.box.CalcDiagonalLength())) {
+            stack.emplace_back(nodeA.first, indexB);
+            stack.emplace_back(nodeA.second, indexB);
+        }
+        else {
+            stack.emplace_back(indexA, nodeB.first);
+            stack.emplace_back(indexA, nodeB.second);
+        }
+    }
+
+    // The surfaces do not cross or only along shared faces, one part can still be inside of the
+    // other one.
+    Base::Matrix4D toB = (plcB.inverse() * plcA).toMatrix();
+    return hasPointInside(partA, partB, toA, tolerance)
+        || hasPointInside(partB, partA, toB, tolerance);
+}
+
+bool InterferenceChecker::shapesOverlap(const PartData& partA,
+                                        const Base::Placement& plcA,
+                                        const PartData& partB,
+                                        const Base::Placement& plcB) const
+{
+    if (partA.volume <= 0.0 || partB.volume <= 0.0) {
+        // Nothing to compare without solids, keep what the tessellations gave.
+        return true;
+    }
+
+    TopoDS_Shape shapeA =
+        Part::TopoShape::moved(partA.shape.getShape(), Part::TopoShape::convert(plcA.toMatrix()));
+    TopoDS_Shape shapeB =
+        Part::TopoShape::moved(partB.shape.getShape(), Part::TopoShape::convert(plcB.toMatrix()));
+
+    BRepAlgoAPI_Common common(shapeA, shapeB);
+    if (!common.IsDone()) {
+        return true;
+    }
+
+    GProp_GProps props;
+    BRepGProp::VolumeProperties(common.Shape(), props);
+    return props.Mass() > VolumeRatio * std::min(partA.volume, partB.volume);
+}
+
+std::vector<std::pair<int, int>>
+InterferenceChecker::findInterferences(const std::vector<Base::Placement>& placements,
+                                       bool exact) const
+{
+    struct Entry
+    {
+        Base::BoundBox3d box;
+        int index;
+    };
+
+    // Sweep and prune along X of the bounding boxes of the placed parts.
+    std::vector<Entry> entries;
+    size_t count = std::min(parts.size(), placements.size());
+    for (size_t i = 0; i < count; ++i) {
+        if (parts[i].nodes.empty()) {
+            continue;
+        }
+        entries.push_back(
+            {parts[i].nodes.front().box.Transformed(placements[i].toMatrix()), int(i)});
+    }
+    std::sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) {
+        return a.box.MinX < b.box.MinX;
+    });
+
+    std::vector<std::pair<int, int>> result;
+    for (size_t i = 0; i < entries.size(); ++i) {
+        const Entry& first = entries[i];
+        for (size_t j = i + 1; j < entries.size() && entries[j].box.MinX < first.box.MaxX; ++j) {
+            const Entry& second = entries[j];
+            const PartData& partA = parts[first.index];
+            const PartData& partB = parts[second.index];
+            double tolerance = partA.deflection + partB.deflection;
+            if (!boxesOverlap(first.box, second.box, tolerance)) {
+                continue;
+            }
+
+            const Base::Placement& plcA = placements[first.index];
+            const Base::Placement& plcB = placements[second.index];
+            if (!partsOverlap(partA, plcA, partB, plcB, tolerance)) {
+                continue;
+            }
+            if (exact && !shapesOverlap(partA, plcA, partB, plcB)) {
+                continue;
+            }
+            result.emplace_back(std::min(first.index, second.index),
+                                std::max(first.index, second.index));
+        }
+    }
+
+    std::sort(result.begin(), result.end());
+    return result;
+}
@@ -0,0 +1,116 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2024 The FreeCAD Project Association                     *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+
+#ifndef ASSEMBLY_InterferenceChecker_H
+#define ASSEMBLY_InterferenceChecker_H
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include <Mod/Assembly/AssemblyGlobal.h>
+
+#include <Base/BoundBox.h>
+#include <Base/Placement.h>
+#include <Mod/Part/App/TopoShape.h>
+
+
+namespace Assembly
+{
+
+/** Finds the parts of an assembly that interpenetrate.
+ *
+ * The shape of each part is tessellated once, in the coordinates of the part, and its triangles
+ * are kept in a bounding volume hierarchy. A check then only needs the current placements of the
+ * parts: the pairs whose bounding boxes overlap are found by sweep and prune, their triangles are
+ * tested against each other through the hierarchies and, if asked, the flagged pairs are
+ * confirmed with an exact boolean common of their shapes.
+ *
+ * Faces in contact are not reported: the parts must overlap by more than the tessellation
+ * deflection. Parts whose surfaces do not cross, one inside the other or sharing faces, are found
+ * by testing if a point just under a face of one is inside of the other.
+ */
+class AssemblyExport InterferenceChecker
+{
+public:
+    /// Adds a part and returns its index. The shape is given without the placement of the part.
+    int addPart(const Part::TopoShape& shape);
+    int partCount() const
+    {
+        return static_cast<int>(parts.size());
+    }
+    void clear();
+
+    /** Returns the pairs of indices of the parts that interfere when placed at placements, one
+     * placement per part in the order they were added. The smaller index is first.
+     */
+    std::vector<std::pair<int, int>>
+    findInterferences(const std::vector<Base::Placement>& placements, bool exact = false) const;
+
+private:
+    struct Node
+    {
+        Base::BoundBox3d box;
+        // Children for an inner node, range of triangles for a leaf.
+        uint32_t first = 0;
+        uint32_t second = 0;
+        bool leaf = false;
+    };
+
+    struct PartData
+    {
+        Part::TopoShape shape;
+        std::vector<Base::Vector3d> points;
+        // Three point indices per triangle, sorted by the hierarchy build.
+        std::vector<uint32_t> triangles;
+        std::vector<Node> nodes;
+        double deflection = 0.0;
+        double volume = 0.0;
+    };
+
+    static void buildHierarchy(PartData& part);
+    static bool isInside(const PartData& part, const Base::Vector3d& point, double tolerance);
+    static bool hasPointInside(const PartData& container,
+                               const PartData& part,
+                               const Base::Matrix4D& toContainer,
+                               double tolerance);
+    static bool
+    trianglesOverlap(const Base::Vector3d* a, const Base::Vector3d* b, double tolerance);
+    bool partsOverlap(const PartData& partA,
+                      const Base::Placement& plcA,
+                      const PartData& partB,
+                      const Base::Placement& plcB,
+                      double tolerance) const;
+    bool shapesOverlap(const PartData& partA,
+                       const Base::Placement& plcA,
+                       const PartData& partB,
+                       const Base::Placement& plcB) const;
+
+    std::vector<PartData> parts;
+};
+
+}  // namespace Assembly
+
+
+#endif  // ASSEMBLY_InterferenceChecker_H
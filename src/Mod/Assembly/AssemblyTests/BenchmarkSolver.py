@@ -0,0 +1,106 @@
+# SPDX-License-Identifier: LGPL-2.1-or-later
+# /****************************************************************************
+#                                                                           *
+#    Copyright (c) 2024 The FreeCAD Project Association                     *
+#                                                                           *
+#    This file is part of FreeCAD.                                          *
+#                                                                           *
+#    FreeCAD is free software: you can redistribute it and/or modify it     *
+#    under the terms of the GNU Lesser General Public License as            *
+#    published by the Free Software Foundation, either version 2.1 of the   *
+#    License, or (at your option) any later version.                        *
+#                                                                           *
+#    FreeCAD is distributed in the hope that it will be useful, but         *
+#    WITHOUT ANY WARRANTY; without even the implied warranty of             *
+#    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+#    Lesser General Public License for more details.                        *
+#                                                                           *
+#    You should have received a copy of the GNU Lesser General Public       *
+#    License along with FreeCAD. If not, see                                *
+#    <https://www.gnu.org/licenses/>.                                       *
+#                                                                           *
+# ***************************************************************************/
+
+"""Generates large assemblies to time the assembly solver.
+
+Run it from the Python console:
+
+    from AssemblyTests import BenchmarkSolver
+    BenchmarkSolver.run(500)
+
+To also get the time spent building the solver model versus solving it, enable the log of the
+Assembly module first with FreeCAD.setLogLevel("Assembly", "Log").
+"""
+
+import time
+
+import FreeCAD as App
+
+import JointObject
+
+
+def _msg(text, end="\n"):
+    """Write messages to the console including the line ending."""
+    App.Console.PrintMessage(text + end)
+
+
+def makeBenchmarkAssembly(assembly, jointgroup, count, jointTypes=(0, 1), size=10.0):
+    """Add a stack of count boxes to assembly, the first one grounded and each other one
+    joined to the previous one with a joint type taken in turn from jointTypes.
+    Returns the boxes."""
+    boxes = []
+    for i in range(count):
+        box = assembly.newObject("Part::Box", "Box")
+        box.Length = size
+        box.Width = size
+        box.Height = size
+        box.Placement = App.Placement(App.Vector(i * 2 * size, 0, 0), App.Rotation())
+        boxes.append(box)
+
+    ground = jointgroup.newObject("App::FeaturePython", "GroundedJoint")
+    JointObject.GroundedJoint(ground, boxes[0])
+
+    for i in range(1, count):
+        joint = jointgroup.newObject("App::FeaturePython", "Joint")
+        JointObject.Joint(joint, jointTypes[(i - 1) % len(jointTypes)])
+
+        # The references are set directly because setJointConnectors() solves for each joint.
+        below = boxes[i - 1].Name
+        above = boxes[i].Name
+        joint.Reference1 = [assembly, [below + ".Face6", below + ".Vertex2"]]
+        joint.Placement1 = joint.Proxy.findPlacement(joint, joint.Reference1, 0)
+        joint.Reference2 = [assembly, [above + ".Face5", above + ".Vertex1"]]
+        joint.Placement2 = joint.Proxy.findPlacement(joint, joint.Reference2, 1)
+
+    return boxes
+
+
+def run(count=500):
+    """Time a first solve, which builds the solver model, and a second solve after moving a part,
+    which can reuse it. Returns both times in seconds."""
+    doc = App.newDocument("BenchmarkSolver")
+    try:
+        assembly = doc.addObject("Assembly::AssemblyObject", "Assembly")
+        jointgroup = assembly.newObject("Assembly::JointGroup", "Joints")
+
+        start = time.perf_counter()
+        boxes = makeBenchmarkAssembly(assembly, jointgroup, count)
+        _msg("Created {} parts in {:.3f}s".format(count, time.perf_counter() - start))
+
+        start = time.perf_counter()
+        assembly.solve()
+        firstSolve = time.perf_counter() - start
+        _msg("First solve: {:.3f}s".format(firstSolve))
+
+        plc = boxes[-1].Placement
+        plc.move(App.Vector(0, 0, 1))
+        boxes[-1].Placement = plc
+
+        start = time.perf_counter()
+        assembly.solve()
+        secondSolve = time.perf_counter() - start
+        _msg("Second solve: {:.3f}s".format(secondSolve))
+
+        return firstSolve, secondSolve
+    finally:
+        App.closeDocument(doc.Name)
@@ -23,11 +23,16 @@
 
 import FreeCAD as App
 import Part
+import os
+import struct
+import tempfile
 import unittest
 
 import UtilsAssembly
 import JointObject
 
+from AssemblyTests import BenchmarkSolver
+
 
 def _msg(text, end="\n"):
     """Write messages to the console including the line ending."""
@@ -213,3 +218,210 @@ class TestCore(unittest.TestCase):
         joint.Proxy.setJointConnectors(joint, refs)
 
         self.assertTrue(box.Placement.isSame(box2.Placement, 1e-6), "'{}'".format(operation))
+
+    def test_solve_again_after_moving_part(self):
+        """Test solving an assembly again after moving one of its parts."""
+        operation = "Solve assembly again"
+        _msg("  Test '{}'".format(operation))
+
+        boxes = BenchmarkSolver.makeBenchmarkAssembly(
+            self.assembly, self.jointgroup, 4, jointTypes=(0,)
+        )
+
+        self.assertEqual(self.assembly.solve(), 0, "'{}' failed".format(operation))
+        placements = [box.Placement for box in boxes]
+
+        # Only a placement changed so the solver model of the previous solve can be reused.
+        boxes[-1].Placement = App.Placement(App.Vector(5, 5, 5), App.Rotation(10, 20, 30))
+
+        self.assertEqual(self.assembly.solve(), 0, "'{}' failed".format(operation))
+        for box, plc in zip(boxes, placements):
+            self.assertTrue(box.Placement.isSame(plc, 1e-6), "'{}'".format(operation))
+
+    def test_solve_again_after_changing_joint(self):
+        """Test solving an assembly again after changing the value of a joint."""
+        operation = "Solve assembly again with changed joint"
+        _msg("  Test '{}'".format(operation))
+
+        bottom, top = BenchmarkSolver.makeBenchmarkAssembly(
+            self.assembly, self.jointgroup, 2, jointTypes=(5,)
+        )
+        joint = self.jointgroup.Group[-1]
+
+        def gap():
+            # Face6 is the top face of a box, Face5 its bottom face.
+            return abs(top.Shape.Faces[4].CenterOfMass.z - bottom.Shape.Faces[5].CenterOfMass.z)
+
+        self.assertEqual(self.assembly.solve(), 0, "'{}' failed".format(operation))
+        self.assertAlmostEqual(gap(), 0, 6)
+
+        # The joint still connects the same faces so it is updated in the solver model.
+        joint.Distance = 3
+
+        self.assertEqual(self.assembly.solve(), 0, "'{}' failed".format(operation))
+        self.assertAlmostEqual(gap(), 3, 6)
+
+    def test_solve_independent_sets(self):
+        """Test solving an assembly made of parts only connected through a grounded part."""
+        operation = "Solve independent sets"
+        _msg("  Test '{}'".format(operation))
+
+        base = self.assembly.newObject("Part::Box", "Box")
+        top = self.assembly.newObject("Part::Box", "Box")
+        top.Placement = App.Placement(App.Vector(30, 0, 0), App.Rotation(10, 0, 0))
+        bottom = self.assembly.newObject("Part::Box", "Box")
+        bottom.Placement = App.Placement(App.Vector(-30, 0, 0), App.Rotation(0, 10, 0))
+
+        ground = self.jointgroup.newObject("App::FeaturePython", "GroundedJoint")
+        JointObject.GroundedJoint(ground, base)
+
+        # Two revolute joints on opposite faces of the grounded box.
+        for part, baseSubs, partSubs in (
+            (top, [".Face6", ".Vertex2"], [".Face5", ".Vertex1"]),
+            (bottom, [".Face5", ".Vertex1"], [".Face6", ".Vertex2"]),
+        ):
+            joint = self.jointgroup.newObject("App::FeaturePython", "Joint")
+            JointObject.Joint(joint, 1)
+            joint.Reference1 = [self.assembly, [base.Name + sub for sub in baseSubs]]
+            joint.Placement1 = joint.Proxy.findPlacement(joint, joint.Reference1, 0)
+            joint.Reference2 = [self.assembly, [part.Name + sub for sub in partSubs]]
+            joint.Placement2 = joint.Proxy.findPlacement(joint, joint.Reference2, 1)
+
+        self.assertEqual(self.assembly.solve(), 0, "'{}' failed".format(operation))
+
+        self.assertTrue(base.Placement.isSame(App.Placement(), 1e-6), "'{}'".format(operation))
+        self.assertAlmostEqual(
+            top.Shape.Vertexes[0].Point.distanceToPoint(base.Shape.Vertexes[1].Point), 0, 6
+        )
+        self.assertAlmostEqual(
+            bottom.Shape.Vertexes[1].Point.distanceToPoint(base.Shape.Vertexes[0].Point), 0, 6
+        )
+
+    def test_export_simulation_frames(self):
+        """Test reading back the frames exported after generating a simulation."""
+        operation = "Export simulation frames"
+        _msg("  Test '{}'".format(operation))
+
+        base = self.assembly.newObject("Part::Box", "Box")
+        box = self.assembly.newObject("Part::Box", "Box")
+        box.Placement = App.Placement(App.Vector(30, 0, 0), App.Rotation(10, 0, 0))
+
+        ground = self.jointgroup.newObject("App::FeaturePython", "GroundedJoint")
+        JointObject.GroundedJoint(ground, base)
+
+        joint = self.jointgroup.newObject("App::FeaturePython", "Joint")
+        JointObject.Joint(joint, 0)
+        joint.Reference1 = [self.assembly, [base.Name + ".Face6", base.Name + ".Vertex2"]]
+        joint.Placement1 = joint.Proxy.findPlacement(joint, joint.Reference1, 0)
+        joint.Reference2 = [self.assembly, [box.Name + ".Face5", box.Name + ".Vertex1"]]
+        joint.Placement2 = joint.Proxy.findPlacement(joint, joint.Reference2, 1)
+        self.assertEqual(self.assembly.solve(), 0, "'{}' failed".format(operation))
+
+        sim = self.doc.addObject("App::FeaturePython", "Simulation")
+        for name in ("aTimeStart", "bTimeEnd", "cTimeStepOutput"):
+            sim.addProperty("App::PropertyTime", name, "Simulation")
+        sim.addProperty("App::PropertyFloat", "fGlobalErrorTolerance", "Simulation")
+        sim.bTimeEnd = 1.0
+        sim.cTimeStepOutput = 0.1
+        sim.fGlobalErrorTolerance = 1.0e-6
+        self.assertEqual(self.assembly.generateSimulation(sim), 0, "'{}' failed".format(operation))
+
+        with tempfile.TemporaryDirectory() as tmp:
+            path = os.path.join(tmp, "frames.bin")
+            self.assembly.exportSimulationFrames(path)
+            with open(path, "rb") as f:
+                data = f.read()
+
+        self.assertEqual(data[:8], b"FCSIMFRM", "'{}' failed".format(operation))
+        version, frameCount, objCount, start, step = struct.unpack_from("<IQIdd", data, 8)
+        self.assertEqual(version, 1, "'{}' failed".format(operation))
+        self.assertEqual(frameCount, self.assembly.numberOfFrames(), "'{}'".format(operation))
+        self.assertAlmostEqual(start, 0.0)
+        self.assertAlmostEqual(step, 0.1)
+
+        offset = 8 + struct.calcsize("<IQIdd")
+        names = []
+        for i in range(objCount):
+            (size,) = struct.unpack_from("<I", data, offset)
+            offset += 4
+            names.append(data[offset : offset + size].decode("utf-8"))
+            offset += size
+        self.assertIn(box.getFullName(), names, "'{}' failed".format(operation))
+        self.assertEqual(
+            len(data) - offset, frameCount * objCount * 7 * 8, "'{}'".format(operation)
+        )
+
+        # Nothing drives the parts so every frame holds the solved placements.
+        objects = {obj.getFullName(): obj for obj in (base, box)}
+        for frame in (0, frameCount - 1):
+            for i, name in enumerate(names):
+                values = struct.unpack_from("<7d", data, offset + (frame * objCount + i) * 56)
+                plc = App.Placement(App.Vector(*values[:3]), App.Rotation(*values[3:]))
+                self.assertTrue(
+                    plc.isSame(objects[name].Placement, 1e-6), "'{}'".format(operation)
+                )
+
+        # Playing back a frame with or without updating the joints keeps the placements.
+        solved = box.Placement
+        for updateJCS in (False, True):
+            self.assembly.updateForFrame(frameCount - 1, updateJCS)
+            self.assertTrue(box.Placement.isSame(solved, 1e-6), "'{}'".format(operation))
+
+    def test_check_interferences(self):
+        """Test finding the parts of an assembly that interpenetrate."""
+        operation = "Check interferences"
+        _msg("  Test '{}'".format(operation))
+
+        base = self.assembly.newObject("Part::Box", "Box")
+        touching = self.assembly.newObject("Part::Box", "Box")
+        touching.Placement = App.Placement(App.Vector(10, 0, 0), App.Rotation())
+        overlapping = self.assembly.newObject("Part::Box", "Box")
+        overlapping.Placement = App.Placement(App.Vector(5, 5, 5), App.Rotation(10, 0, 0))
+        for box in (base, touching, overlapping):
+            box.recompute()
+
+        for exact in (False, True):
+            pairs = self.assembly.checkInterferences(exact)
+            names = sorted(sorted(obj.Name for obj in pair) for pair in pairs)
+            expected = sorted(
+                sorted([part.Name, overlapping.Name]) for part in (base, touching)
+            )
+            self.assertEqual(names, expected, "'{}' failed".format(operation))
+
+    def test_check_interferences_nested(self):
+        """Test finding interferences of parts inside of others and in sub-assemblies."""
+        operation = "Check nested interferences"
+        _msg("  Test '{}'".format(operation))
+
+        outer = self.assembly.newObject("Part::Box", "Box")
+        outer.Length = outer.Width = outer.Height = 20
+        inner = self.assembly.newObject("Part::Box", "Box")
+        inner.Length = inner.Width = inner.Height = 2
+        inner.Placement = App.Placement(App.Vector(5, 5, 5), App.Rotation(10, 20, 30))
+
+        sub = self.doc.addObject("Assembly::AssemblyObject", "SubAssembly")
+        first = sub.newObject("Part::Box", "Box")
+        second = sub.newObject("Part::Box", "Box")
+        second.Placement = App.Placement(App.Vector(5, 5, 5), App.Rotation())
+        link = self.assembly.newObject("Assembly::AssemblyLink", "SubAssemblyLink")
+        link.LinkedObject = sub
+        link.Placement = App.Placement(App.Vector(100, 0, 0), App.Rotation())
+        self.doc.recompute()
+
+        def linkedName(obj):
+            return obj.LinkedObject.Name if hasattr(obj, "LinkedObject") else obj.Name
+
+        for exact in (False, True):
+            pairs = self.assembly.checkInterferences(exact)
+            names = sorted(sorted(linkedName(obj) for obj in pair) for pair in pairs)
+            expected = sorted(
+                [sorted([outer.Name, inner.Name]), sorted([first.Name, second.Name])]
+            )
+            self.assertEqual(names, expected, "'{}' failed".format(operation))
+
+        # Moving the sub-assembly into the outer box makes its parts interfere with it.
+        link.Placement = App.Placement(App.Vector(-5, 0, 0), App.Rotation())
+        pairs = self.assembly.checkInterferences(False)
+        names = [sorted(linkedName(obj) for obj in pair) for pair in pairs]
+        for part in (first, second):
+            self.assertIn(sorted([outer.Name, part.Name]), names, "'{}'".format(operation))
@@ -902,7 +902,7 @@ class TaskAssemblyCreateSimulation(QtCore.QObject):
         self.form.groupBox_player.show()
 
     def onFrameChanged(self, val):
-        self.assembly.updateForFrame(val)
+        self.assembly.updateForFrame(val, False)
         self.form.FrameLabel.setText(translate("Assembly", "Frame" + " " + str(val)))
         time = float(val * self.simFeaturePy.cTimeStepOutput)
         self.form.FrameTimeLabel.setText(f"{time:.2f} s")
@@ -26,6 +26,8 @@
 #include <Python.h>
 #include <cstdlib>
 #include <memory>
+#include <numeric>
+#include <unordered_map>
 
 #include <BRepBndLib.hxx>
 #include <BRepBuilderAPI_MakeVertex.hxx>
@@ -36,11 +38,13 @@
 #include <SMESHDS_Group.hxx>
 #include <SMESHDS_GroupBase.hxx>
 #include <SMESHDS_Mesh.hxx>
+#include <SMESHDS_SubMesh.hxx>
 #include <SMESH_Gen.hxx>
 #include <SMESH_Group.hxx>
 #include <SMESH_Mesh.hxx>
 #include <SMESH_MeshEditor.hxx>
 #include <ShapeAnalysis_ShapeTolerance.hxx>
+#include <Standard_Version.hxx>
 #include <StdMeshers_Deflection1D.hxx>
 #include <StdMeshers_LocalLength.hxx>
 #include <StdMeshers_MaxElementArea.hxx>
@@ -50,6 +54,8 @@
 #include <StdMeshers_Quadrangle_2D.hxx>
 #include <StdMeshers_Regular_1D.hxx>
 #include <StdMeshers_StartEndLength.hxx>
+#include <TopExp.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
 #include <TopoDS_Face.hxx>
 #include <TopoDS_Shape.hxx>
 #include <TopoDS_Solid.hxx>
@@ -57,7 +63,10 @@
 #include <gp_Pnt.hxx>
 
 #include <boost/assign/list_of.hpp>
+#include <boost/geometry.hpp>
+#include <boost/geometry/index/rtree.hpp>
 #include <boost/tokenizer.hpp>  //to simplify parsing input files we use the boost lib
+#include <fmt/format.h>
 #endif
 
 #include <App/Application.h>
@@ -86,6 +95,195 @@ SMESH_Gen* FemMesh::_mesh_gen = nullptr;
 
 TYPESYSTEM_SOURCE(Fem::FemMesh, Base::Persistence)
 
+namespace bg = boost::geometry;
+namespace bgi = boost::geometry::index;
+
+/// cheap fingerprint to detect modifications done directly on the SMESH data structure
+class FemMesh::Signature
+{
+public:
+    explicit Signature(const FemMesh& mesh)
+        : matrix(mesh._Mtrx)
+        , shape(mesh.myMesh->GetShapeToMesh())
+    {
+        const SMESHDS_Mesh* meshDS = mesh.myMesh->GetMeshDS();
+        numNodes = meshDS->NbNodes();
+        numElements = meshDS->NbEdges() + meshDS->NbFaces() + meshDS->NbVolumes();
+        maxNodeId = meshDS->MaxNodeID();
+        maxElementId = meshDS->MaxElementID();
+    }
+
+    bool operator==(const Signature& other) const
+    {
+        return numNodes == other.numNodes && numElements == other.numElements
+            && maxNodeId == other.maxNodeId && maxElementId == other.maxElementId
+            && matrix == other.matrix && shape.IsSame(other.shape);
+    }
+
+private:
+    Base::Matrix4D matrix;
+    TopoDS_Shape shape;
+    int numNodes;
+    int numElements;
+    int maxNodeId;
+    int maxElementId;
+};
+
+/*!
+ * Caches the association of mesh nodes with the sub-shapes of a BRep. The solver writers
+ * ask for the nodes of the same faces, edges and vertices many times (once per constraint
+ * reference and query type), so the result of each query is kept until the mesh changes.
+ *
+ * If the mesh was computed on a shape the nodes are taken from the sub-meshes of the
+ * matching sub-shapes. Otherwise (e.g. an imported mesh) an R-tree over the node positions
+ * limits the expensive distance test to the nodes inside the bounding box of the sub-shape.
+ */
+class FemMesh::GeometryIndex
+{
+public:
+    using Point = bg::model::point<double, 3, bg::cs::cartesian>;
+    using Box = bg::model::box<Point>;
+    using Node = std::pair<Point, int>;
+
+    explicit GeometryIndex(const FemMesh& mesh)
+        : signature(mesh)
+        , useSubMeshes(mesh.myMesh->HasShapeToMesh() && mesh._Mtrx.isUnity())
+    {}
+
+    bool isValid(const FemMesh& mesh) const
+    {
+        return signature == Signature(mesh);
+    }
+
+    const std::set<int>* findNodes(const TopoDS_Shape& shape) const
+    {
+        auto it = nodeCache.find(shape);
+        return it != nodeCache.end() ? &it->second : nullptr;
+    }
+
+    const std::set<int>& storeNodes(const TopoDS_Shape& shape, std::set<int>&& nodes)
+    {
+        return nodeCache[shape] = std::move(nodes);
+    }
+
+    /// get the nodes the mesher has assigned to \a shape and its sub-shapes
+    bool getSubMeshNodes(const FemMesh& mesh, const TopoDS_Shape& shape, std::set<int>& nodes) const
+    {
+        if (!useSubMeshes) {
+            return false;
+        }
+
+        const SMESHDS_Mesh* meshDS = mesh.myMesh->GetMeshDS();
+        if (meshDS->ShapeToIndex(shape) == 0) {
+            return false;
+        }
+
+        TopTools_IndexedMapOfShape subShapes;
+        TopExp::MapShapes(shape, subShapes);
+        for (int i = 1; i <= subShapes.Extent(); ++i) {
+            const SMESHDS_SubMesh* subMesh = meshDS->MeshElements(subShapes(i));
+            if (!subMesh) {
+                continue;
+            }
+            SMDS_NodeIteratorPtr nodeIter = subMesh->GetNodes();
+            while (nodeIter && nodeIter->more()) {
+                nodes.insert(nodeIter->next()->GetID());
+            }
+        }
+
+        return !nodes.empty();
+    }
+
+    /// get the nodes whose position in absolute space lies inside \a box
+    std::vector<Node> getNodes(const FemMesh& mesh, const Bnd_Box& box) const
+    {
+        std::vector<Node> nodes;
+        if (box.IsVoid()) {
+            return nodes;
+        }
+
+        if (!tree) {
+            buildTree(mesh);
+        }
+
+        double xMin, yMin, zMin, xMax, yMax, zMax;
+        box.Get(xMin, yMin, zMin, xMax, yMax, zMax);
+        tree->query(bgi::intersects(Box(Point(xMin, yMin, zMin), Point(xMax, yMax, zMax))),
+                    std::back_inserter(nodes));
+        return nodes;
+    }
+
+private:
+    void buildTree(const FemMesh& mesh) const
+    {
+        const Base::Matrix4D& Mtrx = mesh._Mtrx;
+        const SMESHDS_Mesh* meshDS = mesh.myMesh->GetMeshDS();
+
+        std::vector<Node> nodes;
+        nodes.reserve(meshDS->NbNodes());
+        SMDS_NodeIteratorPtr aNodeIter = meshDS->nodesIterator();
+        while (aNodeIter->more()) {
+            const SMDS_MeshNode* aNode = aNodeIter->next();
+            // Apply the matrix to hold the nodes in absolute space.
+            Base::Vector3d vec = Mtrx * Base::Vector3d(aNode->X(), aNode->Y(), aNode->Z());
+            nodes.emplace_back(Point(vec.x, vec.y, vec.z), aNode->GetID());
+        }
+
+        // use the packing algorithm of the range constructor
+        tree = std::make_unique<bgi::rtree<Node, bgi::quadratic<16>>>(nodes.begin(), nodes.end());
+    }
+
+    /// hash the shape without orientation, like TopoDS_Shape::IsSame()
+    struct ShapeHasher
+    {
+        size_t operator()(const TopoDS_Shape& s) const
+        {
+#if OCC_VERSION_HEX >= 0x070800
+            return std::hash<TopoDS_Shape> {}(s);
+#else
+            return s.HashCode(INT_MAX);
+#endif
+        }
+        bool operator()(const TopoDS_Shape& a, const TopoDS_Shape& b) const
+        {
+            return a.IsSame(b);
+        }
+    };
+
+    Signature signature;
+    bool useSubMeshes;
+    mutable std::unique_ptr<bgi::rtree<Node, bgi::quadratic<16>>> tree;
+    std::unordered_map<TopoDS_Shape, std::set<int>, ShapeHasher, ShapeHasher> nodeCache;
+};
+
+namespace
+{
+/// get the elements of the given type that share at least one node with \a nodes
+std::vector<const SMDS_MeshElement*>
+getElementsByNodes(const SMESHDS_Mesh* meshDS, const std::set<int>& nodes, SMDSAbs_ElementType type)
+{
+    std::map<int, const SMDS_MeshElement*> elements;
+    for (int id : nodes) {
+        const SMDS_MeshNode* node = meshDS->FindNode(id);
+        if (!node) {
+            continue;
+        }
+        SMDS_ElemIteratorPtr it = node->GetInverseElementIterator(type);
+        while (it && it->more()) {
+            const SMDS_MeshElement* elem = it->next();
+            elements.emplace(elem->GetID(), elem);
+        }
+    }
+
+    std::vector<const SMDS_MeshElement*> result;
+    result.reserve(elements.size());
+    for (const auto& it : elements) {
+        result.push_back(it.second);
+    }
+    return result;
+}
+}  // namespace
+
 FemMesh::FemMesh()
     : myMesh(nullptr)
     , myStudyId(0)
@@ -137,6 +335,7 @@ FemMesh& FemMesh::operator=(const FemMesh& mesh)
 
 void FemMesh::copyMeshData(const FemMesh& mesh)
 {
+    resetCaches();
     _Mtrx = mesh._Mtrx;
 
     // 1. Get source mesh
@@ -328,6 +527,7 @@ void FemMesh::setStandardHypotheses()
 
 void FemMesh::compute()
 {
+    resetCaches();
     getGenerator()->Compute(*myMesh, myMesh->GetShapeToMesh());
 }
 
@@ -343,6 +543,7 @@ std::list<std::pair<int, int>> FemMesh::getVolumesByFace(const TopoDS_Face& face
 {
     std::list<std::pair<int, int>> result;
     std::set<int> nodes_on_face = getNodesByFace(face);
+    const SMESHDS_Mesh* meshDS = myMesh->GetMeshDS();
 
     // SMDS_MeshVolume::facesIterator() is broken with SMESH7 as it is impossible
     // to iterate volume faces
@@ -351,9 +552,7 @@ std::list<std::pair<int, int>> FemMesh::getVolumesByFace(const TopoDS_Face& face
     std::map<int, std::set<int>> face_nodes;
 
     // get faces that contribute to 'nodes_on_face' with all of its nodes
-    SMDS_FaceIteratorPtr face_iter = myMesh->GetMeshDS()->facesIterator();
-    while (face_iter && face_iter->more()) {
-        const SMDS_MeshFace* face = face_iter->next();
+    for (const SMDS_MeshElement* face : getElementsByNodes(meshDS, nodes_on_face, SMDSAbs_Face)) {
         SMDS_NodeIteratorPtr node_iter = face->nodeIterator();
 
         // all nodes of the current face must be part of 'nodes_on_face'
@@ -376,9 +575,7 @@ std::list<std::pair<int, int>> FemMesh::getVolumesByFace(const TopoDS_Face& face
     }
 
     // get all nodes of a volume and check which faces contribute to it with all of its nodes
-    SMDS_VolumeIteratorPtr vol_iter = myMesh->GetMeshDS()->volumesIterator();
-    while (vol_iter->more()) {
-        const SMDS_MeshVolume* vol = vol_iter->next();
+    for (const SMDS_MeshElement* vol : getElementsByNodes(meshDS, nodes_on_face, SMDSAbs_Volume)) {
         SMDS_NodeIteratorPtr node_iter = vol->nodeIterator();
         std::set<int> node_ids;
         while (node_iter && node_iter->more()) {
@@ -412,9 +609,8 @@ std::list<int> FemMesh::getFacesByFace(const TopoDS_Face& face) const
     std::list<int> result;
     std::set<int> nodes_on_face = getNodesByFace(face);
 
-    SMDS_FaceIteratorPtr face_iter = myMesh->GetMeshDS()->facesIterator();
-    while (face_iter->more()) {
-        const SMDS_MeshFace* face = static_cast<const SMDS_MeshFace*>(face_iter->next());
+    for (const SMDS_MeshElement* face :
+         getElementsByNodes(myMesh->GetMeshDS(), nodes_on_face, SMDSAbs_Face)) {
         int numNodes = face->NbNodes();
 
         std::set<int> face_nodes;
@@ -444,9 +640,8 @@ std::list<int> FemMesh::getEdgesByEdge(const TopoDS_Edge& edge) const
     std::list<int> result;
     std::set<int> nodes_on_edge = getNodesByEdge(edge);
 
-    SMDS_EdgeIteratorPtr edge_iter = myMesh->GetMeshDS()->edgesIterator();
-    while (edge_iter->more()) {
-        const SMDS_MeshEdge* edge = static_cast<const SMDS_MeshEdge*>(edge_iter->next());
+    for (const SMDS_MeshElement* edge :
+         getElementsByNodes(myMesh->GetMeshDS(), nodes_on_edge, SMDSAbs_Edge)) {
         int numNodes = edge->NbNodes();
 
         std::set<int> edge_nodes;
@@ -488,11 +683,9 @@ std::map<int, int> FemMesh::getccxVolumesByFace(const TopoDS_Face& face) const
         elem_order.insert(std::make_pair(c3d10.size(), c3d10));
     }
 
-    SMDS_VolumeIteratorPtr vol_iter = myMesh->GetMeshDS()->volumesIterator();
-    std::set<int> element_nodes;
     int num_of_nodes;
-    while (vol_iter->more()) {
-        const SMDS_MeshVolume* vol = vol_iter->next();
+    for (const SMDS_MeshElement* vol :
+         getElementsByNodes(myMesh->GetMeshDS(), nodes_on_face, SMDSAbs_Volume)) {
         num_of_nodes = vol->NbNodes();
         std::pair<int, std::vector<int>> apair;
         apair.first = vol->GetID();
@@ -557,9 +750,31 @@ std::map<int, int> FemMesh::getccxVolumesByFace(const TopoDS_Face& face) const
     return result;
 }
 
+FemMesh::GeometryIndex& FemMesh::getGeometryIndex() const
+{
+    if (!geometryIndex || !geometryIndex->isValid(*this)) {
+        geometryIndex = std::make_unique<GeometryIndex>(*this);
+    }
+    return *geometryIndex;
+}
+
+void FemMesh::resetCaches()
+{
+    geometryIndex.reset();
+    lastAbaqusFile.reset();
+}
+
 std::set<int> FemMesh::getNodesBySolid(const TopoDS_Solid& solid) const
 {
+    GeometryIndex& index = getGeometryIndex();
+    if (const std::set<int>* nodes = index.findNodes(solid)) {
+        return *nodes;
+    }
+
     std::set<int> result;
+    if (index.getSubMeshNodes(*this, solid, result)) {
+        return index.storeNodes(solid, std::move(result));
+    }
 
     Bnd_Box box;
     BRepBndLib::Add(solid, box);
@@ -572,49 +787,43 @@ std::set<int> FemMesh::getNodesBySolid(const TopoDS_Solid& solid) const
                         limit,
                         limit);
 
-    // get the current transform of the FemMesh
-    const Base::Matrix4D Mtrx(getTransform());
-
-    std::vector<const SMDS_MeshNode*> nodes;
-    SMDS_NodeIteratorPtr aNodeIter = myMesh->GetMeshDS()->nodesIterator();
-    while (aNodeIter->more()) {
-        const SMDS_MeshNode* aNode = aNodeIter->next();
-        nodes.push_back(aNode);
-    }
+    // candidate nodes in absolute space
+    std::vector<GeometryIndex::Node> nodes = index.getNodes(*this, box);
 
 #pragma omp parallel for schedule(dynamic)
     for (size_t i = 0; i < nodes.size(); ++i) {
-        const SMDS_MeshNode* aNode = nodes[i];
-        double xyz[3];
-        aNode->GetXYZ(xyz);
-        Base::Vector3d vec(xyz[0], xyz[1], xyz[2]);
-        // Apply the matrix to hold the BoundBox in absolute space.
-        vec = Mtrx * vec;
-
-        if (!box.IsOut(gp_Pnt(vec.x, vec.y, vec.z))) {
-            // create a vertex
-            BRepBuilderAPI_MakeVertex aBuilder(gp_Pnt(vec.x, vec.y, vec.z));
-            TopoDS_Shape s = aBuilder.Vertex();
-            // measure distance
-            BRepExtrema_DistShapeShape measure(solid, s);
-            measure.Perform();
-            if (!measure.IsDone() || measure.NbSolution() < 1) {
-                continue;
-            }
+        const GeometryIndex::Point& pnt = nodes[i].first;
+        // create a vertex
+        BRepBuilderAPI_MakeVertex aBuilder(gp_Pnt(pnt.get<0>(), pnt.get<1>(), pnt.get<2>()));
+        TopoDS_Shape s = aBuilder.Vertex();
+        // measure distance
+        BRepExtrema_DistShapeShape measure(solid, s);
+        measure.Perform();
+        if (!measure.IsDone() || measure.NbSolution() < 1) {
+            continue;
+        }
 
-            if (measure.Value() < limit)
+        if (measure.Value() < limit)
 #pragma omp critical
-            {
-                result.insert(aNode->GetID());
-            }
+        {
+            result.insert(nodes[i].second);
         }
     }
-    return result;
+
+    return index.storeNodes(solid, std::move(result));
 }
 
 std::set<int> FemMesh::getNodesByFace(const TopoDS_Face& face) const
 {
+    GeometryIndex& index = getGeometryIndex();
+    if (const std::set<int>* nodes = index.findNodes(face)) {
+        return *nodes;
+    }
+
     std::set<int> result;
+    if (index.getSubMeshNodes(*this, face, result)) {
+        return index.storeNodes(face, std::move(result));
+    }
 
     Bnd_Box box;
     BRepBndLib::Add(
@@ -625,50 +834,43 @@ std::set<int> FemMesh::getNodesByFace(const TopoDS_Face& face) const
     double limit = BRep_Tool::Tolerance(face);
     box.Enlarge(limit);
 
-    // get the current transform of the FemMesh
-    const Base::Matrix4D Mtrx(getTransform());
-
-    std::vector<const SMDS_MeshNode*> nodes;
-    SMDS_NodeIteratorPtr aNodeIter = myMesh->GetMeshDS()->nodesIterator();
-    while (aNodeIter->more()) {
-        const SMDS_MeshNode* aNode = aNodeIter->next();
-        nodes.push_back(aNode);
-    }
+    // candidate nodes in absolute space
+    std::vector<GeometryIndex::Node> nodes = index.getNodes(*this, box);
 
 #pragma omp parallel for schedule(dynamic)
     for (size_t i = 0; i < nodes.size(); ++i) {
-        const SMDS_MeshNode* aNode = nodes[i];
-        double xyz[3];
-        aNode->GetXYZ(xyz);
-        Base::Vector3d vec(xyz[0], xyz[1], xyz[2]);
-        // Apply the matrix to hold the BoundBox in absolute space.
-        vec = Mtrx * vec;
-
-        if (!box.IsOut(gp_Pnt(vec.x, vec.y, vec.z))) {
-            // create a vertex
-            BRepBuilderAPI_MakeVertex aBuilder(gp_Pnt(vec.x, vec.y, vec.z));
-            TopoDS_Shape s = aBuilder.Vertex();
-            // measure distance
-            BRepExtrema_DistShapeShape measure(face, s);
-            measure.Perform();
-            if (!measure.IsDone() || measure.NbSolution() < 1) {
-                continue;
-            }
+        const GeometryIndex::Point& pnt = nodes[i].first;
+        // create a vertex
+        BRepBuilderAPI_MakeVertex aBuilder(gp_Pnt(pnt.get<0>(), pnt.get<1>(), pnt.get<2>()));
+        TopoDS_Shape s = aBuilder.Vertex();
+        // measure distance
+        BRepExtrema_DistShapeShape measure(face, s);
+        measure.Perform();
+        if (!measure.IsDone() || measure.NbSolution() < 1) {
+            continue;
+        }
 
-            if (measure.Value() < limit)
+        if (measure.Value() < limit)
 #pragma omp critical
-            {
-                result.insert(aNode->GetID());
-            }
+        {
+            result.insert(nodes[i].second);
         }
     }
 
-    return result;
+    return index.storeNodes(face, std::move(result));
 }
 
 std::set<int> FemMesh::getNodesByEdge(const TopoDS_Edge& edge) const
 {
+    GeometryIndex& index = getGeometryIndex();
+    if (const std::set<int>* nodes = index.findNodes(edge)) {
+        return *nodes;
+    }
+
     std::set<int> result;
+    if (index.getSubMeshNodes(*this, edge, result)) {
+        return index.storeNodes(edge, std::move(result));
+    }
 
     Bnd_Box box;
     BRepBndLib::Add(edge, box);
@@ -676,82 +878,62 @@ std::set<int> FemMesh::getNodesByEdge(const TopoDS_Edge& edge) const
     double limit = BRep_Tool::Tolerance(edge);
     box.Enlarge(limit);
 
-    // get the current transform of the FemMesh
-    const Base::Matrix4D Mtrx(getTransform());
-
-    std::vector<const SMDS_MeshNode*> nodes;
-    SMDS_NodeIteratorPtr aNodeIter = myMesh->GetMeshDS()->nodesIterator();
-    while (aNodeIter->more()) {
-        const SMDS_MeshNode* aNode = aNodeIter->next();
-        nodes.push_back(aNode);
-    }
+    // candidate nodes in absolute space
+    std::vector<GeometryIndex::Node> nodes = index.getNodes(*this, box);
 
 #pragma omp parallel for schedule(dynamic)
     for (size_t i = 0; i < nodes.size(); ++i) {
-        const SMDS_MeshNode* aNode = nodes[i];
-        double xyz[3];
-        aNode->GetXYZ(xyz);
-        Base::Vector3d vec(xyz[0], xyz[1], xyz[2]);
-        // Apply the matrix to hold the BoundBox in absolute space.
-        vec = Mtrx * vec;
-
-        if (!box.IsOut(gp_Pnt(vec.x, vec.y, vec.z))) {
-            // create a vertex
-            BRepBuilderAPI_MakeVertex aBuilder(gp_Pnt(vec.x, vec.y, vec.z));
-            TopoDS_Shape s = aBuilder.Vertex();
-            // measure distance
-            BRepExtrema_DistShapeShape measure(edge, s);
-            measure.Perform();
-            if (!measure.IsDone() || measure.NbSolution() < 1) {
-                continue;
-            }
+        const GeometryIndex::Point& pnt = nodes[i].first;
+        // create a vertex
+        BRepBuilderAPI_MakeVertex aBuilder(gp_Pnt(pnt.get<0>(), pnt.get<1>(), pnt.get<2>()));
+        TopoDS_Shape s = aBuilder.Vertex();
+        // measure distance
+        BRepExtrema_DistShapeShape measure(edge, s);
+        measure.Perform();
+        if (!measure.IsDone() || measure.NbSolution() < 1) {
+            continue;
+        }
 
-            if (measure.Value() < limit)
+        if (measure.Value() < limit)
 #pragma omp critical
-            {
-                result.insert(aNode->GetID());
-            }
+        {
+            result.insert(nodes[i].second);
         }
     }
 
-    return result;
+    return index.storeNodes(edge, std::move(result));
 }
 
 std::set<int> FemMesh::getNodesByVertex(const TopoDS_Vertex& vertex) const
 {
+    GeometryIndex& index = getGeometryIndex();
+    if (const std::set<int>* nodes = index.findNodes(vertex)) {
+        return *nodes;
+    }
+
     std::set<int> result;
+    if (index.getSubMeshNodes(*this, vertex, result)) {
+        return index.storeNodes(vertex, std::move(result));
+    }
 
     double limit = BRep_Tool::Tolerance(vertex);
-    limit *= limit;  // use square to improve speed
     gp_Pnt pnt = BRep_Tool::Pnt(vertex);
     Base::Vector3d node(pnt.X(), pnt.Y(), pnt.Z());
 
-    // get the current transform of the FemMesh
-    const Base::Matrix4D Mtrx(getTransform());
-
-    std::vector<const SMDS_MeshNode*> nodes;
-    SMDS_NodeIteratorPtr aNodeIter = myMesh->GetMeshDS()->nodesIterator();
-    while (aNodeIter->more()) {
-        const SMDS_MeshNode* aNode = aNodeIter->next();
-        nodes.push_back(aNode);
-    }
-
-#pragma omp parallel for schedule(dynamic)
-    for (size_t i = 0; i < nodes.size(); ++i) {
-        const SMDS_MeshNode* aNode = nodes[i];
-        double xyz[3];
-        aNode->GetXYZ(xyz);
-        Base::Vector3d vec(xyz[0], xyz[1], xyz[2]);
-        vec = Mtrx * vec;
+    Bnd_Box box;
+    box.Add(pnt);
+    box.Enlarge(limit);
+    limit *= limit;  // use square to improve speed
 
-        if (Base::DistanceP2(node, vec) <= limit)
-#pragma omp critical
-        {
-            result.insert(aNode->GetID());
+    // candidate nodes in absolute space
+    for (const auto& it : index.getNodes(*this, box)) {
+        Base::Vector3d vec(it.first.get<0>(), it.first.get<1>(), it.first.get<2>());
+        if (Base::DistanceP2(node, vec) <= limit) {
+            result.insert(it.second);
         }
     }
 
-    return result;
+    return index.storeNodes(vertex, std::move(result));
 }
 
 std::list<int> FemMesh::getElementNodes(int id) const
@@ -1601,6 +1783,7 @@ void FemMesh::read(const char* FileName)
 {
     Base::FileInfo File(FileName);
     _Mtrx = Base::Matrix4D();
+    resetCaches();
 
     // checking on the file
     if (!File.isReadable()) {
@@ -1652,6 +1835,92 @@ void FemMesh::writeVTK(const std::string& fileName, bool highest) const
     FemVTKTools::writeVTKMesh(fileName.c_str(), this, highest);
 }
 
+namespace
+{
+/// flat table of elements of one type, each stored as element ID followed by its node IDs
+struct ElementTable
+{
+    std::size_t stride {0};
+    std::vector<int> data;
+
+    std::size_t size() const
+    {
+        return stride > 0 ? data.size() / stride : 0;
+    }
+
+    void sort()
+    {
+        std::vector<std::size_t> index(size());
+        std::iota(index.begin(), index.end(), 0);
+        auto byId = [this](std::size_t lhs, std::size_t rhs) {
+            return data[lhs * stride] < data[rhs * stride];
+        };
+        if (std::is_sorted(index.begin(), index.end(), byId)) {
+            return;
+        }
+        std::sort(index.begin(), index.end(), byId);
+
+        std::vector<int> sorted;
+        sorted.reserve(data.size());
+        for (std::size_t i : index) {
+            auto first = data.begin() + static_cast<std::ptrdiff_t>(i * stride);
+            sorted.insert(sorted.end(), first, first + static_cast<std::ptrdiff_t>(stride));
+        }
+        data.swap(sorted);
+    }
+};
+
+/*!
+ * Formats \a count entries with \a format into blocks of memory and writes them in order to
+ * \a out. If OpenMP is available several blocks are formatted concurrently.
+ */
+template<typename Format>
+void writeBlocks(std::ostream& out, std::size_t count, Format format)
+{
+    constexpr std::size_t blockSize = 16384;
+    constexpr int numBuffers = 16;
+    const int numBlocks = static_cast<int>((count + blockSize - 1) / blockSize);
+
+    std::vector<fmt::memory_buffer> buffers(numBuffers);
+    for (int first = 0; first < numBlocks; first += numBuffers) {
+        const int last = std::min(first + numBuffers, numBlocks);
+
+#pragma omp parallel for schedule(dynamic)
+        for (int block = first; block < last; ++block) {
+            fmt::memory_buffer& buffer = buffers[block - first];
+            buffer.clear();
+            std::size_t end = std::min(count, (block + 1) * blockSize);
+            for (std::size_t i = block * blockSize; i < end; ++i) {
+                format(buffer, i);
+            }
+        }
+
+        for (int block = first; block < last; ++block) {
+            const fmt::memory_buffer& buffer = buffers[block - first];
+            out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        }
+    }
+}
+}  // namespace
+
+struct FemMesh::AbaqusFile
+{
+    Signature signature;
+    std::string fileName;
+    std::string parameters;
+    Base::TimeInfo modified;
+    unsigned int size;
+
+    bool isUpToDate(const FemMesh& mesh,
+                    const Base::FileInfo& fi,
+                    const std::string& params) const
+    {
+        return fileName == fi.filePath() && parameters == params && fi.exists()
+            && modified == fi.lastModified() && size == fi.size()
+            && signature == Signature(mesh);
+    }
+};
+
 void FemMesh::writeABAQUS(const std::string& Filename,
                           int elemParam,
                           bool groupParam,
@@ -1673,6 +1942,21 @@ void FemMesh::writeABAQUS(const std::string& Filename,
      * Element type according to availability in CalculiX
      */
 
+    // The CalculiX writer rewrites the mesh on every solver run, skip this if the mesh file
+    // written by the previous call is still in place and the mesh hasn't changed since
+    Base::FileInfo fi(Filename);
+    std::string parameters = fmt::format("{} {} {} {} {}",
+                                         elemParam,
+                                         groupParam,
+                                         static_cast<int>(volVariant),
+                                         static_cast<int>(faceVariant),
+                                         static_cast<int>(edgeVariant));
+    if (lastAbaqusFile && lastAbaqusFile->isUpToDate(*this, fi, parameters)) {
+        Base::Console().Log("FemMesh::writeABAQUS(): mesh is unchanged, keep %s\n",
+                            fi.filePath().c_str());
+        return;
+    }
+
     std::map<std::string, std::string> variants;
 
     // volume elements
@@ -1883,37 +2167,48 @@ void FemMesh::writeABAQUS(const std::string& Filename,
 
 
     // get all data --> Extract Nodes and Elements of the current SMESH datastructure
-    using VertexMap = std::map<int, Base::Vector3d>;
-    using NodesMap = std::map<int, std::vector<int>>;
-    using ElementsMap = std::map<std::string, NodesMap>;
+    // The element tables hold the element ID followed by the reordered node IDs
+    using ElementsMap = std::map<std::string, ElementTable>;
+    const SMESHDS_Mesh* meshDS = myMesh->GetMeshDS();
+
+    auto addElement = [&elemOrderMap](ElementsMap& elementsMap,
+                                      const std::map<int, std::string>& typeMap,
+                                      const SMDS_MeshElement* aElem) {
+        auto it = typeMap.find(aElem->NbNodes());
+        if (it != typeMap.end()) {
+            const std::vector<int>& order = elemOrderMap[it->second];
+            ElementTable& table = elementsMap[it->second];
+            table.stride = order.size() + 1;
+            table.data.push_back(aElem->GetID());
+            for (int jt : order) {
+                table.data.push_back(aElem->GetNode(jt)->GetID());
+            }
+        }
+    };
 
     // get nodes
-    VertexMap vertexMap;  // empty nodes map
-    SMDS_NodeIteratorPtr aNodeIter = myMesh->GetMeshDS()->nodesIterator();
-    Base::Vector3d current_node;
+    std::vector<std::pair<int, Base::Vector3d>> nodes;
+    nodes.reserve(meshDS->NbNodes());
+    SMDS_NodeIteratorPtr aNodeIter = meshDS->nodesIterator();
     while (aNodeIter->more()) {
         const SMDS_MeshNode* aNode = aNodeIter->next();
-        current_node.Set(aNode->X(), aNode->Y(), aNode->Z());
-        current_node = _Mtrx * current_node;
-        vertexMap[aNode->GetID()] = current_node;
+        nodes.emplace_back(aNode->GetID(),
+                           _Mtrx * Base::Vector3d(aNode->X(), aNode->Y(), aNode->Z()));
+    }
+    // This way we get sorted output.
+    // See https://forum.freecad.org/viewtopic.php?f=18&t=12646&start=40#p103004
+    auto byId = [](const auto& lhs, const auto& rhs) {
+        return lhs.first < rhs.first;
+    };
+    if (!std::is_sorted(nodes.begin(), nodes.end(), byId)) {
+        std::sort(nodes.begin(), nodes.end(), byId);
     }
 
     // get volumes
     ElementsMap elementsMapVol;  // empty volumes map
-    SMDS_VolumeIteratorPtr aVolIter = myMesh->GetMeshDS()->volumesIterator();
+    SMDS_VolumeIteratorPtr aVolIter = meshDS->volumesIterator();
     while (aVolIter->more()) {
-        const SMDS_MeshVolume* aVol = aVolIter->next();
-        std::pair<int, std::vector<int>> apair;
-        apair.first = aVol->GetID();
-        int numNodes = aVol->NbNodes();
-        std::map<int, std::string>::iterator it = volTypeMap.find(numNodes);
-        if (it != volTypeMap.end()) {
-            const std::vector<int>& order = elemOrderMap[it->second];
-            for (int jt : order) {
-                apair.second.push_back(aVol->GetNode(jt)->GetID());
-            }
-            elementsMapVol[it->second].insert(apair);
-        }
+        addElement(elementsMapVol, volTypeMap, aVolIter->next());
     }
 
     // get faces
@@ -1922,38 +2217,16 @@ void FemMesh::writeABAQUS(const std::string& Filename,
     if ((elemParam == 0) || (elemParam == 1 && elementsMapVol.empty())) {
         // for elemParam = 1 we only fill the elementsMapFac if the elmentsMapVol is empty
         // we're going to fill the elementsMapFac with all faces
-        SMDS_FaceIteratorPtr aFaceIter = myMesh->GetMeshDS()->facesIterator();
+        SMDS_FaceIteratorPtr aFaceIter = meshDS->facesIterator();
         while (aFaceIter->more()) {
-            const SMDS_MeshFace* aFace = aFaceIter->next();
-            std::pair<int, std::vector<int>> apair;
-            apair.first = aFace->GetID();
-            int numNodes = aFace->NbNodes();
-            std::map<int, std::string>::iterator it = faceTypeMap.find(numNodes);
-            if (it != faceTypeMap.end()) {
-                const std::vector<int>& order = elemOrderMap[it->second];
-                for (int jt : order) {
-                    apair.second.push_back(aFace->GetNode(jt)->GetID());
-                }
-                elementsMapFac[it->second].insert(apair);
-            }
+            addElement(elementsMapFac, faceTypeMap, aFaceIter->next());
         }
     }
     if (elemParam == 2) {
         // we're going to fill the elementsMapFac with the facesOnly
         std::set<int> facesOnly = getFacesOnly();
         for (int itfa : facesOnly) {
-            std::pair<int, std::vector<int>> apair;
-            apair.first = itfa;
-            const SMDS_MeshElement* aFace = myMesh->GetMeshDS()->FindElement(itfa);
-            int numNodes = aFace->NbNodes();
-            std::map<int, std::string>::iterator it = faceTypeMap.find(numNodes);
-            if (it != faceTypeMap.end()) {
-                const std::vector<int>& order = elemOrderMap[it->second];
-                for (int jt : order) {
-                    apair.second.push_back(aFace->GetNode(jt)->GetID());
-                }
-                elementsMapFac[it->second].insert(apair);
-            }
+            addElement(elementsMapFac, faceTypeMap, meshDS->FindElement(itfa));
         }
     }
 
@@ -1963,64 +2236,42 @@ void FemMesh::writeABAQUS(const std::string& Filename,
     if ((elemParam == 0) || (elemParam == 1 && elementsMapVol.empty() && elementsMapFac.empty())) {
         // for elemParam = 1 we only fill the elementsMapEdg if the elmentsMapVol
         // and elmentsMapFac are empty we're going to fill the elementsMapEdg with all edges
-        SMDS_EdgeIteratorPtr aEdgeIter = myMesh->GetMeshDS()->edgesIterator();
+        SMDS_EdgeIteratorPtr aEdgeIter = meshDS->edgesIterator();
         while (aEdgeIter->more()) {
-            const SMDS_MeshEdge* aEdge = aEdgeIter->next();
-            std::pair<int, std::vector<int>> apair;
-            apair.first = aEdge->GetID();
-            int numNodes = aEdge->NbNodes();
-            std::map<int, std::string>::iterator it = edgeTypeMap.find(numNodes);
-            if (it != edgeTypeMap.end()) {
-                const std::vector<int>& order = elemOrderMap[it->second];
-                for (int jt : order) {
-                    apair.second.push_back(aEdge->GetNode(jt)->GetID());
-                }
-                elementsMapEdg[it->second].insert(apair);
-            }
+            addElement(elementsMapEdg, edgeTypeMap, aEdgeIter->next());
         }
     }
     if (elemParam == 2) {
         // we're going to fill the elementsMapEdg with the edgesOnly
         std::set<int> edgesOnly = getEdgesOnly();
         for (int ited : edgesOnly) {
-            std::pair<int, std::vector<int>> apair;
-            apair.first = ited;
-            const SMDS_MeshElement* aEdge = myMesh->GetMeshDS()->FindElement(ited);
-            int numNodes = aEdge->NbNodes();
-            std::map<int, std::string>::iterator it = edgeTypeMap.find(numNodes);
-            if (it != edgeTypeMap.end()) {
-                const std::vector<int>& order = elemOrderMap[it->second];
-                for (int jt : order) {
-                    apair.second.push_back(aEdge->GetNode(jt)->GetID());
-                }
-                elementsMapEdg[it->second].insert(apair);
-            }
+            addElement(elementsMapEdg, edgeTypeMap, meshDS->FindElement(ited));
+        }
+    }
+
+    for (ElementsMap* elementsMap : {&elementsMapVol, &elementsMapFac, &elementsMapEdg}) {
+        for (auto& it : *elementsMap) {
+            it.second.sort();
         }
     }
 
     // write all data to file
     // take also care of special characters in path
     // https://forum.freecad.org/viewtopic.php?f=10&t=37436
-    Base::FileInfo fi(Filename);
     Base::ofstream anABAQUS_Output(fi);
-    // https://forum.freecad.org/viewtopic.php?f=18&t=22759#p176669
-    anABAQUS_Output.precision(13);
 
     // add some text and make sure one of the known elemParam values is used
-    anABAQUS_Output << "** written by FreeCAD inp file writer for CalculiX,Abaqus meshes"
-                    << std::endl;
+    anABAQUS_Output << "** written by FreeCAD inp file writer for CalculiX,Abaqus meshes\n";
     switch (elemParam) {
         case 0:
-            anABAQUS_Output << "** all mesh elements." << std::endl << std::endl;
+            anABAQUS_Output << "** all mesh elements.\n\n";
             break;
         case 1:
-            anABAQUS_Output << "** highest dimension mesh elements only." << std::endl << std::endl;
+            anABAQUS_Output << "** highest dimension mesh elements only.\n\n";
             break;
         case 2:
             anABAQUS_Output << "** FEM mesh elements only (edges if they do not belong to faces "
-                               "and faces if they do not belong to volumes)."
-                            << std::endl
-                            << std::endl;
+                               "and faces if they do not belong to volumes).\n\n";
             break;
         default:
             anABAQUS_Output << "** Problem on writing" << std::endl;
@@ -2030,11 +2281,12 @@ void FemMesh::writeABAQUS(const std::string& Filename,
     }
 
     // write nodes
-    anABAQUS_Output << "** Nodes" << std::endl;
-    anABAQUS_Output << "*Node, NSET=Nall" << std::endl;
+    anABAQUS_Output << "** Nodes\n";
+    anABAQUS_Output << "*Node, NSET=Nall\n";
 
     // Axisymmetric, plane strain and plane stress elements expect nodes in the plane z=0.
     // Set the z coordinate to 0 to avoid possible rounding errors.
+    std::vector<bool> inPlane;
     switch (faceVariant) {
         case ABAQUS_FaceVariant::Stress:
         case ABAQUS_FaceVariant::Stress_Reduced:
@@ -2042,12 +2294,12 @@ void FemMesh::writeABAQUS(const std::string& Filename,
         case ABAQUS_FaceVariant::Strain_Reduced:
         case ABAQUS_FaceVariant::Axisymmetric:
         case ABAQUS_FaceVariant::Axisymmetric_Reduced:
+            inPlane.resize(meshDS->MaxNodeID() + 1, false);
             for (const auto& elMap : elementsMapFac) {
-                const NodesMap& nodeMap = elMap.second;
-                for (const auto& nodes : nodeMap) {
-                    for (int n : nodes.second) {
-                        Base::Vector3d& vertex = vertexMap[n];
-                        vertex.z = 0.0;
+                const ElementTable& table = elMap.second;
+                for (std::size_t i = 0; i < table.data.size(); i += table.stride) {
+                    for (std::size_t j = 1; j < table.stride; ++j) {
+                        inPlane[table.data[i + j]] = true;
                     }
                 }
             }
@@ -2056,60 +2308,57 @@ void FemMesh::writeABAQUS(const std::string& Filename,
             break;
     }
 
-    // This way we get sorted output.
-    // See https://forum.freecad.org/viewtopic.php?f=18&t=12646&start=40#p103004
-    for (const auto& it : vertexMap) {
-        anABAQUS_Output << it.first << ", " << it.second.x << ", " << it.second.y << ", "
-                        << it.second.z << std::endl;
-    }
-    anABAQUS_Output << std::endl << std::endl;
-    ;
-
+    // https://forum.freecad.org/viewtopic.php?f=18&t=22759#p176669
+    // the coordinates are written with 13 significant digits
+    writeBlocks(anABAQUS_Output, nodes.size(), [&](fmt::memory_buffer& buffer, std::size_t i) {
+        const auto& it = nodes[i];
+        bool zero = !inPlane.empty() && inPlane[it.first];
+        fmt::format_to(std::back_inserter(buffer),
+                       "{}, {:.13g}, {:.13g}, {:.13g}\n",
+                       it.first,
+                       it.second.x,
+                       it.second.y,
+                       zero ? 0.0 : it.second.z);
+    });
+    anABAQUS_Output << "\n\n";
+
+    // Calculix allows max 16 entries in one line, a hexa20 has more !
+    auto writeElements = [&anABAQUS_Output](const ElementTable& table, bool wrapLines) {
+        writeBlocks(anABAQUS_Output,
+                    table.size(),
+                    [&table, wrapLines](fmt::memory_buffer& buffer, std::size_t i) {
+                        const int* elem = &table.data[i * table.stride];
+                        fmt::format_to(std::back_inserter(buffer), "{}", elem[0]);
+                        for (std::size_t k = 1; k < table.stride; ++k) {
+                            if (wrapLines && k == 16) {
+                                fmt::format_to(std::back_inserter(buffer), ",\n{}", elem[k]);
+                            }
+                            else {
+                                fmt::format_to(std::back_inserter(buffer), ", {}", elem[k]);
+                            }
+                        }
+                        buffer.push_back('\n');
+                    });
+    };
 
     // write volumes to file
     std::string elsetname;
     if (!elementsMapVol.empty()) {
         for (const auto& it : elementsMapVol) {
-            anABAQUS_Output << "** Volume elements" << std::endl;
-            anABAQUS_Output << "*Element, TYPE=" << it.first << ", ELSET=Evolumes" << std::endl;
-            for (const auto& jt : it.second) {
-                anABAQUS_Output << jt.first;
-                // Calculix allows max 16 entries in one line, a hexa20 has more !
-                int ct = 0;  // counter
-                bool first_line = true;
-                for (auto kt = jt.second.begin(); kt != jt.second.end(); ++kt, ++ct) {
-                    if (ct < 15) {
-                        anABAQUS_Output << ", " << *kt;
-                    }
-                    else {
-                        if (first_line) {
-                            anABAQUS_Output << "," << std::endl << *kt;
-                            first_line = false;
-                        }
-                        else {
-                            anABAQUS_Output << ", " << *kt;
-                        }
-                    }
-                }
-                anABAQUS_Output << std::endl;
-            }
+            anABAQUS_Output << "** Volume elements\n";
+            anABAQUS_Output << "*Element, TYPE=" << it.first << ", ELSET=Evolumes\n";
+            writeElements(it.second, true);
         }
         elsetname += "Evolumes";
-        anABAQUS_Output << std::endl;
+        anABAQUS_Output << '\n';
     }
 
     // write faces to file
     if (!elementsMapFac.empty()) {
         for (const auto& it : elementsMapFac) {
-            anABAQUS_Output << "** Face elements" << std::endl;
-            anABAQUS_Output << "*Element, TYPE=" << it.first << ", ELSET=Efaces" << std::endl;
-            for (const auto& jt : it.second) {
-                anABAQUS_Output << jt.first;
-                for (int kt : jt.second) {
-                    anABAQUS_Output << ", " << kt;
-                }
-                anABAQUS_Output << std::endl;
-            }
+            anABAQUS_Output << "** Face elements\n";
+            anABAQUS_Output << "*Element, TYPE=" << it.first << ", ELSET=Efaces\n";
+            writeElements(it.second, false);
         }
         if (elsetname.empty()) {
             elsetname += "Efaces";
@@ -2117,21 +2366,15 @@ void FemMesh::writeABAQUS(const std::string& Filename,
         else {
             elsetname += ", Efaces";
         }
-        anABAQUS_Output << std::endl;
+        anABAQUS_Output << '\n';
     }
 
     // write edges to file
     if (!elementsMapEdg.empty()) {
         for (const auto& it : elementsMapEdg) {
-            anABAQUS_Output << "** Edge elements" << std::endl;
-            anABAQUS_Output << "*Element, TYPE=" << it.first << ", ELSET=Eedges" << std::endl;
-            for (const auto& jt : it.second) {
-                anABAQUS_Output << jt.first;
-                for (int kt : jt.second) {
-                    anABAQUS_Output << ", " << kt;
-                }
-                anABAQUS_Output << std::endl;
-            }
+            anABAQUS_Output << "** Edge elements\n";
+            anABAQUS_Output << "*Element, TYPE=" << it.first << ", ELSET=Eedges\n";
+            writeElements(it.second, false);
         }
         if (elsetname.empty()) {
             elsetname += "Eedges";
@@ -2139,21 +2382,18 @@ void FemMesh::writeABAQUS(const std::string& Filename,
         else {
             elsetname += ", Eedges";
         }
-        anABAQUS_Output << std::endl;
+        anABAQUS_Output << '\n';
     }
 
     // write elset Eall
-    anABAQUS_Output << "** Define element set Eall" << std::endl;
-    anABAQUS_Output << "*ELSET, ELSET=Eall" << std::endl;
-    anABAQUS_Output << elsetname << std::endl;
+    anABAQUS_Output << "** Define element set Eall\n";
+    anABAQUS_Output << "*ELSET, ELSET=Eall\n";
+    anABAQUS_Output << elsetname << '\n';
 
     // groups
-    if (!groupParam) {
-        anABAQUS_Output.close();
-    }
-    else {
+    if (groupParam) {
         // get and write group data
-        anABAQUS_Output << std::endl << "** Group data" << std::endl;
+        anABAQUS_Output << "\n** Group data\n";
 
         std::list<int> groupIDs = myMesh->GetGroupIds();
         for (int it : groupIDs) {
@@ -2191,13 +2431,13 @@ void FemMesh::writeABAQUS(const std::string& Filename,
             }
             const char* groupName = myMesh->GetGroup(it)->GetName();
             anABAQUS_Output << "** GroupID: " << (it) << " --> GroupName: " << groupName
-                            << " --> GroupElementType: " << groupElementType << std::endl;
+                            << " --> GroupElementType: " << groupElementType << '\n';
 
             if (aElementType == SMDSAbs_Node) {
-                anABAQUS_Output << "*NSET, NSET=" << groupName << std::endl;
+                anABAQUS_Output << "*NSET, NSET=" << groupName << '\n';
             }
             else {
-                anABAQUS_Output << "*ELSET, ELSET=" << groupName << std::endl;
+                anABAQUS_Output << "*ELSET, ELSET=" << groupName << '\n';
             }
 
             // get and write group elements
@@ -2207,15 +2447,25 @@ void FemMesh::writeABAQUS(const std::string& Filename,
                 const SMDS_MeshElement* aElement = aElemIter->next();
                 ids.insert(aElement->GetID());
             }
+            fmt::memory_buffer buffer;
             for (int it : ids) {
-                anABAQUS_Output << it << std::endl;
+                fmt::format_to(std::back_inserter(buffer), "{}\n", it);
             }
+            anABAQUS_Output.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
 
             // write newline after each group
-            anABAQUS_Output << std::endl;
+            anABAQUS_Output << '\n';
         }
-        anABAQUS_Output.close();
     }
+    anABAQUS_Output.close();
+
+    if (anABAQUS_Output.fail()) {
+        throw Base::FileException("Failed to write ABAQUS file", fi);
+    }
+
+    // remember the file to skip writing it again as long as neither mesh nor file change
+    lastAbaqusFile = std::make_unique<AbaqusFile>(
+        AbaqusFile {Signature(*this), fi.filePath(), parameters, fi.lastModified(), fi.size()});
 }
 
 
@@ -2397,6 +2647,7 @@ void FemMesh::RestoreDocFile(Base::Reader& reader)
     file.close();
 
     // read the shape from the temp file
+    resetCaches();
     myMesh->UNVToMesh(fi.filePath().c_str());
 
     // delete the temp file
@@ -2406,6 +2657,7 @@ void FemMesh::RestoreDocFile(Base::Reader& reader)
 void FemMesh::transformGeometry(const Base::Matrix4D& rclTrf)
 {
     // We perform a translation and rotation of the current active Mesh object
+    resetCaches();
     Base::Matrix4D clMatrix(rclTrf);
     SMDS_NodeIteratorPtr aNodeIter = myMesh->GetMeshDS()->nodesIterator();
     Base::Vector3d current_node;
@@ -2420,6 +2672,7 @@ void FemMesh::transformGeometry(const Base::Matrix4D& rclTrf)
 void FemMesh::setTransform(const Base::Matrix4D& rclTrf)
 {
     // Placement handling, no geometric transformation
+    resetCaches();
     _Mtrx = rclTrf;
 }
 
@@ -2621,6 +2874,9 @@ Base::Quantity FemMesh::getVolume() const
 
 int FemMesh::addGroup(const std::string TypeString, const std::string Name, const int theId)
 {
+    // the group data is not covered by the mesh signature
+    lastAbaqusFile.reset();
+
     // define mapping between typestring and ElementType
     // TODO: remove code doubling by providing mappings for all FemMesh functions
     using string_eltype_map = std::map<std::string, SMDSAbs_ElementType>;
@@ -2661,6 +2917,7 @@ int FemMesh::addGroup(const std::string TypeString, const std::string Name, cons
 
 void FemMesh::addGroupElements(int GroupId, const std::set<int>& ElementIds)
 {
+    lastAbaqusFile.reset();
     SMESH_Group* group = this->getSMesh()->GetGroup(GroupId);
     if (!group) {
         throw std::runtime_error("AddGroupElements: No group for given id.");
@@ -2690,5 +2947,6 @@ void FemMesh::addGroupElements(int GroupId, const std::set<int>& ElementIds)
 
 bool FemMesh::removeGroup(int GroupId)
 {
+    lastAbaqusFile.reset();
     return this->getSMesh()->RemoveGroup(GroupId);
 }
@@ -220,6 +220,14 @@ private:
     void readZ88(const std::string& Filename);
     void readAbaqus(const std::string& Filename);
 
+    class Signature;
+    class GeometryIndex;
+    struct AbaqusFile;
+    /// node to sub-shape association, (re)built on demand when the mesh has changed
+    GeometryIndex& getGeometryIndex() const;
+    /// drop all data derived from the mesh
+    void resetCaches();
+
 private:
     /// positioning matrix
     Base::Matrix4D _Mtrx;
@@ -228,6 +236,10 @@ private:
 
     std::list<SMESH_HypothesisPtr> hypoth;
     static SMESH_Gen* _mesh_gen;
+
+    mutable std::unique_ptr<GeometryIndex> geometryIndex;
+    /// the last file written by writeABAQUS(), to skip rewriting an unchanged mesh
+    mutable std::unique_ptr<AbaqusFile> lastAbaqusFile;
 };
 
 
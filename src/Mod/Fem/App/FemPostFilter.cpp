@@ -24,13 +24,18 @@
 
 #ifndef _PreComp_
 #include <Python.h>
+#include <QCoreApplication>
+#include <QtConcurrentRun>
 #include <vtkDoubleArray.h>
 #include <vtkPointData.h>
 #endif
 
+#include <App/Application.h>
 #include <App/Document.h>
+#include <Base/Console.h>
 
 #include "FemPostFilter.h"
+#include "FemPostFilterPy.h"
 #include "FemPostPipeline.h"
 
 
@@ -45,7 +50,10 @@ FemPostFilter::FemPostFilter()
     ADD_PROPERTY(Input, (nullptr));
 }
 
-FemPostFilter::~FemPostFilter() = default;
+FemPostFilter::~FemPostFilter()
+{
+    cancelUpdate();
+}
 
 void FemPostFilter::addFilterPipeline(const FemPostFilter::FilterPipeline& p, std::string name)
 {
@@ -60,6 +68,7 @@ FemPostFilter::FilterPipeline& FemPostFilter::getFilterPipeline(std::string name
 void FemPostFilter::setActiveFilterPipeline(std::string name)
 {
     if (m_activePipeline != name && isValid()) {
+        cancelUpdate();
         m_activePipeline = name;
     }
 }
@@ -73,21 +82,153 @@ DocumentObjectExecReturn* FemPostFilter::execute()
             return StdReturn;
         }
 
+        // the input filter is still busy, it recomputes us once its data is ready
+        auto input = Input.getValue<FemPostFilter*>();
+        if (input && input->isUpdating()) {
+            return StdReturn;
+        }
+
+        cancelUpdate();
+
+        // VTK only re-executes the algorithms whose input or settings were modified since
+        // the last update, and setOutput() skips the copy if nothing was re-executed.
+        // Hence a recompute triggered by an unrelated change is cheap and does not invalidate
+        // the filters further down the chain.
         if ((m_activePipeline == "DataAlongLine") || (m_activePipeline == "DataAtPoint")) {
-            pipe.filterSource->SetSourceData(getInputData());
+            pipe.filterSource->SetSourceData(data);
             pipe.filterTarget->Update();
-            Data.setValue(pipe.filterTarget->GetOutputDataObject(0));
+            setOutput(pipe.filterTarget->GetOutputDataObject(0));
         }
         else {
             pipe.source->SetInputDataObject(data);
-            pipe.target->Update();
-            Data.setValue(pipe.target->GetOutputDataObject(0));
+
+            // the result of a background update is handed over by the event loop, without one
+            // (e.g. FreeCADCmd) the update is done synchronously like the TechDraw projections
+            ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+                "User parameter:BaseApp/Preferences/Mod/Fem/General");
+            if (canUpdateInBackground() && QCoreApplication::instance()
+                && hGrp->GetBool("PostUpdateInBackground", false)) {
+                startUpdate(pipe.target);
+            }
+            else {
+                pipe.target->Update();
+                setOutput(pipe.target->GetOutputDataObject(0));
+            }
         }
     }
 
     return StdReturn;
 }
 
+PyObject* FemPostFilter::getPyObject()
+{
+    if (PythonObject.is(Py::_None())) {
+        // ref counter is set to 1
+        PythonObject = Py::Object(new FemPostFilterPy(this), true);
+    }
+    return Py::new_reference_to(PythonObject);
+}
+
+void FemPostFilter::setOutput(vtkDataObject* output)
+{
+    if (output && output == m_output && output->GetMTime() == m_outputTime && Data.getValue()) {
+        return;
+    }
+
+    m_output = output;
+    m_outputTime = output ? output->GetMTime() : 0;
+    Data.setValue(output);
+}
+
+bool FemPostFilter::isUpdating() const
+{
+    return m_updateTarget != nullptr;
+}
+
+void FemPostFilter::startUpdate(vtkAlgorithm* target)
+{
+    m_updateTarget = target;
+    // note that &m_updateWatcher in the third parameter is not strictly required, but using the
+    // 4 parameter signature instead of the 3 parameter signature prevents clazy warning:
+    // https://github.com/KDE/clazy/blob/1.11/docs/checks/README-connect-3arg-lambda.md
+    m_updateConnection = QObject::connect(&m_updateWatcher,
+                                          &QFutureWatcherBase::finished,
+                                          &m_updateWatcher,
+                                          [this] {
+                                              this->onUpdateFinished();
+                                          });
+
+    auto lambda = [target] {
+        target->Update();
+    };
+    m_updateFuture = QtConcurrent::run(std::move(lambda));
+    m_updateWatcher.setFuture(m_updateFuture);
+}
+
+void FemPostFilter::onUpdateFinished()
+{
+    QObject::disconnect(m_updateConnection);
+    vtkSmartPointer<vtkAlgorithm> target = m_updateTarget;
+    m_updateTarget = nullptr;
+    if (!target) {
+        return;
+    }
+
+    setOutput(target->GetOutputDataObject(0));
+
+    // the filters using our output were skipped while we were busy
+    for (auto obj : getInList()) {
+        auto filter = dynamic_cast<FemPostFilter*>(obj);
+        if (filter && filter->Input.getValue() == this) {
+            filter->recomputeFeature();
+        }
+    }
+}
+
+void FemPostFilter::cancelUpdate()
+{
+    if (!m_updateTarget) {
+        return;
+    }
+
+    QObject::disconnect(m_updateConnection);
+    vtkSmartPointer<vtkAlgorithm> target = m_updateTarget;
+    m_updateTarget = nullptr;
+    if (!m_updateFuture.isFinished()) {
+        // the algorithms check the flag while they iterate over the cells
+        std::vector<vtkAlgorithm*> algorithms;
+        for (const auto& it : m_pipelines) {
+            for (const auto& algorithm : it.second.algorithmStorage) {
+                algorithms.push_back(algorithm);
+            }
+            algorithms.push_back(it.second.source);
+            algorithms.push_back(it.second.target);
+        }
+        for (auto algorithm : algorithms) {
+            if (algorithm) {
+                algorithm->SetAbortExecute(1);
+            }
+        }
+        m_updateFuture.waitForFinished();
+        for (auto algorithm : algorithms) {
+            if (algorithm) {
+                algorithm->SetAbortExecute(0);
+            }
+        }
+        // the output of an aborted update is incomplete, force the next update to re-execute
+        target->Modified();
+        Base::Console().Log("Background update of %s cancelled\n", getFullName().c_str());
+    }
+}
+
+void FemPostFilter::onBeforeChange(const App::Property* prop)
+{
+    // the derived filters pass property changes straight to the VTK algorithms, which must not
+    // happen while they are executed
+    cancelUpdate();
+    Fem::FemPostObject::onBeforeChange(prop);
+}
+
 vtkDataObject* FemPostFilter::getInputData()
 {
     if (Input.getValue()) {
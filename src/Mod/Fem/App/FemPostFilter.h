@@ -36,6 +36,9 @@
 #include <vtkVectorNorm.h>
 #include <vtkWarpVector.h>
 
+#include <QFuture>
+#include <QFutureWatcher>
+
 #include <App/PropertyUnits.h>
 #include <App/DocumentObjectExtension.h>
 
@@ -57,9 +60,22 @@ public:
     App::PropertyLink Input;
 
     App::DocumentObjectExecReturn* execute() override;
+    PyObject* getPyObject() override;
+
+    /// true while the filter pipeline is updated in a background thread
+    bool isUpdating() const;
+    /// abort a running background update and wait for the thread to return
+    void cancelUpdate();
 
 protected:
     vtkDataObject* getInputData();
+    void onBeforeChange(const App::Property* prop) override;
+    /// whether execute() may update the pipeline in a background thread, filters that
+    /// post-process their output within execute() must return false
+    virtual bool canUpdateInBackground() const
+    {
+        return true;
+    }
 
     // pipeline handling for derived filter
     struct FilterPipeline
@@ -74,9 +90,23 @@ protected:
     FilterPipeline& getFilterPipeline(std::string name);
 
 private:
+    /// copy the output of the pipeline into Data, unless it did not change since the last call
+    void setOutput(vtkDataObject* output);
+    void startUpdate(vtkAlgorithm* target);
+    void onUpdateFinished();
+
     // handling of multiple pipelines which can be the filter
     std::map<std::string, FilterPipeline> m_pipelines;
     std::string m_activePipeline;
+
+    // the pipeline output last copied into Data and its modification time
+    vtkDataObject* m_output = nullptr;
+    vtkMTimeType m_outputTime = 0;
+
+    vtkSmartPointer<vtkAlgorithm> m_updateTarget;
+    QFuture<void> m_updateFuture;
+    QFutureWatcher<void> m_updateWatcher;
+    QMetaObject::Connection m_updateConnection;
 };
 
 class FemExport FemPostSmoothFilterExtension: public App::DocumentObjectExtension
@@ -243,6 +273,11 @@ public:
 protected:
     App::DocumentObjectExecReturn* execute() override;
     void onChanged(const App::Property* prop) override;
+    bool canUpdateInBackground() const override
+    {
+        // the contour field is removed from the input again after the update
+        return false;
+    }
 
     void recalculateContours(double min, double max);
     void refreshFields();
@@ -0,0 +1,70 @@
+/**************************************************************************
+ *                                                                         *
+ *   Copyright (c) 2024 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#include "PreCompiled.h"
+#ifndef _PreComp_
+#include <Python.h>
+#endif
+
+// clang-format off
+#include "FemPostFilter.h"
+#include "FemPostFilterPy.h"
+#include "FemPostFilterPy.cpp"
+// clang-format on
+
+
+using namespace Fem;
+
+// returns a string which represents the object e.g. when printed in python
+std::string FemPostFilterPy::representation() const
+{
+    return {"<FemPostFilter object>"};
+}
+
+PyObject* FemPostFilterPy::isUpdating(PyObject* args) const
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+
+    return Py::new_reference_to(Py::Boolean(getFemPostFilterPtr()->isUpdating()));
+}
+
+PyObject* FemPostFilterPy::cancelUpdate(PyObject* args)
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+
+    getFemPostFilterPtr()->cancelUpdate();
+    Py_Return;
+}
+
+PyObject* FemPostFilterPy::getCustomAttributes(const char* /*attr*/) const
+{
+    return nullptr;
+}
+
+int FemPostFilterPy::setCustomAttributes(const char* /*attr*/, PyObject* /*obj*/)
+{
+    return 0;
+}
@@ -192,6 +192,54 @@ class TestMeshCommon(unittest.TestCase):
             f"Problem in test_writeAbaqus_precision, \n{read_node_line}\n{expected}",
         )
 
+    # ********************************************************************************************
+    def test_nodes_by_face_after_mesh_change(self):
+        # the node to sub-shape association is cached, it must not be returned
+        # once the mesh has been modified or moved
+        import Part
+
+        tetra4 = Fem.FemMesh()
+        tetra4.addNode(0, 0, 0, 1)
+        tetra4.addNode(10, 0, 0, 2)
+        tetra4.addNode(0, 10, 0, 3)
+        tetra4.addNode(0, 0, 10, 4)
+        tetra4.addVolume([1, 2, 3, 4])
+        face = Part.makePlane(10, 10)
+
+        self.assertEqual(sorted(tetra4.getNodesByFace(face)), [1, 2, 3])
+        # the same query again is answered from the cache
+        self.assertEqual(sorted(tetra4.getNodesByFace(face)), [1, 2, 3])
+
+        tetra4.addNode(5, 5, 0, 5)
+        self.assertEqual(sorted(tetra4.getNodesByFace(face)), [1, 2, 3, 5])
+
+        tetra4.setTransform(FreeCAD.Placement(FreeCAD.Vector(0, 0, 5), FreeCAD.Rotation()))
+        self.assertEqual(tetra4.getNodesByFace(face), [])
+
+    # ********************************************************************************************
+    def test_writeAbaqus_after_mesh_change(self):
+        # writeABAQUS keeps an unchanged file, but must rewrite it once the mesh has changed
+        seg2 = Fem.FemMesh()
+        seg2.addNode(0, 0, 0, 1)
+        seg2.addNode(1, 0, 0, 2)
+        seg2.addEdge([1, 2])
+
+        inp_file = join(testtools.get_fem_test_tmp_dir("mesh_common_inp_cache"), "seg2_mesh.inp")
+        seg2.writeABAQUS(inp_file, 1, False)
+        with open(inp_file) as f:
+            first = f.read()
+        seg2.writeABAQUS(inp_file, 1, False)
+        with open(inp_file) as f:
+            self.assertEqual(f.read(), first)
+
+        seg2.addNode(2, 0, 0, 3)
+        seg2.addEdge([2, 3])
+        seg2.writeABAQUS(inp_file, 1, False)
+        with open(inp_file) as f:
+            lines = [ln.strip() for ln in f]
+        self.assertIn("3, 2, 0, 0", lines)
+        self.assertIn("2, 2, 3", lines)
+
 
 # ************************************************************************************************
 # ************************************************************************************************
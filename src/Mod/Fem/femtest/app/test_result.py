@@ -191,3 +191,135 @@ class TestResult(unittest.TestCase):
         self.assertEqual(
             disp_abs, expected_dispabs, "Calculated displacement abs are not the expected values."
         )
+
+
+# ************************************************************************************************
+# ************************************************************************************************
+class DataChangeObserver:
+    """Records the objects whose Data property changed."""
+
+    def __init__(self):
+        self.changed = []
+
+    def slotChangedObject(self, obj, prop):
+        if prop == "Data":
+            self.changed.append(obj.Name)
+
+
+@unittest.skipIf("BUILD_FEM_VTK" not in FreeCAD.__cmake__, "FEM post-processing needs VTK")
+class TestPostFilter(unittest.TestCase):
+    fcc_print("import TestPostFilter")
+
+    # ********************************************************************************************
+    def setUp(self):
+        # setUp is executed before every test
+        import ObjectsFem
+
+        # new document
+        self.document = FreeCAD.newDocument(self.__class__.__name__)
+        self.param = FreeCAD.ParamGet("User parameter:BaseApp/Preferences/Mod/Fem/General")
+        self.param.SetBool("PostUpdateInBackground", False)
+
+        # a pipeline with two clip filters in series
+        self.pipeline = self.document.addObject("Fem::FemPostPipeline", "Pipeline")
+        self.pipeline.read(join(testtools.get_fem_test_home_dir(), "mesh", "tetra10_mesh.vtk"))
+        plane = self.document.addObject("Fem::FemPostPlaneFunction", "Plane")
+        plane.Origin = FreeCAD.Vector(9, 9, 9)
+        plane.Normal = FreeCAD.Vector(1, 0, 0)
+        self.first = ObjectsFem.makePostVtkFilterClipRegion(self.document, self.pipeline)
+        self.first.Function = plane
+        self.second = ObjectsFem.makePostVtkFilterClipRegion(self.document, self.pipeline)
+        self.second.Function = plane
+        self.document.recompute()
+
+        self.observer = DataChangeObserver()
+        FreeCAD.addDocumentObserver(self.observer)
+
+    # ********************************************************************************************
+    def tearDown(self):
+        # tearDown is executed after every test
+        FreeCAD.removeDocumentObserver(self.observer)
+        self.param.RemBool("PostUpdateInBackground")
+        FreeCAD.closeDocument(self.document.Name)
+
+    # ********************************************************************************************
+    def test_00print(self):
+        # since method name starts with 00 this will be run first
+        # this test just prints a line with stars
+        fcc_print(
+            "\n{0}\n{1} run FEM TestPostFilter tests {2}\n{0}".format(100 * "*", 10 * "*", 60 * "*")
+        )
+
+    # ********************************************************************************************
+    def wait_for_update(self, post_filter):
+        import time
+        import FreeCADGui
+
+        # the result of a background update is handed over by the event loop
+        timeout = time.time() + 10
+        while post_filter.isUpdating() and time.time() < timeout:
+            FreeCADGui.updateGui()
+        self.assertFalse(post_filter.isUpdating(), "Background update did not finish")
+
+    # ********************************************************************************************
+    def test_output_reused_while_unchanged(self):
+        self.assertIsNotNone(self.first.Data)
+        self.assertIsNotNone(self.second.Data)
+
+        # a recompute without any change does not replace the output of the filters
+        self.first.touch()
+        self.document.recompute()
+        self.assertEqual(self.observer.changed, [])
+
+    # ********************************************************************************************
+    def test_output_invalidated_by_property_change(self):
+        self.first.InsideOut = True
+        self.document.recompute()
+        self.assertIn(self.first.Name, self.observer.changed)
+        self.assertIn(self.second.Name, self.observer.changed)
+
+    # ********************************************************************************************
+    @unittest.skipIf(not FreeCAD.GuiUp, "background updates need an event loop")
+    def test_background_update(self):
+        self.param.SetBool("PostUpdateInBackground", True)
+        self.first.InsideOut = True
+        self.document.recompute()
+
+        # the second filter waits for the output of the first one
+        self.assertTrue(self.first.isUpdating())
+        self.assertFalse(self.second.isUpdating())
+        self.assertNotIn(self.first.Name, self.observer.changed)
+
+        self.wait_for_update(self.first)
+        self.assertIn(self.first.Name, self.observer.changed)
+        self.wait_for_update(self.second)
+        self.assertIn(self.second.Name, self.observer.changed)
+
+    # ********************************************************************************************
+    @unittest.skipIf(not FreeCAD.GuiUp, "background updates need an event loop")
+    def test_background_update_cancelled(self):
+        import FreeCADGui
+
+        self.param.SetBool("PostUpdateInBackground", True)
+        self.first.InsideOut = True
+        self.document.recompute()
+        self.assertTrue(self.first.isUpdating())
+
+        # changing a property of the filter aborts its running update
+        self.first.CutCells = True
+        self.assertFalse(self.first.isUpdating())
+
+        self.document.recompute()
+        self.assertTrue(self.first.isUpdating())
+        self.first.cancelUpdate()
+        self.assertFalse(self.first.isUpdating())
+
+        # the output of the cancelled update is dropped
+        FreeCADGui.updateGui()
+        self.assertEqual(self.observer.changed, [])
+
+        # and the next update executes the filter again
+        self.param.SetBool("PostUpdateInBackground", False)
+        self.first.touch()
+        self.document.recompute()
+        self.assertIn(self.first.Name, self.observer.changed)
@@ -66,6 +66,7 @@
 #include <Mod/Part/App/TopoShapePy.h>
 #include <Mod/Part/App/encodeFilename.h>
 
+#include "ExportGlb.h"
 #include "ImportOCAF2.h"
 #include "ReaderGltf.h"
 #include "ReaderIges.h"
@@ -305,10 +306,6 @@ private:
                 }
             }
 
-            Handle(XCAFApp_Application) hApp = XCAFApp_Application::GetApplication();
-            Handle(TDocStd_Document) hDoc;
-            hApp->NewDocument(TCollection_ExtendedString("MDTV-CAF"), hDoc);
-
             auto getShapeColors = [partColor](App::DocumentObject* obj, const char* subname) {
                 std::map<std::string, App::Color> cols;
                 auto it = partColor.find(dynamic_cast<Part::Feature*>(obj));
@@ -322,6 +319,19 @@ private:
                 return cols;
             };
 
+            // binary glTF is written directly from the shapes without an OCAF document
+            Base::FileInfo file(Utf8Name.c_str());
+            if (!legacyExport && file.hasExtension("glb")) {
+                Import::ExportGlb glb(file, getShapeColors);
+                glb.setExportHiddenObject(exportHidden);
+                glb.exportObjects(objs);
+                return Py::None();
+            }
+
+            Handle(XCAFApp_Application) hApp = XCAFApp_Application::GetApplication();
+            Handle(TDocStd_Document) hDoc;
+            hApp->NewDocument(TCollection_ExtendedString("MDTV-CAF"), hDoc);
+
             Import::ExportOCAF2 ocaf(hDoc, getShapeColors);
             if (!legacyExport || !ocaf.canFallback(objs)) {
                 ocaf.setExportOptions(ExportOCAF2::customExportOptions());
@@ -337,7 +347,6 @@ private:
                 ocaf.exportObjects(objs);
             }
 
-            Base::FileInfo file(Utf8Name.c_str());
             if (file.hasExtension({"stp", "step"})) {
                 Import::WriterStep writer(file);
                 writer.write(hDoc);
@@ -0,0 +1,616 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2024 The FreeCAD Project Association                     *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+
+#include "PreCompiled.h"
+#ifndef _PreComp_
+#include <cmath>
+#include <limits>
+#include <sstream>
+#include <BRep_Tool.hxx>
+#include <Poly_Triangulation.hxx>
+#include <Standard_Version.hxx>
+#include <TopExp.hxx>
+#include <TopoDS.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+#endif
+
+#include <App/Application.h>
+#include <App/DocumentObject.h>
+#include <Base/Console.h>
+#include <Base/Exception.h>
+#include <Base/Stream.h>
+#include <Mod/Part/App/PartFeature.h>
+#include <Mod/Part/App/TessellationCache.h>
+#include <Mod/Part/App/Tools.h>
+
+#include "ExportGlb.h"
+#include "ExportOCAF2.h"
+
+
+FC_LOG_LEVEL_INIT("Import", true, true)
+
+using namespace Import;
+
+namespace
+{
+
+// chunk types and magic number of the binary glTF container
+constexpr uint32_t GlbMagic = 0x46546C67;
+constexpr uint32_t GlbVersion = 2;
+constexpr uint32_t ChunkJson = 0x4E4F534A;
+constexpr uint32_t ChunkBin = 0x004E4942;
+
+// accessor and buffer view constants of the glTF specification
+constexpr int ComponentUnsignedInt = 5125;
+constexpr int ComponentFloat = 5126;
+constexpr int TargetArrayBuffer = 34962;
+constexpr int TargetElementArrayBuffer = 34963;
+
+Handle(Poly_Triangulation) faceTriangulation(const TopoDS_Face& face, TopLoc_Location& loc)
+{
+    Handle(Poly_Triangulation) mesh = BRep_Tool::Triangulation(face, loc);
+    if (mesh.IsNull()) {
+        mesh = Part::Tools::triangulationOfFace(face);
+    }
+    return mesh;
+}
+
+gp_Pnt triangulationNode(const Handle(Poly_Triangulation)& mesh, int index)
+{
+#if OCC_VERSION_HEX < 0x070600
+    return mesh->Nodes()(index);
+#else
+    return mesh->Node(index);
+#endif
+}
+
+void triangulationTriangle(const Handle(Poly_Triangulation)& mesh,
+                           int index,
+                           Standard_Integer& n1,
+                           Standard_Integer& n2,
+                           Standard_Integer& n3)
+{
+#if OCC_VERSION_HEX < 0x070600
+    mesh->Triangles()(index).Get(n1, n2, n3);
+#else
+    mesh->Triangle(index).Get(n1, n2, n3);
+#endif
+}
+
+// glTF expects linear color factors while FreeCAD colors are sRGB
+double toLinear(float value)
+{
+    if (value <= 0.04045F) {
+        return value / 12.92;
+    }
+    return std::pow((value + 0.055) / 1.055, 2.4);
+}
+
+std::string escapeJson(const std::string& str)
+{
+    std::ostringstream out;
+    for (char ch : str) {
+        switch (ch) {
+            case '"':
+                out << "\\\"";
+                break;
+            case '\\':
+                out << "\\\\";
+                break;
+            default:
+                if (static_cast<unsigned char>(ch) < 0x20) {
+                    out << "\\u00" << "0123456789abcdef"[(ch >> 4) & 0xf]
+                        << "0123456789abcdef"[ch & 0xf];
+                }
+                else {
+                    out << ch;
+                }
+                break;
+        }
+    }
+    return out.str();
+}
+
+}  // namespace
+
+ExportGlb::ExportGlb(const Base::FileInfo& file, GetShapeColorsFunc func)  // NOLINT
+    : file {file}
+    , getShapeColors(std::move(func))
+    , defaultColor(ExportOCAF2::customExportOptions().defaultColor)
+{}
+
+void ExportGlb::exportObjects(const std::vector<App::DocumentObject*>& objs)
+{
+    nodes.clear();
+    meshes.clear();
+    materials.clear();
+    meshMap.clear();
+    materialMap.clear();
+
+    // The root node converts from FreeCAD's Z-up millimeters to glTF's Y-up meters
+    // https://github.com/KhronosGroup/glTF/blob/master/specification/2.0/README.md#coordinate-system-and-units
+    Node root;
+    root.name = "FreeCAD";
+    root.matrix[0][0] = 0.001;   // NOLINT
+    root.matrix[1][1] = 0.0;
+    root.matrix[1][2] = 0.001;   // NOLINT
+    root.matrix[2][1] = -0.001;  // NOLINT
+    root.matrix[2][2] = 0.0;
+    nodes.push_back(root);
+
+    for (auto obj : objs) {
+        if (!obj || !obj->isAttachedToDocument()) {
+            continue;
+        }
+        int index = exportObject(obj, nullptr);
+        if (index >= 0) {
+            nodes[0].children.push_back(index);
+        }
+    }
+
+    FC_TIME_INIT(t);
+    triangulate();
+    FC_TIME_LOG(t, "triangulate " << meshes.size() << " meshes");
+
+    std::size_t bufferLength = layoutBuffer();
+
+    std::ostringstream json;
+    json.imbue(std::locale::classic());
+    writeJson(json, bufferLength);
+    std::string header = json.str();
+    header.append((4 - header.size() % 4) % 4, ' ');
+
+    // The binary chunk is left out when there is nothing to put in it
+    std::size_t totalLength = 12 + 8 + header.size() + (bufferLength > 0 ? 8 + bufferLength : 0);
+    if (totalLength > std::numeric_limits<uint32_t>::max()) {
+        throw Base::RuntimeError("Model too big for a binary glTF file");
+    }
+
+    Base::ofstream out(file, std::ios::out | std::ios::binary);
+    if (!out.is_open()) {
+        throw Base::FileException("Cannot open file: ", file);
+    }
+
+    Base::OutputStream str(out);
+    str.setByteOrder(Base::Stream::LittleEndian);
+    str << GlbMagic << GlbVersion << static_cast<uint32_t>(totalLength);
+    str << static_cast<uint32_t>(header.size()) << ChunkJson;
+    str.write(header.c_str(), static_cast<int>(header.size()));
+    if (bufferLength > 0) {
+        str << static_cast<uint32_t>(bufferLength) << ChunkBin;
+        for (const auto& mesh : meshes) {
+            writeMesh(str, mesh);
+        }
+    }
+    FC_TIME_LOG(t, "write " << file.filePath());
+
+    out.close();
+    if (out.fail()) {
+        throw Base::FileException("Cannot save to file: ", file);
+    }
+}
+
+int ExportGlb::exportObject(App::DocumentObject* parentObj, const char* sub)
+{
+    Base::Matrix4D mat;
+    auto obj = parentObj->getSubObject(sub, nullptr, &mat, !sub);
+    if (!obj) {
+        return -1;
+    }
+
+    auto subs = obj->getSubObjects();
+    // subs empty means obj is not a container.
+    if (subs.empty()) {
+        App::DocumentObject* owner = nullptr;
+        auto shape =
+            Part::Feature::getTopoShape(parentObj, sub, false, nullptr, &owner, false, !sub);
+        if (shape.isNull()) {
+            if (owner) {
+                FC_WARN(owner->getFullName() << " has null shape");
+            }
+            return -1;
+        }
+
+        Node node;
+        node.name = obj->Label.getValue();
+        node.matrix = shape.getTransform();
+        node.mesh = addMesh(owner ? owner : obj, shape);
+        nodes.push_back(node);
+        return static_cast<int>(nodes.size()) - 1;
+    }
+
+    int index = static_cast<int>(nodes.size());
+    nodes.emplace_back();
+    nodes[index].name = obj->Label.getValue();
+    nodes[index].matrix = mat;
+
+    for (auto& subobj : subs) {
+        App::DocumentObject* parentGrp = nullptr;
+        std::string childName;
+        auto sobj = obj->resolve(subobj.c_str(), &parentGrp, &childName);
+        if (!sobj) {
+            FC_WARN("Cannot find object " << obj->getFullName() << '.' << subobj);
+            continue;
+        }
+
+        int vis = parentGrp ? parentGrp->isElementVisible(childName.c_str()) : -1;
+        if (vis < 0) {
+            vis = sobj->Visibility.getValue() ? 1 : 0;
+        }
+        if (!vis && !exportHidden) {
+            continue;
+        }
+
+        int child = exportObject(obj, subobj.c_str());
+        if (child >= 0) {
+            nodes[index].children.push_back(child);
+        }
+    }
+
+    return index;
+}
+
+int ExportGlb::addMesh(App::DocumentObject* obj, const Part::TopoShape& shape)
+{
+    // Linked objects share the underlying shape, so the mesh is only written once
+    TopoDS_Shape base = shape.getShape().Located(TopLoc_Location());
+    std::map<std::string, App::Color> colors;
+    if (getShapeColors) {
+        colors = getShapeColors(obj, "Face*");
+    }
+
+    std::ostringstream key;
+    key << static_cast<const void*>(base.TShape().get()) << ':' << base.Orientation();
+    for (const auto& it : colors) {
+        key << ';' << it.first << '=' << it.second.getPackedValue();
+    }
+    auto found = meshMap.find(key.str());
+    if (found != meshMap.end()) {
+        return found->second;
+    }
+
+    TopTools_IndexedMapOfShape faceMap;
+    TopExp::MapShapes(base, TopAbs_FACE, faceMap);
+    if (faceMap.IsEmpty()) {
+        meshMap.emplace(key.str(), -1);
+        return -1;
+    }
+
+    Mesh mesh;
+    mesh.name = obj->Label.getValue();
+    mesh.shape = base;
+
+    auto it = colors.find("Face");
+    int defaultMaterial = addMaterial(it != colors.end() ? it->second : defaultColor);
+
+    // one primitive per material, sharing the vertices of the mesh
+    std::map<int, std::size_t> primitiveMap;
+    for (int i = 1; i <= faceMap.Extent(); i++) {
+        mesh.faces.push_back(TopoDS::Face(faceMap(i)));
+
+        int material = defaultMaterial;
+        it = colors.find("Face" + std::to_string(i));
+        if (it != colors.end()) {
+            material = addMaterial(it->second);
+        }
+        auto res = primitiveMap.emplace(material, mesh.primitives.size());
+        if (res.second) {
+            mesh.primitives.emplace_back();
+            mesh.primitives.back().material = material;
+        }
+        mesh.primitives[res.first->second].faces.push_back(i - 1);
+    }
+
+    int index = static_cast<int>(meshes.size());
+    meshes.push_back(std::move(mesh));
+    meshMap.emplace(key.str(), index);
+    return index;
+}
+
+int ExportGlb::addMaterial(const App::Color& color)
+{
+    auto res = materialMap.emplace(color.getPackedValue(), static_cast<int>(materials.size()));
+    if (res.second) {
+        materials.push_back(color);
+    }
+    return res.first->second;
+}
+
+void ExportGlb::triangulate()
+{
+    ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Part");
+    double deviation = hGrp->GetFloat("MeshDeviation", 0.2);                 // NOLINT
+    double angularDeflection = hGrp->GetFloat("MeshAngularDeflection", 28.65);  // NOLINT
+
+    // reuse the triangulation if the shape has already been meshed, e.g. for display
+    for (const auto& mesh : meshes) {
+        double deflection = Part::TessellationCache::getDeflection(mesh.shape, deviation);
+        Part::TessellationCache::triangulate(mesh.shape,
+                                             deflection,
+                                             angularDeflection / 180.0 * M_PI);  // NOLINT
+    }
+}
+
+std::size_t ExportGlb::layoutBuffer()
+{
+    // The vertex positions and normals of a mesh are followed by the indices of its
+    // primitives. All items are four bytes and thus no padding is needed.
+    std::size_t offset = 0;
+    for (auto& mesh : meshes) {
+        mesh.nodeCount = 0;
+        mesh.bounds = Base::BoundBox3d();
+        for (auto& prim : mesh.primitives) {
+            prim.indexCount = 0;
+            for (int index : prim.faces) {
+                TopLoc_Location loc;
+                auto tria = faceTriangulation(mesh.faces[index], loc);
+                if (tria.IsNull()) {
+                    continue;
+                }
+                gp_Trsf trsf = loc.Transformation();
+                for (int i = 1; i <= tria->NbNodes(); i++) {
+                    gp_Pnt pnt = triangulationNode(tria, i).Transformed(trsf);
+                    mesh.bounds.Add(Base::Vector3d(pnt.X(), pnt.Y(), pnt.Z()));
+                }
+                mesh.nodeCount += tria->NbNodes();
+                prim.indexCount += 3 * static_cast<std::size_t>(tria->NbTriangles());
+            }
+        }
+
+        mesh.positionOffset = offset;
+        offset += mesh.nodeCount * 3 * sizeof(float);
+        mesh.normalOffset = offset;
+        offset += mesh.nodeCount * 3 * sizeof(float);
+        for (auto& prim : mesh.primitives) {
+            prim.indexOffset = offset;
+            offset += prim.indexCount * sizeof(uint32_t);
+        }
+    }
+    return offset;
+}
+
+void ExportGlb::writeJson(std::ostream& str, std::size_t bufferLength) const
+{
+    std::vector<int> meshIndex(meshes.size(), -1);
+    std::ostringstream meshStr, accessorStr, viewStr;
+    meshStr.imbue(std::locale::classic());
+    accessorStr.imbue(std::locale::classic());
+    viewStr.imbue(std::locale::classic());
+    accessorStr.precision(std::numeric_limits<float>::max_digits10);
+
+    int accessorCount = 0;
+    auto addAccessor = [&](std::size_t offset,
+                           std::size_t length,
+                           std::size_t count,
+                           int component,
+                           const char* type,
+                           int target,
+                           const Base::BoundBox3d* bounds) {
+        if (accessorCount > 0) {
+            viewStr << ',';
+            accessorStr << ',';
+        }
+        viewStr << "{\"buffer\":0,\"byteOffset\":" << offset << ",\"byteLength\":" << length
+                << ",\"target\":" << target << '}';
+        accessorStr << "{\"bufferView\":" << accessorCount << ",\"componentType\":" << component
+                    << ",\"count\":" << count << ",\"type\":\"" << type << '"';
+        if (bounds) {
+            accessorStr << ",\"min\":[" << static_cast<float>(bounds->MinX) << ','
+                        << static_cast<float>(bounds->MinY) << ','
+                        << static_cast<float>(bounds->MinZ) << "],\"max\":["
+                        << static_cast<float>(bounds->MaxX) << ','
+                        << static_cast<float>(bounds->MaxY) << ','
+                        << static_cast<float>(bounds->MaxZ) << ']';
+        }
+        accessorStr << '}';
+        return accessorCount++;
+    };
+
+    int count = 0;
+    for (std::size_t i = 0; i < meshes.size(); i++) {
+        const auto& mesh = meshes[i];
+        if (mesh.nodeCount == 0) {
+            continue;
+        }
+        std::size_t length = mesh.nodeCount * 3 * sizeof(float);
+        int position = addAccessor(mesh.positionOffset,
+                                   length,
+                                   mesh.nodeCount,
+                                   ComponentFloat,
+                                   "VEC3",
+                                   TargetArrayBuffer,
+                                   &mesh.bounds);
+        int normal = addAccessor(mesh.normalOffset,
+                                 length,
+                                 mesh.nodeCount,
+                                 ComponentFloat,
+                                 "VEC3",
+                                 TargetArrayBuffer,
+                                 nullptr);
+
+        if (count > 0) {
+            meshStr << ',';
+        }
+        meshStr << "{\"name\":\"" << escapeJson(mesh.name) << "\",\"primitives\":[";
+        bool first = true;
+        for (const auto& prim : mesh.primitives) {
+            if (prim.indexCount == 0) {
+                continue;
+            }
+            int indices = addAccessor(prim.indexOffset,
+                                      prim.indexCount * sizeof(uint32_t),
+                                      prim.indexCount,
+                                      ComponentUnsignedInt,
+                                      "SCALAR",
+                                      TargetElementArrayBuffer,
+                                      nullptr);
+            if (!first) {
+                meshStr << ',';
+            }
+            first = false;
+            meshStr << "{\"attributes\":{\"POSITION\":" << position << ",\"NORMAL\":" << normal
+                    << "},\"indices\":" << indices << ",\"material\":" << prim.material << '}';
+        }
+        meshStr << "]}";
+        meshIndex[i] = count++;
+    }
+
+    str.precision(std::numeric_limits<double>::max_digits10);
+    str << "{\"asset\":{\"version\":\"2.0\",\"generator\":\"FreeCAD\"},"
+        << "\"scene\":0,\"scenes\":[{\"nodes\":[0]}],\"nodes\":[";
+    for (std::size_t i = 0; i < nodes.size(); i++) {
+        const auto& node = nodes[i];
+        if (i > 0) {
+            str << ',';
+        }
+        str << "{\"name\":\"" << escapeJson(node.name) << '"';
+        if (!node.matrix.isUnity()) {
+            // glTF matrices are stored in column-major order
+            str << ",\"matrix\":[";
+            for (unsigned short col = 0; col < 4; col++) {
+                for (unsigned short row = 0; row < 4; row++) {
+                    str << (col + row > 0 ? "," : "") << node.matrix[row][col];
+                }
+            }
+            str << ']';
+        }
+        if (node.mesh >= 0 && meshIndex[node.mesh] >= 0) {
+            str << ",\"mesh\":" << meshIndex[node.mesh];
+        }
+        if (!node.children.empty()) {
+            str << ",\"children\":[";
+            for (std::size_t j = 0; j < node.children.size(); j++) {
+                str << (j > 0 ? "," : "") << node.children[j];
+            }
+            str << ']';
+        }
+        str << '}';
+    }
+    str << ']';
+
+    if (count > 0) {
+        str << ",\"meshes\":[" << meshStr.str() << ']';
+        str << ",\"accessors\":[" << accessorStr.str() << ']';
+        str << ",\"bufferViews\":[" << viewStr.str() << ']';
+        str << ",\"buffers\":[{\"byteLength\":" << bufferLength << "}]";
+    }
+
+    if (!materials.empty()) {
+        str.precision(std::numeric_limits<float>::max_digits10);
+        str << ",\"materials\":[";
+        for (std::size_t i = 0; i < materials.size(); i++) {
+            const auto& color = materials[i];
+            // A fully transparent color is treated as opaque because view providers
+            // may report it for shapes with a single color.
+            float alpha = color.a > 0.0F && color.a < 1.0F ? color.a : 1.0F;
+            str << (i > 0 ? "," : "") << "{\"pbrMetallicRoughness\":{\"baseColorFactor\":["
+                << toLinear(color.r) << ',' << toLinear(color.g) << ',' << toLinear(color.b)
+                << ',' << alpha << "],\"metallicFactor\":0,\"roughnessFactor\":0.5}";
+            if (alpha < 1.0F) {
+                str << ",\"alphaMode\":\"BLEND\"";
+            }
+            str << '}';
+        }
+        str << ']';
+    }
+    str << '}';
+}
+
+void ExportGlb::writeMesh(Base::OutputStream& str, const Mesh& mesh) const
+{
+    if (mesh.nodeCount == 0) {
+        return;
+    }
+
+    std::vector<Base::Vector3f> points;
+    std::vector<Base::Vector3f> normals;
+    std::vector<std::vector<uint32_t>> indices(mesh.primitives.size());
+    points.reserve(mesh.nodeCount);
+    normals.reserve(mesh.nodeCount);
+
+    for (std::size_t p = 0; p < mesh.primitives.size(); p++) {
+        const auto& prim = mesh.primitives[p];
+        indices[p].reserve(prim.indexCount);
+        for (int index : prim.faces) {
+            const TopoDS_Face& face = mesh.faces[index];
+            TopLoc_Location loc;
+            auto tria = faceTriangulation(face, loc);
+            if (tria.IsNull()) {
+                continue;
+            }
+
+            auto offset = static_cast<uint32_t>(points.size());
+            gp_Trsf trsf = loc.Transformation();
+            for (int i = 1; i <= tria->NbNodes(); i++) {
+                gp_Pnt pnt = triangulationNode(tria, i).Transformed(trsf);
+                points.emplace_back(static_cast<float>(pnt.X()),
+                                    static_cast<float>(pnt.Y()),
+                                    static_cast<float>(pnt.Z()));
+                normals.emplace_back(0.0F, 0.0F, 0.0F);
+            }
+
+            bool reversed = face.Orientation() != TopAbs_FORWARD;
+            for (int i = 1; i <= tria->NbTriangles(); i++) {
+                Standard_Integer n1, n2, n3;
+                triangulationTriangle(tria, i, n1, n2, n3);
+                // change orientation of the triangle if the face is reversed
+                if (reversed) {
+                    std::swap(n1, n2);
+                }
+                uint32_t i1 = offset + n1 - 1;
+                uint32_t i2 = offset + n2 - 1;
+                uint32_t i3 = offset + n3 - 1;
+
+                // the area weighted triangle normal is added to its points
+                Base::Vector3f normal = (points[i2] - points[i1]) % (points[i3] - points[i1]);
+                normals[i1] += normal;
+                normals[i2] += normal;
+                normals[i3] += normal;
+
+                indices[p].push_back(i1);
+                indices[p].push_back(i2);
+                indices[p].push_back(i3);
+            }
+        }
+    }
+
+    for (const auto& pnt : points) {
+        str << pnt.x << pnt.y << pnt.z;
+    }
+    for (auto& normal : normals) {
+        if (normal.Sqr() > 0.0F) {
+            normal.Normalize();
+        }
+        else {
+            normal.Set(0.0F, 0.0F, 1.0F);
+        }
+        str << normal.x << normal.y << normal.z;
+    }
+    for (const auto& list : indices) {
+        for (uint32_t index : list) {
+            str << index;
+        }
+    }
+}
@@ -0,0 +1,130 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2024 The FreeCAD Project Association                     *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#ifndef IMPORT_EXPORTGLB_H
+#define IMPORT_EXPORTGLB_H
+
+#include <functional>
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <TopoDS_Face.hxx>
+#include <TopoDS_Shape.hxx>
+
+#include <App/Color.h>
+#include <Base/BoundBox.h>
+#include <Base/FileInfo.h>
+#include <Base/Matrix.h>
+#include <Mod/Import/ImportGlobal.h>
+
+namespace App
+{
+class DocumentObject;
+}
+
+namespace Base
+{
+class OutputStream;
+}
+
+namespace Part
+{
+class TopoShape;
+}
+
+namespace Import
+{
+
+/** Writes binary glTF (GLB) files directly from the shapes of the exported objects.
+ *
+ * Unlike WriterGltf this doesn't go through an OCAF document. The triangulation stored
+ * in the shapes (e.g. the one computed for display) is reused and only missing ones are
+ * computed. Objects sharing the same shape, like the elements of a link array, reference
+ * a single mesh and are written as instanced nodes. The binary buffer is streamed mesh
+ * by mesh to the file.
+ */
+class ImportExport ExportGlb
+{
+public:
+    using GetShapeColorsFunc =
+        std::function<std::map<std::string, App::Color>(App::DocumentObject*, const char*)>;
+    explicit ExportGlb(const Base::FileInfo& file, GetShapeColorsFunc func = GetShapeColorsFunc());
+
+    void setExportHiddenObject(bool enable)
+    {
+        exportHidden = enable;
+    }
+    void exportObjects(const std::vector<App::DocumentObject*>& objs);
+
+private:
+    struct Node
+    {
+        std::string name;
+        Base::Matrix4D matrix;
+        int mesh = -1;
+        std::vector<int> children;
+    };
+    struct Primitive
+    {
+        int material = -1;
+        std::vector<int> faces;
+        std::size_t indexCount = 0;
+        std::size_t indexOffset = 0;
+    };
+    struct Mesh
+    {
+        std::string name;
+        TopoDS_Shape shape;
+        std::vector<TopoDS_Face> faces;
+        std::vector<Primitive> primitives;
+        std::size_t nodeCount = 0;
+        std::size_t positionOffset = 0;
+        std::size_t normalOffset = 0;
+        Base::BoundBox3d bounds;
+    };
+
+    int exportObject(App::DocumentObject* parentObj, const char* sub);
+    int addMesh(App::DocumentObject* obj, const Part::TopoShape& shape);
+    int addMaterial(const App::Color& color);
+    void triangulate();
+    std::size_t layoutBuffer();
+    void writeJson(std::ostream& str, std::size_t bufferLength) const;
+    void writeMesh(Base::OutputStream& str, const Mesh& mesh) const;
+
+private:
+    Base::FileInfo file;
+    GetShapeColorsFunc getShapeColors;
+    bool exportHidden = true;
+    App::Color defaultColor;
+    std::vector<Node> nodes;
+    std::vector<Mesh> meshes;
+    std::vector<App::Color> materials;
+    std::map<std::string, int> meshMap;
+    std::map<uint32_t, int> materialMap;
+};
+
+}  // namespace Import
+
+#endif  // IMPORT_EXPORTGLB_H
@@ -25,7 +25,26 @@
 #define WNT  // avoid conflict with GUID
 #endif
 #ifndef _PreComp_
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <future>
+#include <iomanip>
+#include <sstream>
+#include <thread>
+
+#include <BRep_Tool.hxx>
+#include <BRepAdaptor_Curve.hxx>
+#include <BRepAdaptor_Surface.hxx>
+#include <BRepBndLib.hxx>
+#include <BRepGProp.hxx>
+#include <BRepMesh_IncrementalMesh.hxx>
+#include <BRepTools.hxx>
+#include <Bnd_Box.hxx>
+#include <GProp_GProps.hxx>
+#include <GProp_PrincipalProps.hxx>
 #include <Interface_Static.hxx>
+#include <Precision.hxx>
 #include <Quantity_ColorRGBA.hxx>
 #include <Standard_Failure.hxx>
 #include <Standard_Version.hxx>
@@ -34,6 +53,7 @@
 #include <TDF_LabelSequence.hxx>
 #include <TopExp.hxx>
 #include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
 #include <TopoDS_Iterator.hxx>
 #include <XCAFDoc_DocumentTool.hxx>
 #include <XCAFDoc_GraphNode.hxx>
@@ -51,6 +71,7 @@
 #include <Base/Console.h>
 #include <Base/FileInfo.h>
 #include <Base/Parameter.h>
+#include <Base/Tools.h>
 #include <Mod/Part/App/FeatureCompound.h>
 #include <Mod/Part/App/Interface.h>
 #include <Mod/Part/App/OCAF/ImportExportSettings.h>
@@ -108,6 +129,7 @@ ImportOCAFOptions ImportOCAF2::customImportOptions()
     defaultOptions.reduceObjects = settings.getReduceObjects();
     defaultOptions.showProgress = settings.getShowProgress();
     defaultOptions.expandCompound = settings.getExpandCompound();
+    defaultOptions.shareShapes = settings.getShareShapes();
     defaultOptions.mode = static_cast<int>(settings.getImportMode());
 
     auto hGrp =
@@ -291,82 +313,22 @@ bool ImportOCAF2::createObject(App::Document* doc,
         return false;
     }
 
-    getColor(shape, info);
-    bool hasFaceColors = false;
-    bool hasEdgeColors = false;
+    ShapeData data;
+    auto it = myShapeData.find(shape);
+    if (it != myShapeData.end()) {
+        data = std::move(it->second);
+        myShapeData.erase(it);
+    }
+    else {
+        data = readShapeData(label, shape);
+        prepareShapeData(data);
+    }
+    info.faceColor = data.info.faceColor;
+    info.edgeColor = data.info.edgeColor;
+    info.hasFaceColor = data.info.hasFaceColor;
+    info.hasEdgeColor = data.info.hasEdgeColor;
 
     Part::TopoShape tshape(shape);
-    std::vector<App::Color> faceColors;
-    std::vector<App::Color> edgeColors;
-
-    TDF_LabelSequence seq;
-    if (!label.IsNull() && aShapeTool->GetSubShapes(label, seq)) {
-
-        TopTools_IndexedMapOfShape faceMap, edgeMap;
-        TopExp::MapShapes(tshape.getShape(), TopAbs_FACE, faceMap);
-        TopExp::MapShapes(tshape.getShape(), TopAbs_EDGE, edgeMap);
-
-        faceColors.assign(faceMap.Extent(), info.faceColor);
-        edgeColors.assign(edgeMap.Extent(), info.edgeColor);
-        // Two passes to get sub shape colors. First pass, look for solid, and
-        // second pass look for face and edges. This allows lower level
-        // subshape to override color of higher level ones.
-        for (int j = 0; j < 2; ++j) {
-            for (int i = 1; i <= seq.Length(); ++i) {
-                TDF_Label l = seq.Value(i);
-                TopoDS_Shape subShape = aShapeTool->GetShape(l);
-                if (subShape.IsNull()) {
-                    continue;
-                }
-                if (subShape.ShapeType() == TopAbs_FACE || subShape.ShapeType() == TopAbs_EDGE) {
-                    if (j == 0) {
-                        continue;
-                    }
-                }
-                else if (j != 0) {
-                    continue;
-                }
-
-                bool foundFaceColor = false, foundEdgeColor = false;
-                App::Color faceColor, edgeColor;
-                Quantity_ColorRGBA aColor;
-                if (aColorTool->GetColor(l, XCAFDoc_ColorSurf, aColor)
-                    || aColorTool->GetColor(l, XCAFDoc_ColorGen, aColor)) {
-                    faceColor = Tools::convertColor(aColor);
-                    foundFaceColor = true;
-                }
-                if (aColorTool->GetColor(l, XCAFDoc_ColorCurv, aColor)) {
-                    edgeColor = Tools::convertColor(aColor);
-                    foundEdgeColor = true;
-                    if (j == 0 && foundFaceColor && !faceColors.empty() && edgeColor == faceColor) {
-                        // Do not set edge the same color as face
-                        foundEdgeColor = false;
-                    }
-                }
-
-                if (foundFaceColor) {
-                    for (TopExp_Explorer exp(subShape, TopAbs_FACE); exp.More(); exp.Next()) {
-                        int idx = faceMap.FindIndex(exp.Current()) - 1;
-                        if (idx >= 0 && idx < (int)faceColors.size()) {
-                            faceColors[idx] = faceColor;
-                            hasFaceColors = true;
-                            info.hasFaceColor = true;
-                        }
-                    }
-                }
-                if (foundEdgeColor) {
-                    for (TopExp_Explorer exp(subShape, TopAbs_EDGE); exp.More(); exp.Next()) {
-                        int idx = edgeMap.FindIndex(exp.Current()) - 1;
-                        if (idx >= 0 && idx < (int)edgeColors.size()) {
-                            edgeColors[idx] = edgeColor;
-                            hasEdgeColors = true;
-                            info.hasEdgeColor = true;
-                        }
-                    }
-                }
-            }
-        }
-    }
 
     Part::Feature* feature;
 
@@ -386,11 +348,11 @@ bool ImportOCAF2::createObject(App::Document* doc,
     }
     applyFaceColors(feature, {info.faceColor});
     applyEdgeColors(feature, {info.edgeColor});
-    if (hasFaceColors) {
-        applyFaceColors(feature, faceColors);
+    if (data.hasFaceColors) {
+        applyFaceColors(feature, data.faceColors);
     }
-    if (hasEdgeColors) {
-        applyEdgeColors(feature, edgeColors);
+    if (data.hasEdgeColors) {
+        applyEdgeColors(feature, data.edgeColors);
     }
 
     info.propPlacement = &feature->Placement;
@@ -398,6 +360,468 @@ bool ImportOCAF2::createObject(App::Document* doc,
     return true;
 }
 
+ImportOCAF2::ShapeData ImportOCAF2::readShapeData(TDF_Label label, const TopoDS_Shape& shape)
+{
+    ShapeData data;
+    data.label = label;
+    data.shape = shape;
+    getColor(shape, data.info);
+
+    TDF_LabelSequence seq;
+    if (label.IsNull() || !aShapeTool->GetSubShapes(label, seq)) {
+        return data;
+    }
+    for (int i = 1; i <= seq.Length(); ++i) {
+        TDF_Label l = seq.Value(i);
+        SubShapeColor sub;
+        sub.shape = aShapeTool->GetShape(l);
+        if (sub.shape.IsNull()) {
+            continue;
+        }
+        Quantity_ColorRGBA aColor;
+        if (aColorTool->GetColor(l, XCAFDoc_ColorSurf, aColor)
+            || aColorTool->GetColor(l, XCAFDoc_ColorGen, aColor)) {
+            sub.faceColor = Tools::convertColor(aColor);
+            sub.hasFaceColor = true;
+        }
+        if (aColorTool->GetColor(l, XCAFDoc_ColorCurv, aColor)) {
+            sub.edgeColor = Tools::convertColor(aColor);
+            sub.hasEdgeColor = true;
+        }
+        if (sub.hasFaceColor || sub.hasEdgeColor) {
+            data.subShapeColors.push_back(sub);
+        }
+    }
+    return data;
+}
+
+void ImportOCAF2::prepareShapeData(ShapeData& data)
+{
+    if (data.subShapeColors.empty()) {
+        return;
+    }
+
+    TopTools_IndexedMapOfShape faceMap, edgeMap;
+    TopExp::MapShapes(data.shape, TopAbs_FACE, faceMap);
+    TopExp::MapShapes(data.shape, TopAbs_EDGE, edgeMap);
+
+    data.faceColors.assign(faceMap.Extent(), data.info.faceColor);
+    data.edgeColors.assign(edgeMap.Extent(), data.info.edgeColor);
+    // Two passes to get sub shape colors. First pass, look for solid, and
+    // second pass look for face and edges. This allows lower level
+    // subshape to override color of higher level ones.
+    for (int j = 0; j < 2; ++j) {
+        for (const auto& sub : data.subShapeColors) {
+            if (sub.shape.ShapeType() == TopAbs_FACE || sub.shape.ShapeType() == TopAbs_EDGE) {
+                if (j == 0) {
+                    continue;
+                }
+            }
+            else if (j != 0) {
+                continue;
+            }
+
+            bool foundEdgeColor = sub.hasEdgeColor;
+            if (j == 0 && sub.hasFaceColor && !data.faceColors.empty()
+                && sub.edgeColor == sub.faceColor) {
+                // Do not set edge the same color as face
+                foundEdgeColor = false;
+            }
+
+            if (sub.hasFaceColor) {
+                for (TopExp_Explorer exp(sub.shape, TopAbs_FACE); exp.More(); exp.Next()) {
+                    int idx = faceMap.FindIndex(exp.Current()) - 1;
+                    if (idx >= 0 && idx < (int)data.faceColors.size()) {
+                        data.faceColors[idx] = sub.faceColor;
+                        data.hasFaceColors = true;
+                        data.info.hasFaceColor = true;
+                    }
+                }
+            }
+            if (foundEdgeColor) {
+                for (TopExp_Explorer exp(sub.shape, TopAbs_EDGE); exp.More(); exp.Next()) {
+                    int idx = edgeMap.FindIndex(exp.Current()) - 1;
+                    if (idx >= 0 && idx < (int)data.edgeColors.size()) {
+                        data.edgeColors[idx] = sub.edgeColor;
+                        data.hasEdgeColors = true;
+                        data.info.hasEdgeColor = true;
+                    }
+                }
+            }
+        }
+    }
+}
+
+void ImportOCAF2::collectShapes(const TopoDS_Shape& shape,
+                                std::unordered_set<TopoDS_Shape, ShapeHasher>& visited)
+{
+    if (shape.IsNull()) {
+        return;
+    }
+
+    // Same walk as loadShape()
+    auto baseShape = shape.Located(TopLoc_Location());
+    if (!visited.insert(baseShape).second) {
+        return;
+    }
+    auto baseLabel = aShapeTool->FindShape(baseShape);
+    if (baseLabel.IsNull() || !aShapeTool->IsAssembly(baseLabel)) {
+        ShapeData data = readShapeData(baseLabel, baseShape);
+        data.index = myShapeData.size();
+        myShapeData.emplace(baseShape, std::move(data));
+        return;
+    }
+
+    for (TopoDS_Iterator it(baseShape, Standard_False, Standard_False); it.More(); it.Next()) {
+        TopoDS_Shape childShape = it.Value();
+        if (childShape.IsNull()) {
+            continue;
+        }
+        TDF_Label childLabel;
+        aShapeTool->Search(childShape, childLabel, Standard_True, Standard_True, Standard_False);
+        if (!childLabel.IsNull() && !options.importHidden && !aColorTool->IsVisible(childLabel)) {
+            continue;
+        }
+        collectShapes(childShape, visited);
+    }
+}
+
+static void tessellateShape(const TopoDS_Shape& shape, double deviation, double angularDeflection)
+{
+    Bnd_Box bounds;
+    BRepBndLib::Add(shape, bounds);
+    if (bounds.IsVoid()) {
+        return;
+    }
+    bounds.SetGap(0.0);
+    Standard_Real xMin, yMin, zMin, xMax, yMax, zMax;
+    bounds.Get(xMin, yMin, zMin, xMax, yMax, zMax);
+
+    // The deflection of the view providers, so that they keep this triangulation
+    Standard_Real deflection = ((xMax - xMin) + (yMax - yMin) + (zMax - zMin)) / 300.0 * deviation;
+    if (deflection < gp::Resolution()) {
+        deflection = Precision::Confusion();
+    }
+
+    try {
+        BRepMesh_IncrementalMesh(shape,
+                                 deflection,
+                                 Standard_False,
+                                 angularDeflection,
+                                 Standard_False);
+    }
+    catch (const Standard_Failure&) {
+        // The view provider will try again
+    }
+}
+
+// Calls func for each index below count, from as many threads as useful.
+static void runInParallel(size_t count, const std::function<void(size_t)>& func)
+{
+    std::atomic<size_t> next(0);
+    auto work = [&]() {
+        for (size_t i = next++; i < count; i = next++) {
+            func(i);
+        }
+    };
+    size_t threads = std::min<size_t>(count, std::max(1U, std::thread::hardware_concurrency()));
+    std::vector<std::future<void>> workers;
+    for (size_t i = 1; i < threads; ++i) {
+        workers.push_back(std::async(std::launch::async, work));
+    }
+    work();
+    for (auto& worker : workers) {
+        worker.get();
+    }
+}
+
+ImportOCAF2::ShapeFingerprint ImportOCAF2::computeFingerprint(const TopoDS_Shape& shape)
+{
+    ShapeFingerprint fingerprint;
+
+    TopTools_IndexedMapOfShape faceMap, edgeMap, vertexMap;
+    TopExp::MapShapes(shape, TopAbs_FACE, faceMap);
+    TopExp::MapShapes(shape, TopAbs_EDGE, edgeMap);
+    TopExp::MapShapes(shape, TopAbs_VERTEX, vertexMap);
+    if (faceMap.IsEmpty() || vertexMap.IsEmpty()) {
+        return fingerprint;
+    }
+
+    GProp_GProps props;
+    GProp_GProps surfaceProps;
+    BRepGProp::SurfaceProperties(shape, surfaceProps);
+    if (TopExp_Explorer(shape, TopAbs_SOLID).More()) {
+        BRepGProp::VolumeProperties(shape, props);
+    }
+    else {
+        props = surfaceProps;
+    }
+    if (props.Mass() <= Precision::Confusion()) {
+        return fingerprint;
+    }
+
+    GProp_PrincipalProps principal = props.PrincipalProperties();
+    principal.Moments(fingerprint.moments[0], fingerprint.moments[1], fingerprint.moments[2]);
+    const gp_Vec axes[3] = {principal.FirstAxisOfInertia(),
+                            principal.SecondAxisOfInertia(),
+                            principal.ThirdAxisOfInertia()};
+    for (int i = 0; i < 3; ++i) {
+        fingerprint.axes[i] = Base::Vector3d(axes[i].X(), axes[i].Y(), axes[i].Z());
+    }
+    gp_Pnt center = props.CentreOfMass();
+    fingerprint.center = Base::Vector3d(center.X(), center.Y(), center.Z());
+
+    // Shapes with the same vertices can still differ by the geometry of their edges and faces, a
+    // point in their middle is compared as well.
+    auto& points = fingerprint.points;
+    points.reserve(vertexMap.Extent() + edgeMap.Extent() + faceMap.Extent());
+    for (int i = 1; i <= vertexMap.Extent(); ++i) {
+        gp_Pnt pnt = BRep_Tool::Pnt(TopoDS::Vertex(vertexMap(i)));
+        points.emplace_back(pnt.X(), pnt.Y(), pnt.Z());
+    }
+    std::map<int, int> curveTypes;
+    for (int i = 1; i <= edgeMap.Extent(); ++i) {
+        const TopoDS_Edge& edge = TopoDS::Edge(edgeMap(i));
+        if (BRep_Tool::Degenerated(edge)) {
+            continue;
+        }
+        BRepAdaptor_Curve curve(edge);
+        ++curveTypes[curve.GetType()];
+        gp_Pnt pnt = curve.Value((curve.FirstParameter() + curve.LastParameter()) / 2.0);
+        points.emplace_back(pnt.X(), pnt.Y(), pnt.Z());
+    }
+    std::map<int, int> surfaceTypes;
+    for (int i = 1; i <= faceMap.Extent(); ++i) {
+        const TopoDS_Face& face = TopoDS::Face(faceMap(i));
+        BRepAdaptor_Surface surface(face);
+        ++surfaceTypes[surface.GetType()];
+        Standard_Real u1, u2, v1, v2;
+        BRepTools::UVBounds(face, u1, u2, v1, v2);
+        gp_Pnt pnt = surface.Value((u1 + u2) / 2.0, (v1 + v2) / 2.0);
+        points.emplace_back(pnt.X(), pnt.Y(), pnt.Z());
+    }
+    for (const auto& point : points) {
+        fingerprint.size = std::max(fingerprint.size, Base::Distance(point, fingerprint.center));
+    }
+    std::sort(points.begin(), points.end(), [](const Base::Vector3d& a, const Base::Vector3d& b) {
+        return a.x < b.x;
+    });
+
+    std::ostringstream ss;
+    ss << std::setprecision(6) << faceMap.Extent() << ',' << edgeMap.Extent() << ','
+       << vertexMap.Extent() << ',' << props.Mass() << ',' << surfaceProps.Mass();
+    for (const auto& types : {surfaceTypes, curveTypes}) {
+        ss << ';';
+        for (const auto& type : types) {
+            ss << type.first << ':' << type.second << ',';
+        }
+    }
+    fingerprint.key = ss.str();
+    return fingerprint;
+}
+
+bool ImportOCAF2::findOffset(const ShapeFingerprint& shape,
+                             const ShapeFingerprint& other,
+                             Base::Placement& offset)
+{
+    if (shape.points.size() != other.points.size()) {
+        return false;
+    }
+
+    double tolerance = std::max(Precision::Confusion(), 1e-6 * shape.size);
+    auto matches = [&](const Base::Matrix4D& rotation) {
+        for (const auto& source : shape.points) {
+            Base::Vector3d point = rotation * (source - shape.center) + other.center;
+            auto it = std::lower_bound(other.points.begin(),
+                                       other.points.end(),
+                                       point.x - tolerance,
+                                       [](const Base::Vector3d& v, double x) {
+                                           return v.x < x;
+                                       });
+            bool found = false;
+            for (; it != other.points.end() && it->x <= point.x + tolerance; ++it) {
+                if (Base::Distance(*it, point) <= tolerance) {
+                    found = true;
+                    break;
+                }
+            }
+            if (!found) {
+                return false;
+            }
+        }
+        return true;
+    };
+    auto makeOffset = [&](const Base::Matrix4D& rotation) {
+        Base::Matrix4D matrix = rotation;
+        matrix.move(other.center - rotation * shape.center);
+        offset = Base::Placement(matrix);
+    };
+
+    // The principal axes of a turned shape can be given in another order, so the moments are
+    // paired in all the orders where they are the same.
+    static const int orders[6][3] =
+        {{0, 1, 2}, {0, 2, 1}, {1, 0, 2}, {1, 2, 0}, {2, 0, 1}, {2, 1, 0}};
+    double maxMoment = std::max({std::fabs(shape.moments[0]),
+                                 std::fabs(shape.moments[1]),
+                                 std::fabs(shape.moments[2])});
+    std::vector<const int*> pairings;
+    for (const auto& order : orders) {
+        bool same = true;
+        for (int i = 0; i < 3 && same; ++i) {
+            same = std::fabs(shape.moments[i] - other.moments[order[i]]) <= 1e-6 * maxMoment;
+        }
+        if (same) {
+            pairings.push_back(order);
+        }
+    }
+    if (pairings.empty()) {
+        return false;
+    }
+
+    // The shapes are often only moved, otherwise turn the principal axes of inertia of shape to
+    // those of other, in all the ways that are not a mirror.
+    Base::Matrix4D identity;
+    if (matches(identity)) {
+        makeOffset(identity);
+        return true;
+    }
+    auto orientation =
+        [](const Base::Vector3d& a, const Base::Vector3d& b, const Base::Vector3d& c) {
+            return (a % b) * c;
+        };
+    double shapeOrientation = orientation(shape.axes[0], shape.axes[1], shape.axes[2]);
+    for (const int* order : pairings) {
+        const Base::Vector3d otherAxes[3] = {other.axes[order[0]],
+                                             other.axes[order[1]],
+                                             other.axes[order[2]]};
+        double sign = shapeOrientation * orientation(otherAxes[0], otherAxes[1], otherAxes[2]);
+        for (int signs = 0; signs < 8; ++signs) {
+            double flips[3] = {signs & 1 ? -1.0 : 1.0,
+                               signs & 2 ? -1.0 : 1.0,
+                               signs & 4 ? -1.0 : 1.0};
+            if (sign * flips[0] * flips[1] * flips[2] < 0.0) {
+                continue;
+            }
+            Base::Matrix4D rotation;
+            for (int i = 0; i < 3; ++i) {
+                for (int j = 0; j < 3; ++j) {
+                    double value = 0.0;
+                    for (int k = 0; k < 3; ++k) {
+                        value += flips[k] * otherAxes[k][i] * shape.axes[k][j];
+                    }
+                    rotation[i][j] = value;
+                }
+            }
+            if (matches(rotation)) {
+                makeOffset(rotation);
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void ImportOCAF2::shareShapes(const std::vector<ShapeData*>& shapes)
+{
+    // Only shapes without colors of their own on sub shapes, which could not be kept.
+    std::unordered_map<std::string, std::vector<ShapeData*>> candidates;
+    size_t sharedCount = 0;
+    size_t savedSize = 0;
+    std::unordered_set<ShapeData*> prototypes;
+    for (auto data : shapes) {
+        if (data->fingerprint.key.empty() || !data->subShapeColors.empty()) {
+            continue;
+        }
+        auto& list = candidates[data->fingerprint.key];
+        for (auto prototype : list) {
+            Base::Placement offset;
+            if (prototype->info.faceColor != data->info.faceColor
+                || prototype->info.edgeColor != data->info.edgeColor
+                || !findOffset(prototype->fingerprint, data->fingerprint, offset)) {
+                continue;
+            }
+            mySharedShapes.emplace(data->shape,
+                                   SharedShape {prototype->label, prototype->shape, offset});
+            data->shared = true;
+            prototypes.insert(prototype);
+            ++sharedCount;
+            savedSize += Part::TopoShape(data->shape).getMemSize();
+            break;
+        }
+        if (!data->shared) {
+            list.push_back(data);
+        }
+    }
+
+    if (sharedCount) {
+        FC_MSG("Shared " << sharedCount << " identical shapes with " << prototypes.size()
+                         << " shapes, saving about " << savedSize / 1024 << " KiB");
+    }
+}
+
+void ImportOCAF2::prepareShapes()
+{
+    std::vector<ShapeData*> shapes;
+    shapes.reserve(myShapeData.size());
+    for (auto& v : myShapeData) {
+        shapes.push_back(&v.second);
+    }
+    // In reading order, so that the first of identical shapes is kept
+    std::sort(shapes.begin(), shapes.end(), [](const ShapeData* a, const ShapeData* b) {
+        return a->index < b->index;
+    });
+
+    runInParallel(shapes.size(), [&](size_t i) {
+        prepareShapeData(*shapes[i]);
+        if (options.shareShapes) {
+            shapes[i]->fingerprint = computeFingerprint(shapes[i]->shape);
+        }
+    });
+    if (options.shareShapes) {
+        shareShapes(shapes);
+    }
+    if (!options.tessellate) {
+        return;
+    }
+
+    // Shared shapes are not displayed, and meshing writes to the faces and edges, so shapes
+    // sharing some with a shape before them are tessellated afterwards in this thread.
+    std::vector<ShapeData*> meshed;
+    std::vector<ShapeData*> later;
+    std::unordered_set<const TopoDS_TShape*> subShapes;
+    for (auto data : shapes) {
+        if (data->shared) {
+            continue;
+        }
+        std::vector<const TopoDS_TShape*> own;
+        for (auto type : {TopAbs_FACE, TopAbs_EDGE}) {
+            for (TopExp_Explorer exp(data->shape, type); exp.More(); exp.Next()) {
+                own.push_back(exp.Current().TShape().get());
+            }
+        }
+        if (std::any_of(own.begin(), own.end(), [&](const TopoDS_TShape* sub) {
+                return subShapes.count(sub) > 0;
+            })) {
+            later.push_back(data);
+        }
+        else {
+            subShapes.insert(own.begin(), own.end());
+            meshed.push_back(data);
+        }
+    }
+
+    ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Part");
+    double deviation = hGrp->GetFloat("MeshDeviation", 0.2);
+    double angularDeflection = Base::toRadians(hGrp->GetFloat("MeshAngularDeflection", 28.65));
+    runInParallel(meshed.size(), [&](size_t i) {
+        tessellateShape(meshed[i]->shape, deviation, angularDeflection);
+    });
+    for (auto data : later) {
+        tessellateShape(data->shape, deviation, angularDeflection);
+    }
+}
+
 App::Document* ImportOCAF2::getDocument(App::Document* doc, TDF_Label label)
 {
     if (filePath.empty() || options.mode == SingleDoc || options.merge) {
@@ -526,18 +950,35 @@ App::DocumentObject* ImportOCAF2::loadShapes()
     myShapes.clear();
     myNames.clear();
     myCollapsedObjects.clear();
+    myShapeData.clear();
+    mySharedShapes.clear();
 
     std::vector<App::DocumentObject*> objs;
     aShapeTool->GetFreeShapes(labels);
     boost::dynamic_bitset<> vis;
     int count = 0;
+
+    // First read what is needed from the labels, then do the heavy part of it in parallel, and
+    // last create the objects. The labels are read in this thread as OCAF is not thread safe, the
+    // shape and color tools share their label and attribute maps without any locking.
+    FC_TIME_INIT(t);
+    std::unordered_set<TopoDS_Shape, ShapeHasher> visited;
     for (Standard_Integer i = 1; i <= labels.Length(); i++) {
         auto label = labels.Value(i);
         if (!options.importHidden && !aColorTool->IsVisible(label)) {
             continue;
         }
         ++count;
+        if (options.parallel) {
+            collectShapes(aShapeTool->GetShape(label), visited);
+        }
     }
+    if (options.parallel) {
+        FC_TIME_LOG(t, "Read " << myShapeData.size() << " shapes");
+        prepareShapes();
+        FC_TIME_LOG(t, "Prepare shapes");
+    }
+
     for (Standard_Integer i = 1; i <= labels.Length(); i++) {
         auto label = labels.Value(i);
         if (!options.importHidden && !aColorTool->IsVisible(label)) {
@@ -549,6 +990,10 @@ App::DocumentObject* ImportOCAF2::loadShapes()
             vis.push_back(aColorTool->IsVisible(label));
         }
     }
+    myShapeData.clear();
+    mySharedShapes.clear();
+    FC_TIME_LOG(t, "Create objects");
+
     App::DocumentObject* ret = nullptr;
     if (objs.size() == 1) {
         ret = objs.front();
@@ -662,7 +1107,19 @@ App::DocumentObject* ImportOCAF2::loadShape(App::Document* doc,
 
     auto baseShape = shape.Located(TopLoc_Location());
     auto it = myShapes.find(baseShape);
-    if (it == myShapes.end()) {
+    auto itShared = it == myShapes.end() ? mySharedShapes.find(baseShape) : mySharedShapes.end();
+    if (itShared != mySharedShapes.end()) {
+        // Linked to the object of an identical shape
+        const SharedShape& shared = itShared->second;
+        if (!loadShape(doc, shared.label, shared.shape, true, newDoc)) {
+            return nullptr;
+        }
+        Info info = myShapes[shared.shape];
+        info.free = false;
+        info.offset = shared.offset;
+        it = myShapes.emplace(baseShape, info).first;
+    }
+    else if (it == myShapes.end()) {
         Info info;
         auto baseLabel = aShapeTool->FindShape(baseShape);
         if (sequencer && !baseLabel.IsNull() && aShapeTool->IsTopLevel(baseLabel)) {
@@ -717,6 +1174,7 @@ App::DocumentObject* ImportOCAF2::loadShape(App::Document* doc,
 
     auto link = doc->addObject<App::Link>("Link");
     link->setLink(-1, info.obj);
+    link->Placement.setValue(info.offset);
     setPlacement(&link->Placement, shape);
     info.obj = link;
     setObjectName(info, label);
@@ -792,8 +1250,12 @@ bool ImportOCAF2::createAssembly(App::Document* _doc,
 
         childInfo.vis.push_back(vis);
         childInfo.labels.push_back(childLabel);
-        childInfo.plas.emplace_back(
-            Part::TopoShape::convert(childShape.Location().Transformation()));
+        Base::Placement pla(Part::TopoShape::convert(childShape.Location().Transformation()));
+        auto itShape = myShapes.find(childShape.Located(TopLoc_Location()));
+        if (itShape != myShapes.end()) {
+            pla *= itShape->second.offset;
+        }
+        childInfo.plas.push_back(pla);
         Quantity_ColorRGBA aColor;
         if (aColorTool->GetColor(childShape, XCAFDoc_ColorSurf, aColor)) {
             childInfo.colors[childInfo.plas.size() - 1] = Tools::convertColor(aColor);
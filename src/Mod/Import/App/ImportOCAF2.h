@@ -28,13 +28,16 @@
 #include <set>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
+#include <TDF_Label.hxx>
 #include <TDocStd_Document.hxx>
 #include <TopoDS_Shape.hxx>
 #include <XCAFDoc_ColorTool.hxx>
 #include <XCAFDoc_ShapeTool.hxx>
 
+#include <Base/Placement.h>
 #include <Base/Sequencer.h>
 #include <Mod/Part/App/TopoShape.h>
 
@@ -71,6 +74,12 @@ struct ImportExport ImportOCAFOptions
     bool reduceObjects = false;
     bool showProgress = false;
     bool expandCompound = false;
+    // Prepare the shapes in parallel before creating the objects, instead of one at a time.
+    bool parallel = true;
+    // Tessellate the shapes for display while they are read, in parallel.
+    bool tessellate = false;
+    // Create identical shapes once and link to them.
+    bool shareShapes = false;
     int mode = 0;
 };
 
@@ -108,6 +117,18 @@ public:
     {
         options.expandCompound = enable;
     }
+    void setParallel(bool enable)
+    {
+        options.parallel = enable;
+    }
+    void setTessellate(bool enable)
+    {
+        options.tessellate = enable;
+    }
+    void setShareShapes(bool enable)
+    {
+        options.shareShapes = enable;
+    }
 
     enum ImportMode
     {
@@ -124,6 +145,26 @@ public:
         return options.mode;
     }
 
+    /// What identical shapes have in common wherever they are placed, to find them.
+    struct ShapeFingerprint
+    {
+        std::string key;
+        Base::Vector3d center;
+        Base::Vector3d axes[3];
+        double moments[3] = {};
+        // The vertices and a point in the middle of each edge and face, sorted along X.
+        std::vector<Base::Vector3d> points;
+        double size = 0.0;
+    };
+    /// Returns an empty key if the shape has no face.
+    static ShapeFingerprint computeFingerprint(const TopoDS_Shape& shape);
+    /** Finds the placement that moves a shape onto another one of the same key, without mirroring
+     * it. Returns false if there is none.
+     */
+    static bool findOffset(const ShapeFingerprint& shape,
+                           const ShapeFingerprint& other,
+                           Base::Placement& offset);
+
 private:
     struct Info
     {
@@ -135,6 +176,40 @@ private:
         bool hasFaceColor = false;
         bool hasEdgeColor = false;
         int free = true;
+        // Placement of the shape relative to the shape of obj, when shared with another shape
+        Base::Placement offset;
+    };
+
+    // The colors of a shape read from its label. The objects are created from it after it is
+    // prepared, which does not need the document so that all shapes can be prepared in parallel.
+    struct SubShapeColor
+    {
+        TopoDS_Shape shape;
+        App::Color faceColor;
+        App::Color edgeColor;
+        bool hasFaceColor = false;
+        bool hasEdgeColor = false;
+    };
+    struct ShapeData
+    {
+        size_t index = 0;
+        TDF_Label label;
+        TopoDS_Shape shape;
+        Info info;
+        std::vector<SubShapeColor> subShapeColors;
+        // Set when prepared
+        std::vector<App::Color> faceColors;
+        std::vector<App::Color> edgeColors;
+        bool hasFaceColors = false;
+        bool hasEdgeColors = false;
+        ShapeFingerprint fingerprint;
+        bool shared = false;
+    };
+    struct SharedShape
+    {
+        TDF_Label label;
+        TopoDS_Shape shape;
+        Base::Placement offset;
     };
 
     App::DocumentObject* loadShape(App::Document* doc,
@@ -167,6 +242,12 @@ private:
     std::string getLabelName(TDF_Label label);
     App::DocumentObject*
     expandShape(App::Document* doc, TDF_Label label, const TopoDS_Shape& shape);
+    void collectShapes(const TopoDS_Shape& shape,
+                       std::unordered_set<TopoDS_Shape, ShapeHasher>& visited);
+    ShapeData readShapeData(TDF_Label label, const TopoDS_Shape& shape);
+    static void prepareShapeData(ShapeData& data);
+    void prepareShapes();
+    void shareShapes(const std::vector<ShapeData*>& shapes);
 
     virtual void applyEdgeColors(Part::Feature*, const std::vector<App::Color>&)
     {}
@@ -208,6 +289,9 @@ private:
     std::unordered_map<TopoDS_Shape, Info, ShapeHasher> myShapes;
     std::unordered_map<TDF_Label, std::string, LabelHasher> myNames;
     std::unordered_map<App::DocumentObject*, App::PropertyPlacement*> myCollapsedObjects;
+    std::unordered_map<TopoDS_Shape, ShapeData, ShapeHasher> myShapeData;
+    // Shapes created as links to an identical shape
+    std::unordered_map<TopoDS_Shape, SharedShape, ShapeHasher> mySharedShapes;
 
     Base::SequencerLauncher* sequencer {nullptr};
 };
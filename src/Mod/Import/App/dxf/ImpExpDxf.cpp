@@ -53,11 +53,16 @@
 #include <gp_Vec.hxx>
 #endif
 
+#include <atomic>
+#include <future>
+#include <thread>
+
 #include <App/Annotation.h>
 #include <App/Application.h>
 #include <App/Document.h>
 #include <App/DocumentObjectPy.h>
 #include <App/FeaturePythonPyImp.h>
+#include <App/Link.h>
 #include <Base/Console.h>
 #include <Base/Interpreter.h>
 #include <Base/Matrix.h>
@@ -76,6 +81,45 @@ using namespace Import;
 using BRepAdaptor_HCurve = BRepAdaptor_Curve;
 #endif
 
+namespace
+{
+// Split a block insertion transform into the placement and the scale factors of a link. This is
+// only possible while the transformed axes stay perpendicular, which is not the case when a
+// non-uniformly scaled block is rotated by an enclosing INSERT.
+bool splitInsertTransform(const Base::Matrix4D& transform,
+                          Base::Placement& placement,
+                          Base::Vector3d& scale)
+{
+    const double tolerance = 1e-9;
+    Base::Vector3d axes[3] = {transform.getCol(0), transform.getCol(1), transform.getCol(2)};
+    double lengths[3];
+    for (int i = 0; i < 3; ++i) {
+        lengths[i] = axes[i].Length();
+        if (lengths[i] < tolerance) {
+            return false;
+        }
+        axes[i] /= lengths[i];
+    }
+    if (std::fabs(axes[0] * axes[1]) > tolerance || std::fabs(axes[1] * axes[2]) > tolerance
+        || std::fabs(axes[2] * axes[0]) > tolerance) {
+        return false;
+    }
+    // A mirrored block keeps a proper rotation and gets a negative X scale.
+    if ((axes[0] % axes[1]) * axes[2] < 0) {
+        axes[0] = -axes[0];
+        lengths[0] = -lengths[0];
+    }
+    Base::Matrix4D rotation;
+    for (unsigned short i = 0; i < 3; ++i) {
+        rotation.setCol(i, axes[i]);
+    }
+    rotation.setCol(3, transform.getCol(3));
+    placement = Base::Placement(rotation);
+    scale = Base::Vector3d(lengths[0], lengths[1], lengths[2]);
+    return true;
+}
+}  // namespace
+
 
 //******************************************************************************
 // reading
@@ -97,6 +141,7 @@ bool ImpExpDxfRead::ReadEntitiesSection()
             if (!CDxfRead::ReadEntitiesSection()) {
                 return false;
             }
+            savingCollector.BuildEdges();
         }
 
         // Merge the contents of ShapesToCombine and AddObject the result(s)
@@ -170,6 +215,7 @@ void ImpExpDxfRead::setOptions()
     m_importPoints = hGrp->GetBool("dxfImportPoints", true);
     m_importPaperSpaceEntities = hGrp->GetBool("dxflayout", false);
     m_importHiddenBlocks = hGrp->GetBool("dxfstarblocks", false);
+    m_importBlocksAsLinks = hGrp->GetBool("dxfBlocksAsLinks", false);
     // TODO: There is currently no option for this: m_importFrozenLayers =
     // hGrp->GetBool("dxffrozenLayers", false);
     // TODO: There is currently no option for this: m_importHiddenLayers =
@@ -213,7 +259,7 @@ void ImpExpDxfRead::OnReadLine(const Base::Vector3d& start,
         // TODO: Really?? What about the people designing integrated circuits?
         return;
     }
-    Collector->AddObject(BRepBuilderAPI_MakeEdge(p0, p1).Edge(), "Line");
+    Collector->AddEdge({EdgeDefinition::Line, p0, p1, gp_Pnt(), true}, "Line");
 }
 
 
@@ -231,14 +277,9 @@ void ImpExpDxfRead::OnReadArc(const Base::Vector3d& start,
 {
     gp_Pnt p0 = makePoint(start);
     gp_Pnt p1 = makePoint(end);
-    gp_Dir up(0, 0, 1);
-    if (!dir) {
-        up = -up;
-    }
     gp_Pnt pc = makePoint(center);
-    gp_Circ circle(gp_Ax2(pc, up), p0.Distance(pc));
-    if (circle.Radius() > 0) {
-        Collector->AddObject(BRepBuilderAPI_MakeEdge(circle, p0, p1).Edge(), "Arc");
+    if (p0.Distance(pc) > 0) {
+        Collector->AddEdge({EdgeDefinition::Arc, p0, p1, pc, dir}, "Arc");
     }
     else {
         Base::Console().Warning("ImpExpDxf - ignore degenerate arc of circle\n");
@@ -252,14 +293,9 @@ void ImpExpDxfRead::OnReadCircle(const Base::Vector3d& start,
                                  bool /*hidden*/)
 {
     gp_Pnt p0 = makePoint(start);
-    gp_Dir up(0, 0, 1);
-    if (!dir) {
-        up = -up;
-    }
     gp_Pnt pc = makePoint(center);
-    gp_Circ circle(gp_Ax2(pc, up), p0.Distance(pc));
-    if (circle.Radius() > 0) {
-        Collector->AddObject(BRepBuilderAPI_MakeEdge(circle).Edge(), "Circle");
+    if (p0.Distance(pc) > 0) {
+        Collector->AddEdge({EdgeDefinition::Circle, p0, p0, pc, dir}, "Circle");
     }
     else {
         Base::Console().Warning("ImpExpDxf - ignore degenerate circle\n");
@@ -474,6 +510,10 @@ void ImpExpDxfRead::ExpandInsert(const std::string& name,
     localTransform.rotZ(rotation);
     localTransform.move(point[0], point[1], point[2]);
     localTransform = transform * localTransform;
+    Base::Placement linkPlacement;
+    Base::Vector3d linkScale;
+    bool useLinks = m_importBlocksAsLinks
+        && splitInsertTransform(localTransform, linkPlacement, linkScale);
     CommonEntityAttributes mainAttributes = m_entityAttributes;
     for (const auto& [attributes, shapes] : block.Shapes) {
         // Put attributes into m_entityAttributes after using the latter to set byblock values in
@@ -481,6 +521,10 @@ void ImpExpDxfRead::ExpandInsert(const std::string& name,
         m_entityAttributes = attributes;
         m_entityAttributes.ResolveByBlockAttributes(mainAttributes);
 
+        if (useLinks) {
+            AddBlockLink(block, shapes, linkPlacement, linkScale);
+            continue;
+        }
         for (const TopoDS_Shape& shape : shapes) {
             // TODO???: See the comment in TopoShape::makeTransform regarding calling
             // Moved(identityTransform) on the new shape
@@ -528,6 +572,36 @@ void ImpExpDxfRead::ExpandInsert(const std::string& name,
     }
 }
 
+void ImpExpDxfRead::AddBlockLink(Block& block,
+                                 const std::list<TopoDS_Shape>& shapes,
+                                 const Base::Placement& placement,
+                                 const Base::Vector3d& scale)
+{
+    // The prototype is keyed on the resolved attributes so that BYBLOCK colors and line types of
+    // different INSERTs get their own styled copy.
+    Part::Feature*& prototype = block.Prototypes[m_entityAttributes];
+    if (prototype == nullptr) {
+        BRep_Builder builder;
+        TopoDS_Compound comp;
+        builder.MakeCompound(comp);
+        for (const auto& shape : shapes) {
+            if (!shape.IsNull()) {
+                builder.Add(comp, shape);
+            }
+        }
+        prototype = document->addObject<Part::Feature>("Block");
+        prototype->Label.setValue(block.Name);
+        prototype->Shape.setValue(comp);
+        prototype->Visibility.setValue(false);
+        ApplyGuiStyles(prototype);
+    }
+    auto link = document->addObject<App::Link>("Insert");
+    link->setLink(-1, prototype);
+    link->Placement.setValue(placement);
+    link->ScaleVector.setValue(scale);
+    MoveToLayer(link);
+}
+
 
 void ImpExpDxfRead::OnReadDimension(const Base::Vector3d& start,
                                     const Base::Vector3d& end,
@@ -592,6 +666,7 @@ void ImpExpDxfRead::OnReadPolyline(std::list<VertexInfo>& vertices, int flags)
         // because they are constant throughout.
         ShapeSavingEntityCollector savingCollector(*this, ShapesToCombine);
         ExplodePolyline(vertices, flags);
+        savingCollector.BuildEdges();
     }
     // Join the shapes.
     if (!ShapesToCombine.empty()) {
@@ -733,6 +808,74 @@ std::string ImpExpDxfRead::Deformat(const char* text)
     return ss.str();
 }
 
+TopoDS_Shape ImpExpDxfRead::EdgeDefinition::MakeEdge() const
+{
+    if (Type == Line) {
+        return BRepBuilderAPI_MakeEdge(Start, End).Edge();
+    }
+    gp_Dir up(0, 0, 1);
+    if (!Dir) {
+        up = -up;
+    }
+    gp_Circ circle(gp_Ax2(Center, up), Start.Distance(Center));
+    if (Type == Circle) {
+        return BRepBuilderAPI_MakeEdge(circle).Edge();
+    }
+    return BRepBuilderAPI_MakeEdge(circle, Start, End).Edge();
+}
+
+std::vector<TopoDS_Shape> ImpExpDxfRead::MakeEdges(const std::vector<EdgeDefinition>& edges)
+{
+    // Small batches, such as the pieces of a single polyline, are not worth starting threads for.
+    const std::size_t batchSize = 4096;
+    std::vector<TopoDS_Shape> result(edges.size());
+    std::atomic<std::size_t> next(0);
+    std::atomic<int> failures(0);
+    auto worker = [&]() {
+        for (;;) {
+            std::size_t first = next.fetch_add(batchSize);
+            if (first >= edges.size()) {
+                return;
+            }
+            std::size_t last = std::min(first + batchSize, edges.size());
+            for (std::size_t i = first; i < last; ++i) {
+                try {
+                    result[i] = edges[i].MakeEdge();
+                }
+                catch (const Standard_Failure&) {
+                    ++failures;
+                }
+            }
+        }
+    };
+
+    std::size_t threadCount = std::max(1U, std::thread::hardware_concurrency());
+    threadCount = std::min(threadCount, (edges.size() + batchSize - 1) / batchSize);
+    std::vector<std::future<void>> workers;
+    for (std::size_t i = 1; i < threadCount; ++i) {
+        workers.push_back(std::async(std::launch::async, worker));
+    }
+    worker();
+    for (auto& future : workers) {
+        future.get();
+    }
+    if (failures > 0) {
+        Base::Console().Warning("ImpExpDxf - failed to create %d edges\n", int(failures));
+    }
+    return result;
+}
+
+void ImpExpDxfRead::ShapeSavingEntityCollector::BuildEdges()
+{
+    for (auto& [attributes, edges] : EdgesList) {
+        std::list<TopoDS_Shape>& shapes = ShapesList[attributes];
+        for (auto& edge : MakeEdges(edges)) {
+            shapes.push_back(std::move(edge));
+        }
+    }
+    EdgesList.clear();
+}
+
 void ImpExpDxfRead::DrawingEntityCollector::AddObject(const TopoDS_Shape& shape,
                                                       const char* nameBase)
 {
@@ -112,6 +112,25 @@ private:
     {
         return {point3d.x, point3d.y, point3d.z};
     }
+    // Compact description of a line, arc or circle from which the edge can be built later,
+    // possibly on another thread.
+    struct EdgeDefinition
+    {
+        enum EdgeType
+        {
+            Line,
+            Arc,
+            Circle
+        };
+        EdgeType Type;
+        gp_Pnt Start;
+        gp_Pnt End;
+        gp_Pnt Center;
+        bool Dir;
+        TopoDS_Shape MakeEdge() const;
+    };
+    // Build the edges in parallel batches. Edges which cannot be built are left null.
+    static std::vector<TopoDS_Shape> MakeEdges(const std::vector<EdgeDefinition>& edges);
     void MoveToLayer(App::DocumentObject* object) const;
     // Combine all the shapes in the given shapes collection into a single shape, and AddObject that
     // to the drawing. unref's all the shapes in the collection, possibly freeing them.
@@ -190,12 +209,22 @@ protected:
         std::map<CDxfRead::CommonEntityAttributes, std::list<FeaturePythonBuilder>>
             FeatureBuildersList;
         std::map<CDxfRead::CommonEntityAttributes, std::list<Insert>> Inserts;
+        // The hidden objects holding the block's shapes which INSERTs link to, one for each set of
+        // resolved entity attributes.
+        std::map<CDxfRead::CommonEntityAttributes, Part::Feature*> Prototypes;
     };
 
 private:
+    // Place the shapes of a block by linking to a shared copy of them rather than transforming
+    // each shape.
+    void AddBlockLink(Block& block,
+                      const std::list<TopoDS_Shape>& shapes,
+                      const Base::Placement& placement,
+                      const Base::Vector3d& scale);
     std::map<std::string, Block> Blocks;
     App::Document* document;
     std::string m_optionSource;
+    bool m_importBlocksAsLinks = false;
 
 protected:
     virtual void ApplyGuiStyles(Part::Feature* /*object*/) const
@@ -227,6 +256,12 @@ protected:
 
         // Called by OnReadXxxx functions to add Part objects
         virtual void AddObject(const TopoDS_Shape& shape, const char* nameBase) = 0;
+        // Called by OnReadLine, OnReadArc and OnReadCircle. Collectors which only gather shapes
+        // may defer building the edge.
+        virtual void AddEdge(const EdgeDefinition& edge, const char* nameBase)
+        {
+            AddObject(edge.MakeEdge(), nameBase);
+        }
         // Called by OnReadXxxx functions to add FeaturePython (draft) objects.
         // Because we can't readily copy Draft objects, this method instead takes a builder which,
         // when called, creates and returns the object.
@@ -277,9 +312,17 @@ protected:
         {
             ShapesList[Reader.m_entityAttributes].push_back(shape);
         }
+        void AddEdge(const EdgeDefinition& edge, const char* /*nameBase*/) override
+        {
+            EdgesList[Reader.m_entityAttributes].push_back(edge);
+        }
+        // Build the gathered edges and add them to the shapes list. This must be called before the
+        // shapes list is used.
+        void BuildEdges();
 
     private:
         std::map<CDxfRead::CommonEntityAttributes, std::list<TopoDS_Shape>>& ShapesList;
+        std::map<CDxfRead::CommonEntityAttributes, std::vector<EdgeDefinition>> EdgesList;
     };
 #ifdef LATER
     class PolylineEntityCollector: public CombiningDrawingEntityCollector
@@ -1800,8 +1800,10 @@ void CDxfWrite::writeObjectsSection()
 const DxfUnits DxfUnits::Instance;
 
 CDxfRead::CDxfRead(const std::string& filepath)
-    : m_ifs(new ifstream(filepath))
+    : m_ifs(new ifstream(filepath, std::ios::binary))
+    , m_valueStream(std::make_unique<istringstream>())
 {
+    m_valueStream->imbue(std::locale("C"));
     if (!(*m_ifs)) {
         m_fail = true;
         ImportError("DXF file didn't load\n");
@@ -1870,9 +1872,8 @@ void CDxfRead::SetupValueAttribute(eDXFGroupCode_t record_type, T& destination)
 // Static processing helpers for ProcessCommonEntityAttribute
 void CDxfRead::ProcessScaledDouble(CDxfRead* object, void* target)
 {
-    std::istringstream ss;
-    ss.imbue(std::locale("C"));
-
+    std::istringstream& ss = *object->m_valueStream;
+    ss.clear();
     ss.str(object->m_record_data);
     double value = 0;
     ss >> value;
@@ -1884,9 +1885,8 @@ void CDxfRead::ProcessScaledDouble(CDxfRead* object, void* target)
 }
 void CDxfRead::ProcessScaledDoubleIntoList(CDxfRead* object, void* target)
 {
-    std::istringstream ss;
-    ss.imbue(std::locale("C"));
-
+    std::istringstream& ss = *object->m_valueStream;
+    ss.clear();
     ss.str(object->m_record_data);
     double value = 0;
     ss >> value;
@@ -1899,9 +1899,8 @@ void CDxfRead::ProcessScaledDoubleIntoList(CDxfRead* object, void* target)
 template<typename T>
 bool CDxfRead::ParseValue(CDxfRead* object, void* target)
 {
-    std::istringstream ss;
-    ss.imbue(std::locale("C"));
-
+    std::istringstream& ss = *object->m_valueStream;
+    ss.clear();
     ss.str(object->m_record_data);
     ss >> *static_cast<T*>(target);
     if (ss.fail()) {
@@ -2350,6 +2349,67 @@ void CDxfRead::UnsupportedFeature(const char* format, args&&... argValuess)
     }
 }
 
+bool CDxfRead::get_next_line(std::string& line)
+{
+    constexpr std::size_t blockSize = 1 << 20;
+    line.clear();
+    for (;;) {
+        if (m_bufferPos == m_bufferEnd) {
+            if (!m_ifs->good()) {
+                // A last line without a terminating newline still counts as a line.
+                return !line.empty();
+            }
+            if (m_buffer.size() < blockSize) {
+                m_buffer.resize(blockSize);
+            }
+            m_ifs->read(m_buffer.data(), std::streamsize(m_buffer.size()));
+            m_bufferPos = 0;
+            m_bufferEnd = std::size_t(m_ifs->gcount());
+            if (m_bufferEnd == 0) {
+                return !line.empty();
+            }
+        }
+        const char* begin = m_buffer.data() + m_bufferPos;
+        auto end = static_cast<const char*>(memchr(begin, '\n', m_bufferEnd - m_bufferPos));
+        if (end != nullptr) {
+            line.append(begin, end);
+            m_bufferPos += end - begin + 1;
+            return true;
+        }
+        // The line continues in the next block
+        line.append(begin, m_bufferEnd - m_bufferPos);
+        m_bufferPos = m_bufferEnd;
+    }
+}
+
+// Group codes are plain integers, possibly surrounded by blanks. They are read for every record
+// in the file, so parse them directly rather than through a stream.
+static bool ParseGroupCode(const std::string& text, int& code)
+{
+    const char* next = text.c_str();
+    while (*next == ' ' || *next == '\t') {
+        ++next;
+    }
+    bool negative = *next == '-';
+    if (negative || *next == '+') {
+        ++next;
+    }
+    if (*next < '0' || *next > '9') {
+        return false;
+    }
+    code = 0;
+    while (*next >= '0' && *next <= '9') {
+        code = code * 10 + (*next++ - '0');
+    }
+    while (*next == ' ' || *next == '\t' || *next == '\r') {
+        ++next;
+    }
+    if (negative) {
+        code = -code;
+    }
+    return *next == '\0';
+}
+
 bool CDxfRead::get_next_record()
 {
     if (m_repeat_last_record) {
@@ -2358,25 +2418,21 @@ bool CDxfRead::get_next_record()
     }
 
     do {
-        if ((*m_ifs).eof()) {
+        if (!get_next_line(m_record_data)) {
             m_not_eof = false;
             return false;
         }
-
-        std::getline(*m_ifs, m_record_data);
         ++m_line;
         int temp = 0;
-        if (!ParseValue<int>(this, &temp)) {
+        if (!ParseGroupCode(m_record_data, temp)) {
             ImportError("CDxfRead::get_next_record() Failed to get integer record type from '%s'\n",
                         m_record_data);
             return false;
         }
         m_record_type = (eDXFGroupCode_t)temp;
-        if ((*m_ifs).eof()) {
+        if (!get_next_line(m_record_data)) {
             return false;
         }
-
-        std::getline(*m_ifs, m_record_data);
         ++m_line;
     } while (m_record_type == eComment);
 
@@ -17,6 +17,7 @@
 #include <iosfwd>
 #include <list>
 #include <map>
+#include <memory>
 #include <set>
 #include <string>
 #include <vector>
@@ -441,6 +442,14 @@ class ImportExport CDxfRead
 private:
     // Low-level reader members
     std::ifstream* m_ifs;  // TODO: gsl::owner<ifstream>
+    // The file is read in large blocks and split into lines in place, which is much faster than
+    // std::getline on files with millions of records.
+    std::vector<char> m_buffer;
+    std::size_t m_bufferPos = 0;
+    std::size_t m_bufferEnd = 0;
+    // Stream with the "C" locale reused for all value parsing, because imbuing a fresh stream for
+    // every value costs more than the parse itself.
+    std::unique_ptr<std::istringstream> m_valueStream;
     // https://stackoverflow.com/questions/41167119/how-to-fix-a-wsubobject-linkage-warning
     eDXFGroupCode_t m_record_type = eObjectType;
     std::string m_record_data;
@@ -664,6 +673,7 @@ private:
     bool ReadBlockInfo();
     bool ResolveEncoding();
 
+    bool get_next_line(std::string& line);
     bool get_next_record();
     void repeat_last_record();
 
@@ -64,6 +64,7 @@
 #include <Mod/Import/App/ReaderGltf.h>
 #include <Mod/Import/App/ReaderIges.h>
 #include <Mod/Import/App/ReaderStep.h>
+#include <Mod/Import/App/ExportGlb.h>
 #include <Mod/Import/App/WriterGltf.h>
 #include <Mod/Import/App/WriterIges.h>
 #include <Mod/Import/App/WriterStep.h>
@@ -141,6 +142,7 @@ private:
             options.setItem("reduceObjects", Py::Boolean(stepSettings.reduceObjects));
             options.setItem("showProgress", Py::Boolean(stepSettings.showProgress));
             options.setItem("expandCompound", Py::Boolean(stepSettings.expandCompound));
+            options.setItem("shareShapes", Py::Boolean(stepSettings.shareShapes));
             options.setItem("mode", Py::Long(stepSettings.mode));
             options.setItem("codePage", Py::Long(stepSettings.codePage));
         }
@@ -202,6 +204,8 @@ private:
             hApp->NewDocument(TCollection_ExtendedString("MDTV-CAF"), hDoc);
             ImportOCAFGui ocaf(hDoc, pcDoc, file.fileNamePure());
             ocaf.setImportOptions(ImportOCAFGui::customImportOptions());
+            // The shapes will be displayed, so tessellate them while importing
+            ocaf.setTessellate(true);
             FC_TIME_INIT(t);
             FC_DURATION_DECL_INIT2(d1, d2);
 
@@ -244,6 +248,10 @@ private:
                         ocaf.setExpandCompound(
                             static_cast<bool>(Py::Boolean(options.getItem("expandCompound"))));
                     }
+                    if (options.hasKey("shareShapes")) {
+                        ocaf.setShareShapes(
+                            static_cast<bool>(Py::Boolean(options.getItem("shareShapes"))));
+                    }
                     if (options.hasKey("mode")) {
                         ocaf.setMode(static_cast<int>(Py::Long(options.getItem("mode"))));
                     }
@@ -511,6 +519,15 @@ private:
                 }
             }
 
+            // binary glTF is written directly from the shapes without an OCAF document
+            Base::FileInfo file(Utf8Name.c_str());
+            if (!legacyExport && file.hasExtension("glb")) {
+                Import::ExportGlb glb(file, &getShapeColors);
+                glb.setExportHiddenObject(exportHidden);
+                glb.exportObjects(objs);
+                return Py::None();
+            }
+
             Handle(XCAFApp_Application) hApp = XCAFApp_Application::GetApplication();
             Handle(TDocStd_Document) hDoc;
             hApp->NewDocument(TCollection_ExtendedString("MDTV-CAF"), hDoc);
@@ -529,7 +546,6 @@ private:
                 ocaf.exportObjects(objs);
             }
 
-            Base::FileInfo file(Utf8Name.c_str());
             if (file.hasExtension({"stp", "step"})) {
                 ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
                     "User parameter:BaseApp/Preferences/Mod/Part/STEP");
@@ -19,7 +19,9 @@
 #                                                                         *
 # **************************************************************************
 
+import json
 import os
+import struct
 import tempfile
 import unittest
 import FreeCAD as App
@@ -89,3 +91,59 @@ class ExportImportTest(unittest.TestCase):
 
         mat = paths.get(2).getTail()
         self.assertEqual(mat.diffuseColor.getNum(), 6)
+
+    def testExportGlbLinkArray(self):
+        """
+        Export a link array to binary glTF and check that the elements share one mesh
+        """
+        fileName = tempfile.gettempdir() + os.sep + "LinkArrayTest.glb"
+        box = self.doc.addObject("Part::Box", "Box")
+        array = self.doc.addObject("App::Link", "Array")
+        array.LinkedObject = box
+        array.ElementCount = 10
+        self.doc.recompute()
+
+        ImportGui.export([array], fileName)
+
+        with open(fileName, "rb") as f:
+            data = f.read()
+        os.remove(fileName)
+
+        magic, version, length = struct.unpack_from("<III", data, 0)
+        self.assertEqual(magic, 0x46546C67)
+        self.assertEqual(version, 2)
+        self.assertEqual(length, len(data))
+
+        jsonLength, jsonType = struct.unpack_from("<II", data, 12)
+        self.assertEqual(jsonType, 0x4E4F534A)
+        gltf = json.loads(data[20 : 20 + jsonLength].decode("utf-8"))
+        binLength, binType = struct.unpack_from("<II", data, 20 + jsonLength)
+        self.assertEqual(binType, 0x004E4942)
+        self.assertEqual(binLength, gltf["buffers"][0]["byteLength"])
+
+        self.assertEqual(len(gltf["meshes"]), 1)
+        instances = [node for node in gltf["nodes"] if node.get("mesh") == 0]
+        self.assertEqual(len(instances), 10)
+
+    def testExportGlbWithoutMeshes(self):
+        """
+        Export an empty group to binary glTF and check that there is no binary chunk
+        """
+        fileName = tempfile.gettempdir() + os.sep + "EmptyGroupTest.glb"
+        group = self.doc.addObject("App::DocumentObjectGroup", "Group")
+        self.doc.recompute()
+
+        ImportGui.export([group], fileName)
+
+        with open(fileName, "rb") as f:
+            data = f.read()
+        os.remove(fileName)
+
+        magic, version, length = struct.unpack_from("<III", data, 0)
+        self.assertEqual(magic, 0x46546C67)
+        self.assertEqual(length, len(data))
+        jsonLength, jsonType = struct.unpack_from("<II", data, 12)
+        self.assertEqual(jsonType, 0x4E4F534A)
+        self.assertEqual(len(data), 20 + jsonLength)
+        gltf = json.loads(data[20 : 20 + jsonLength].decode("utf-8"))
+        self.assertNotIn("buffers", gltf)
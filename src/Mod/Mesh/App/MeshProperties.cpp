@@ -720,7 +720,7 @@ bool PropertyMaterial::isSame(const App::Property& other) const
 // ----------------------------------------------------------------------------
 
 PropertyMeshKernel::PropertyMeshKernel()
-    : _meshObject(new MeshObject())
+    : _meshObject(std::make_shared<Base::Reference<MeshObject>>(new MeshObject()))
 {
     // Note: Normally this property is a member of a document object, i.e. the setValue()
     // method gets called in the constructor of a subclass of DocumentObject, e.g. Mesh::Feature.
@@ -738,68 +738,124 @@ PropertyMeshKernel::~PropertyMeshKernel()
     }
 }
 
+MeshObject* PropertyMeshKernel::meshObject() const
+{
+    return *_meshObject;
+}
+
+void PropertyMeshKernel::setMeshObject(MeshObject* mesh)
+{
+    // keep the Python wrapper in sync, it holds a reference to its mesh object
+    if (meshPyObject) {
+        mesh->ref();
+        meshObject()->unref();
+        meshPyObject->setTwinPointer(mesh);
+    }
+    if (mesh != meshObject()) {
+        _meshObject = std::make_shared<Base::Reference<MeshObject>>(mesh);
+    }
+}
+
+bool PropertyMeshKernel::isShared() const
+{
+    return _meshObject.use_count() > 1;
+}
+
+void PropertyMeshKernel::handOver(MeshObject* copy)
+{
+    // this property keeps its mesh object so that the display and the Python wrappers of
+    // facets or points follow it, the copies of this property continue with the passed one
+    Base::Reference<MeshObject> mesh(meshObject());
+    *_meshObject = copy;
+    _meshObject = std::make_shared<Base::Reference<MeshObject>>(mesh);
+}
+
+MeshObject* PropertyMeshKernel::detach()
+{
+    // the mesh object is shared with a copy of this property, e.g. in the undo stack
+    if (isShared()) {
+        handOver(new MeshObject(*meshObject()));
+    }
+    return meshObject();
+}
+
 void PropertyMeshKernel::setValuePtr(MeshObject* mesh)
 {
     // use the tmp. object to guarantee that the referenced mesh is not destroyed
     // before calling hasSetValue()
-    Base::Reference<MeshObject> tmp(_meshObject);
+    Base::Reference<MeshObject> tmp(meshObject());
     aboutToSetValue();
-    _meshObject = mesh;
+    setMeshObject(mesh);
     hasSetValue();
 }
 
 void PropertyMeshKernel::setValue(const MeshObject& mesh)
 {
     aboutToSetValue();
-    *_meshObject = mesh;
+    if (isShared()) {
+        // the copies get the current content, no need to copy it twice
+        auto copy = new MeshObject(mesh);
+        meshObject()->swap(*copy);
+        handOver(copy);
+    }
+    else {
+        *meshObject() = mesh;
+    }
     hasSetValue();
 }
 
 void PropertyMeshKernel::setValue(const MeshCore::MeshKernel& mesh)
 {
     aboutToSetValue();
-    _meshObject->setKernel(mesh);
+    if (isShared()) {
+        auto copy = new MeshObject(mesh, meshObject()->getTransform());
+        meshObject()->swap(*copy);
+        handOver(copy);
+    }
+    else {
+        meshObject()->setKernel(mesh);
+    }
     hasSetValue();
 }
 
 void PropertyMeshKernel::swapMesh(MeshObject& mesh)
 {
     aboutToSetValue();
-    _meshObject->swap(mesh);
+    detach()->swap(mesh);
     hasSetValue();
 }
 
 void PropertyMeshKernel::swapMesh(MeshCore::MeshKernel& mesh)
 {
     aboutToSetValue();
-    _meshObject->swap(mesh);
+    detach()->swap(mesh);
     hasSetValue();
 }
 
 const MeshObject& PropertyMeshKernel::getValue() const
 {
-    return *_meshObject;
+    return *meshObject();
 }
 
 const MeshObject* PropertyMeshKernel::getValuePtr() const
 {
-    return static_cast<MeshObject*>(_meshObject);
+    return meshObject();
 }
 
 const Data::ComplexGeoData* PropertyMeshKernel::getComplexData() const
 {
-    return static_cast<MeshObject*>(_meshObject);
+    return meshObject();
 }
 
 Base::BoundBox3d PropertyMeshKernel::getBoundingBox() const
 {
-    return _meshObject->getBoundBox();
+    return meshObject()->getBoundBox();
 }
 
 unsigned int PropertyMeshKernel::getMemSize() const
 {
     unsigned int size = 0;
-    size += _meshObject->getMemSize();
+    size += meshObject()->getMemSize();
 
     return size;
 }
@@ -807,7 +863,7 @@ unsigned int PropertyMeshKernel::getMemSize() const
 MeshObject* PropertyMeshKernel::startEditing()
 {
     aboutToSetValue();
-    return static_cast<MeshObject*>(_meshObject);
+    return detach();
 }
 
 void PropertyMeshKernel::finishEditing()
@@ -818,7 +874,7 @@ void PropertyMeshKernel::finishEditing()
 void PropertyMeshKernel::transformGeometry(const Base::Matrix4D& rclMat)
 {
     aboutToSetValue();
-    _meshObject->transformGeometry(rclMat);
+    detach()->transformGeometry(rclMat);
     hasSetValue();
 }
 
@@ -826,7 +882,7 @@ void PropertyMeshKernel::setPointIndices(
     const std::vector<std::pair<PointIndex, Base::Vector3f>>& inds)
 {
     aboutToSetValue();
-    MeshCore::MeshKernel& kernel = _meshObject->getKernel();
+    MeshCore::MeshKernel& kernel = detach()->getKernel();
     for (const auto& it : inds) {
         kernel.SetPoint(it.first, it.second);
     }
@@ -835,20 +891,22 @@ void PropertyMeshKernel::setPointIndices(
 
 void PropertyMeshKernel::setTransform(const Base::Matrix4D& rclTrf)
 {
-    _meshObject->setTransform(rclTrf);
+    if (meshObject()->getTransform() != rclTrf) {
+        detach()->setTransform(rclTrf);
+    }
 }
 
 Base::Matrix4D PropertyMeshKernel::getTransform() const
 {
-    return _meshObject->getTransform();
+    return meshObject()->getTransform();
 }
 
 PyObject* PropertyMeshKernel::getPyObject()
 {
     if (!meshPyObject) {
         meshPyObject = new MeshPy(
-            &*_meshObject);  // Lgtm[cpp/resource-not-released-in-destructor] ** Not destroyed in
-                             // this class because it is reference-counted and destroyed elsewhere
+            meshObject());  // Lgtm[cpp/resource-not-released-in-destructor] ** Not destroyed in
+                            // this class because it is reference-counted and destroyed elsewhere
         meshPyObject->setConst();  // set immutable
         meshPyObject->parentProperty = this;
     }
@@ -862,7 +920,7 @@ void PropertyMeshKernel::setPyObject(PyObject* value)
     if (PyObject_TypeCheck(value, &(MeshPy::Type))) {
         MeshPy* mesh = static_cast<MeshPy*>(value);
         // Do not allow one to reassign the same instance
-        if (&(*this->_meshObject) != mesh->getMeshObjectPtr()) {
+        if (meshObject() != mesh->getMeshObjectPtr()) {
             // Note: Copy the content, do NOT reference the same mesh object
             setValue(*(mesh->getMeshObjectPtr()));
         }
@@ -884,7 +942,7 @@ void PropertyMeshKernel::Save(Base::Writer& writer) const
 {
     if (writer.isForceXML()) {
         writer.Stream() << writer.ind() << "<Mesh>" << std::endl;
-        MeshCore::MeshOutput saver(_meshObject->getKernel());
+        MeshCore::MeshOutput saver(meshObject()->getKernel());
         saver.SaveXML(writer);
     }
     else {
@@ -910,7 +968,7 @@ void PropertyMeshKernel::Restore(Base::XMLReader& reader)
         kernel.Adopt(points, facets);
 
         aboutToSetValue();
-        _meshObject->getKernel().Adopt(points, facets);
+        detach()->getKernel().Adopt(points, facets);
         hasSetValue();
     }
     else {
@@ -921,29 +979,38 @@ void PropertyMeshKernel::Restore(Base::XMLReader& reader)
 
 void PropertyMeshKernel::SaveDocFile(Base::Writer& writer) const
 {
-    _meshObject->save(writer.Stream());
+    meshObject()->save(writer.Stream());
 }
 
 void PropertyMeshKernel::RestoreDocFile(Base::Reader& reader)
 {
     aboutToSetValue();
-    _meshObject->load(reader);
+    detach()->load(reader);
     hasSetValue();
 }
 
 App::Property* PropertyMeshKernel::Copy() const
 {
-    // Note: Copy the content, do NOT reference the same mesh object
+    // Note: Reference the same mesh object, it gets copied before one of the
+    // properties modifies it
     PropertyMeshKernel* prop = new PropertyMeshKernel();
-    *(prop->_meshObject) = *(this->_meshObject);
+    prop->_meshObject = this->_meshObject;
     return prop;
 }
 
 void PropertyMeshKernel::Paste(const App::Property& from)
 {
-    // Note: Copy the content, do NOT reference the same mesh object
-    aboutToSetValue();
     const PropertyMeshKernel& prop = dynamic_cast<const PropertyMeshKernel&>(from);
-    *(this->_meshObject) = *(prop._meshObject);
+    // use the tmp. object to guarantee that the referenced mesh is not destroyed
+    // before calling hasSetValue()
+    Base::Reference<MeshObject> tmp(meshObject());
+    aboutToSetValue();
+    setMeshObject(prop.meshObject());
+    _meshObject = prop._meshObject;
     hasSetValue();
 }
+
+const void* PropertyMeshKernel::getSharedData() const
+{
+    return meshObject();
+}
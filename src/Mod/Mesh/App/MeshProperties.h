@@ -25,6 +25,7 @@
 
 #include <list>
 #include <map>
+#include <memory>
 #include <set>
 #include <string>
 #include <vector>
@@ -316,12 +317,33 @@ public:
     void SaveDocFile(Base::Writer& writer) const override;
     void RestoreDocFile(Base::Reader& reader) override;
 
+    /** The copy shares the mesh object with this property until one of them is modified.
+     * Modifying this property keeps its mesh object, so references to it, e.g. of the display
+     * or of Python facets and points, follow the changes while the copy gets the old content.
+     * Paste() takes the mesh object of \a from, like setValuePtr() only the Python wrapper
+     * returned by getPyObject() is moved to it.
+     */
     App::Property* Copy() const override;
     void Paste(const App::Property& from) override;
+    const void* getSharedData() const override;
     //@}
 
 private:
-    Base::Reference<MeshObject> _meshObject;
+    MeshObject* meshObject() const;
+    void setMeshObject(MeshObject* mesh);
+    bool isShared() const;
+    /** Gives the copies of this property \a copy, which has the content of the shared
+     * mesh object, and keeps the mesh object for this property only.
+     */
+    void handOver(MeshObject* copy);
+    /** Makes sure the mesh object is not shared before it gets modified. */
+    MeshObject* detach();
+
+private:
+    /** Common to all copies of this property that share the mesh object. Other holders of
+     * the mesh object, e.g. the display or Python facets, don't count.
+     */
+    std::shared_ptr<Base::Reference<MeshObject>> _meshObject;
     MeshPy* meshPyObject {nullptr};
 };
 
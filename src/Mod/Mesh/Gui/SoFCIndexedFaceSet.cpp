@@ -41,6 +41,7 @@
 #include <GL/glu.h>
 #endif
 #include <Inventor/actions/SoGLRenderAction.h>
+#include <Inventor/actions/SoRayPickAction.h>
 #include <Inventor/actions/SoSearchAction.h>
 #include <Inventor/bundles/SoMaterialBundle.h>
 #include <Inventor/bundles/SoTextureCoordinateBundle.h>
@@ -50,6 +51,7 @@
 #include <Inventor/elements/SoGLLazyElement.h>
 #include <Inventor/elements/SoMaterialBindingElement.h>
 #include <Inventor/elements/SoNormalBindingElement.h>
+#include <Inventor/elements/SoPickStyleElement.h>
 #include <Inventor/elements/SoProjectionMatrixElement.h>
 #include <Inventor/elements/SoViewingMatrixElement.h>
 #include <Inventor/errors/SoDebugError.h>
@@ -58,6 +60,7 @@
 #include <Inventor/C/glue/gl.h>
 
 #include <Gui/GLBuffer.h>
+#include <Gui/Inventor/TriangleBVH.h>
 #include <Gui/SoFCInteractiveElement.h>
 #include <Gui/Selection/SoFCSelectionAction.h>
 
@@ -466,6 +469,33 @@ SoFCIndexedFaceSet::SoFCIndexedFaceSet()
     SO_NODE_ADD_FIELD(updateGLArray, (false));
     updateGLArray.setFieldType(SoField::EVENTOUT_FIELD);
     setName(SoFCIndexedFaceSet::getClassTypeId().getName());
+    pickTree = std::make_unique<Gui::TriangleBVH>(&coordIndex);
+}
+
+SoFCIndexedFaceSet::~SoFCIndexedFaceSet() = default;
+
+/**
+ * Picks large meshes through the triangle hierarchy instead of testing every facet.
+ */
+void SoFCIndexedFaceSet::rayPick(SoRayPickAction* action)
+{
+    if (!this->shouldRayPick(action)) {
+        return;
+    }
+
+    // Picking by bounding box is left to the base class
+    SoState* state = action->getState();
+    const SoCoordinateElement* coords = SoCoordinateElement::getInstance(state);
+    const SbVec3f* coords3d = coords->is3D() ? coords->getArrayPtr3() : nullptr;
+    if (SoPickStyleElement::get(state) == SoPickStyleElement::BOUNDING_BOX
+        || this->vertexProperty.getValue()
+        || !pickTree->update(coords->getNodeId(), coords3d, coords->getNum())) {
+        inherited::rayPick(action);
+        return;
+    }
+
+    this->computeObjectSpaceRay(action);
+    pickTree->rayPick(action, this, coords3d);
 }
 
 /**
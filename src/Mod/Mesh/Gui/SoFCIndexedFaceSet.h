@@ -27,6 +27,7 @@
 #include <Inventor/fields/SoMFColor.h>
 #include <Inventor/fields/SoSFBool.h>
 #include <Inventor/nodes/SoIndexedFaceSet.h>
+#include <memory>
 #include <vector>
 #ifndef MESH_GLOBAL_H
 #include <Mod/Mesh/MeshGlobal.h>
@@ -40,6 +41,11 @@ using GLuint = unsigned int;
 using GLint = int;
 using GLfloat = float;
 
+namespace Gui
+{
+class TriangleBVH;
+}
+
 namespace MeshGui
 {
 
@@ -114,8 +120,9 @@ public:
 
 protected:
     // Force using the reference count mechanism.
-    ~SoFCIndexedFaceSet() override = default;
+    ~SoFCIndexedFaceSet() override;
     void GLRender(SoGLRenderAction* action) override;
+    void rayPick(SoRayPickAction* action) override;
     void drawFaces(SoGLRenderAction* action);
     void drawCoords(const SoGLCoordinateElement* const vertexlist,
                     const int32_t* vertexindices,
@@ -143,6 +150,8 @@ private:
 private:
     MeshRenderer render;
     GLuint* selectBuf {nullptr};
+    // Triangle hierarchy to speed up picking of large meshes
+    std::unique_ptr<Gui::TriangleBVH> pickTree;
 };
 // NOLINTEND
 
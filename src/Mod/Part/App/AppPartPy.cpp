@@ -22,6 +22,7 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+# include <algorithm>
 # include <BRep_Builder.hxx>
 # include <BRep_Tool.hxx>
 # include <BRepAdaptor_Curve.hxx>
@@ -96,6 +97,7 @@
 #include "OCCError.h"
 #include "PartFeature.h"
 #include "PartPyCXX.h"
+#include "ThumbnailRenderer.h"
 #include "Tools.h"
 #include "TopoShapeCompoundPy.h"
 #include "TopoShapePy.h"
@@ -607,6 +609,13 @@ public:
         add_varargs_method("clearShapeCache",&Module::clearShapeCache,
             "clearShapeCache() -- Clears internal shape cache"
         );
+        add_varargs_method("updateThumbnails",&Module::updateThumbnails,
+            "updateThumbnails(path,[size=256]) -> int\n"
+            "Render the thumbnails of project files without GUI and save the files again\n\n"
+            "* path: a project file or a directory whose project files are all updated\n"
+            "* size: the width and height of the thumbnail in pixels\n\n"
+            "The files are rendered in parallel. Returns the number of updated files."
+        );
         add_keyword_method("getShape",&Module::getShape,
             "getShape(obj,subname=None,mat=None,needSubElement=False,transform=True,retType=0):\n"
             "Obtain the TopoShape of a given object with SubName reference\n\n"
@@ -2334,6 +2343,36 @@ private:
         return Py::Object();
     }
 
+    Py::Object updateThumbnails(const Py::Tuple& args)
+    {
+        char* Name;
+        int size = 256;
+        if (!PyArg_ParseTuple(args.ptr(), "et|i","utf-8",&Name,&size))
+            throw Py::Exception();
+
+        std::string EncodedName = std::string(Name);
+        PyMem_Free(Name);
+
+        std::vector<std::string> files;
+        Base::FileInfo path(EncodedName);
+        if (path.isDir()) {
+            for (const auto& file : path.getDirectoryContent()) {
+                if (file.isFile() && file.hasExtension("FCStd"))
+                    files.push_back(file.filePath());
+            }
+            std::sort(files.begin(), files.end());
+        }
+        else if (path.isFile()) {
+            files.push_back(path.filePath());
+        }
+        else {
+            throw Py::ValueError("No such file or directory: " + EncodedName);
+        }
+
+        size = Base::clamp<int>(size, 64, 512);
+        return Py::Long(ThumbnailRenderer::updateFiles(files, size));
+    }
+
     Py::Object splitSubname(const Py::Tuple& args) {
         const char *subname;
         if (!PyArg_ParseTuple(args.ptr(), "s",&subname))
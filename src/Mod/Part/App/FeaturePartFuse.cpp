@@ -43,6 +43,7 @@ namespace Part
 {
     extern void throwIfInvalidIfCheckModel(const TopoDS_Shape& shape);
     extern bool getRefineModelParameter();
+    extern int getTreeBooleanThreshold();
 }
 
 PROPERTY_SOURCE(Part::Fuse, Part::Boolean)
@@ -114,6 +115,27 @@ App::DocumentObjectExecReturn *MultiFuse::execute()
 
     if (shapes.size() >= 2) {
         try {
+            int treeThreshold = getTreeBooleanThreshold();
+            if (treeThreshold > 0 && shapes.size() >= static_cast<std::size_t>(treeThreshold)) {
+                // The boolean tree maps the element names, but records no face history of the
+                // individual inputs
+                TopoShape res(0);
+                res.makeElementTreeBoolean(OpCodes::Fuse, shapes);
+                if (res.isNull()) {
+                    throw Base::RuntimeError("Resulting shape is null");
+                }
+                throwIfInvalidIfCheckModel(res.getShape());
+                if (this->Refine.getValue()) {
+                    res = res.makeElementRefine();
+                }
+                this->Shape.setValue(res);
+                this->History.setValues(std::vector<ShapeHistory>());
+
+                App::DocumentObject* link = Shapes.getValues()[0];
+                copyMaterial(link);
+                return Part::Feature::execute();
+            }
+
             std::vector<ShapeHistory> history;
             FCBRepAlgoAPI_Fuse mkFuse;
             TopTools_ListOfShape shapeArguments, shapeTools;
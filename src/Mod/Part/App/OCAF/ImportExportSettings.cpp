@@ -262,6 +262,16 @@ bool ImportExportSettings::getExpandCompound() const
     return pGroup->GetBool("ExpandCompound", false);
 }
 
+void ImportExportSettings::setShareShapes(bool on)
+{
+    pGroup->SetBool("ShareShapes", on);
+}
+
+bool ImportExportSettings::getShareShapes() const
+{
+    return pGroup->GetBool("ShareShapes", false);
+}
+
 void ImportExportSettings::setShowProgress(bool on)
 {
     pGroup->SetBool("ShowProgress", on);
@@ -92,6 +92,9 @@ public:
     void setExpandCompound(bool);
     bool getExpandCompound() const;
 
+    void setShareShapes(bool);
+    bool getShareShapes() const;
+
     void setShowProgress(bool);
     bool getShowProgress() const;
 
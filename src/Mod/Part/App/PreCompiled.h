@@ -48,6 +48,8 @@
 #include <array>
 #include <fcntl.h>
 #include <fstream>
+#include <functional>
+#include <future>
 #include <list>
 #include <iostream>
 #include <map>
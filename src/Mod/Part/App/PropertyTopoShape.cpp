@@ -49,6 +49,7 @@
 #include "PartFeature.h"
 #include "PartPyCXX.h"
 #include "PropertyTopoShape.h"
+#include "TessellationCache.h"
 #include "TopoShapePy.h"
 #include "PartFeature.h"
 
@@ -217,6 +218,22 @@ App::Property *PropertyPartShape::Copy() const
     return prop;
 }
 
+App::Property *PropertyPartShape::copyForBackgroundSave() const
+{
+    // BRepMesh adds triangulations and polygons to the faces and edges of a shape. To
+    // write the shape while it is meshed in another thread the copy gets its own faces
+    // and edges. The geometry is shared as it isn't modified.
+    PropertyPartShape *prop = new PropertyPartShape();
+    prop->_SaveTriangles = TessellationCache::isPersistent();
+    const TopoDS_Shape& shape = _Shape.getShape();
+    if (!shape.IsNull()) {
+        BRepBuilderAPI_Copy copy(shape, Standard_False, *prop->_SaveTriangles);
+        prop->_Shape.setShape(copy.Shape(), false);
+    }
+    prop->_Ver = this->_Ver;
+    return prop;
+}
+
 void PropertyPartShape::Paste(const App::Property &from)
 {
     auto prop = Base::freecad_dynamic_cast<const PropertyPartShape>(&from);
@@ -231,6 +248,15 @@ unsigned int PropertyPartShape::getMemSize () const
     return _Shape.getMemSize();
 }
 
+const void* PropertyPartShape::getSharedData() const
+{
+    const TopoDS_Shape& shape = _Shape.getShape();
+    if (shape.IsNull()) {
+        return nullptr;
+    }
+    return shape.TShape().get();
+}
+
 void PropertyPartShape::getPaths(std::vector<App::ObjectIdentifier> &paths) const
 {
     paths.push_back(App::ObjectIdentifier(getContainer()) << App::ObjectIdentifier::Component::SimpleComponent(getName())
@@ -289,11 +315,13 @@ void PropertyPartShape::Save (Base::Writer &writer) const
                         << "\"/>\n";
     } else if(binary) {
         writer.Stream() << " binary=\"1\">\n";
-        _Shape.exportBinary(writer.beginCharStream(Base::CharStreamFormat::Base64Encoded));
+        _Shape.exportBinary(writer.beginCharStream(Base::CharStreamFormat::Base64Encoded),
+                            TessellationCache::isPersistent());
         writer.endCharStream() <<  writer.ind() << "</Part>\n";
     } else {
         writer.Stream() << " brep=\"1\">\n";
-        _Shape.exportBrep(writer.beginCharStream(Base::CharStreamFormat::Raw)<<'\n');
+        _Shape.exportBrep(writer.beginCharStream(Base::CharStreamFormat::Raw)<<'\n',
+                          TessellationCache::isPersistent());
         writer.endCharStream() << '\n' << writer.ind() << "</Part>\n";
     }
 
@@ -569,10 +597,12 @@ void PropertyPartShape::SaveDocFile (Base::Writer &writer) const
     if (_Shape.getShape().IsNull())
         return;
     TopoDS_Shape myShape = _Shape.getShape();
+    // optionally keep the triangulation so that the shape isn't meshed again after loading
+    bool withTriangles = _SaveTriangles ? *_SaveTriangles : TessellationCache::isPersistent();
     if (writer.getMode("BinaryBrep")) {
         TopoShape shape;
         shape.setShape(myShape);
-        shape.exportBinary(writer.Stream());
+        shape.exportBinary(writer.Stream(), withTriangles);
     }
     else {
         bool direct = App::GetApplication().GetParameterGroupByPath
@@ -583,7 +613,7 @@ void PropertyPartShape::SaveDocFile (Base::Writer &writer) const
         else {
             TopoShape shape;
             shape.setShape(myShape);
-            shape.exportBrep(writer.Stream());
+            shape.exportBrep(writer.Stream(), withTriangles);
         }
     }
 }
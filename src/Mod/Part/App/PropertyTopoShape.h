@@ -24,6 +24,7 @@
 #define PART_PROPERTYTOPOSHAPE_H
 
 #include <map>
+#include <optional>
 #include <vector>
 
 #include <App/PropertyGeo.h>
@@ -94,6 +95,10 @@ public:
     App::Property *Copy() const override;
     void Paste(const App::Property &from) override;
     unsigned int getMemSize () const override;
+    /// The copies share the OCC shape, which is identified by its TShape
+    const void* getSharedData() const override;
+    /// The copy gets its own topology, which isn't changed by meshing the shape
+    App::Property *copyForBackgroundSave() const override;
     //@}
 
     /// Get valid paths for this property; used by auto completer
@@ -116,6 +121,8 @@ private:
     std::string _Ver;
     mutable int _HasherIndex = 0;
     mutable bool _SaveHasher = false;
+    /// Set for the copies of copyForBackgroundSave(), which must not read the parameters
+    std::optional<bool> _SaveTriangles;
 };
 
 struct PartExport ShapeHistory {
@@ -0,0 +1,154 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2024 The FreeCAD Project Association                     *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+
+#include "PreCompiled.h"
+#ifndef _PreComp_
+#include <atomic>
+#include <unordered_set>
+#include <Bnd_Box.hxx>
+#include <BRep_Tool.hxx>
+#include <BRepBndLib.hxx>
+#include <BRepMesh_IncrementalMesh.hxx>
+#include <Poly_Triangulation.hxx>
+#include <Precision.hxx>
+#include <Standard_Version.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Face.hxx>
+#if OCC_VERSION_HEX >= 0x070500
+#include <IMeshTools_Parameters.hxx>
+#endif
+#endif
+
+#include <App/Application.h>
+#include <Base/Console.h>
+
+#include "TessellationCache.h"
+
+
+FC_LOG_LEVEL_INIT("Part", true, true)
+
+using namespace Part;
+
+namespace
+{
+std::atomic<std::size_t> cacheHits {0};
+std::atomic<std::size_t> cacheMisses {0};
+}  // namespace
+
+double TessellationCache::getDeflection(const TopoDS_Shape& shape, double deviation)
+{
+    Bnd_Box bounds;
+    BRepBndLib::Add(shape, bounds);
+    bounds.SetGap(0.0);
+    if (bounds.IsVoid()) {
+        return Precision::Confusion();
+    }
+
+    Standard_Real xMin, yMin, zMin, xMax, yMax, zMax;
+    bounds.Get(xMin, yMin, zMin, xMax, yMax, zMax);
+    Standard_Real deflection = ((xMax - xMin) + (yMax - yMin) + (zMax - zMin)) / 300.0 * deviation;
+
+    // Since OCCT 7.6 a value of equal 0 is not allowed any more, this can happen if a single
+    // vertex should be displayed.
+    if (deflection < gp::Resolution()) {
+        deflection = Precision::Confusion();
+    }
+    return deflection;
+}
+
+std::size_t TessellationCache::triangulate(const TopoDS_Shape& shape,
+                                           double deflection,
+                                           double angularDeflection)
+{
+    if (shape.IsNull()) {
+        return 0;
+    }
+
+    // Count the faces without a fine enough triangulation. The triangulation is shared
+    // by all faces with the same TShape, independent of their location.
+    std::unordered_set<const TopoDS_TShape*> faces;
+    std::size_t hits = 0;
+    std::size_t misses = 0;
+    for (TopExp_Explorer xp(shape, TopAbs_FACE); xp.More(); xp.Next()) {
+        const TopoDS_Face& face = TopoDS::Face(xp.Current());
+        if (!faces.insert(face.TShape().get()).second) {
+            continue;
+        }
+        TopLoc_Location loc;
+        Handle(Poly_Triangulation) mesh = BRep_Tool::Triangulation(face, loc);
+        if (!mesh.IsNull() && mesh->Deflection() <= deflection + Precision::Confusion()) {
+            ++hits;
+            continue;
+        }
+        ++misses;
+    }
+
+    cacheHits += hits;
+    cacheMisses += misses;
+    if (misses == 0) {
+        return 0;
+    }
+
+    // Mesh the whole shape and not only the missing faces, so that BRepMesh re-meshes the
+    // edges of the adjacent faces as well and the triangulations stay connected. It keeps
+    // the triangulations of the other faces as long as they are fine enough.
+    FC_TIME_INIT(t);
+#if OCC_VERSION_HEX >= 0x070500
+    IMeshTools_Parameters meshParams;
+    meshParams.Deflection = deflection;
+    meshParams.Relative = Standard_False;
+    meshParams.Angle = angularDeflection;
+    meshParams.InParallel = Standard_True;
+    meshParams.AllowQualityDecrease = Standard_True;
+
+    BRepMesh_IncrementalMesh(shape, meshParams);
+#else
+    BRepMesh_IncrementalMesh(shape, deflection, Standard_False, angularDeflection, Standard_True);
+#endif
+    FC_TIME_LOG(t, "triangulate " << misses << " of " << misses + hits << " faces");
+
+    return misses;
+}
+
+TessellationCache::Statistics TessellationCache::getStatistics()
+{
+    Statistics stats;
+    stats.hits = cacheHits;
+    stats.misses = cacheMisses;
+    return stats;
+}
+
+void TessellationCache::resetStatistics()
+{
+    cacheHits = 0;
+    cacheMisses = 0;
+}
+
+bool TessellationCache::isPersistent()
+{
+    return App::GetApplication()
+        .GetParameterGroupByPath("User parameter:BaseApp/Preferences/Mod/Part/General")
+        ->GetBool("SaveTessellation", false);
+}
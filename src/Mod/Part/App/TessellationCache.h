@@ -0,0 +1,77 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2024 The FreeCAD Project Association                     *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#ifndef PART_TESSELLATIONCACHE_H
+#define PART_TESSELLATIONCACHE_H
+
+#include <cstddef>
+
+#include <Mod/Part/PartGlobal.h>
+
+class TopoDS_Shape;
+
+namespace Part
+{
+
+/*!
+ * The class TessellationCache is the common place to triangulate the faces of a shape
+ * for display, mesh export or inspection.
+ *
+ * The triangulation is kept by OCC in the faces of the shape, so a face is identified by
+ * its TShape and the tolerance by the deflection stored in its triangulation. A shape is
+ * only meshed if it has faces without a triangulation or with a coarser one than
+ * requested. Then the whole shape is passed to BRepMesh, which meshes those faces in
+ * parallel, keeps the others and keeps the edges shared between faces consistent. Faces
+ * shared by several shapes, e.g. by links, are only meshed once.
+ */
+class PartExport TessellationCache
+{
+public:
+    struct Statistics
+    {
+        /// number of faces whose triangulation could be reused
+        std::size_t hits = 0;
+        /// number of faces that had to be meshed
+        std::size_t misses = 0;
+    };
+
+    /// Returns the deflection relative to the bounding box as used by the 3D view
+    static double getDeflection(const TopoDS_Shape& shape, double deviation);
+    /*!
+     * Makes sure that all faces of \a shape are triangulated with at most \a deflection.
+     * \param angularDeflection is in radians.
+     * \return the number of faces that had to be meshed
+     */
+    static std::size_t
+    triangulate(const TopoDS_Shape& shape, double deflection, double angularDeflection);
+
+    static Statistics getStatistics();
+    static void resetStatistics();
+
+    /// Whether triangulations are stored in project files to avoid re-meshing on load
+    static bool isPersistent();
+};
+
+}  // namespace Part
+
+#endif  // PART_TESSELLATIONCACHE_H
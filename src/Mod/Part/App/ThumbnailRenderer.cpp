@@ -0,0 +1,582 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2024 The FreeCAD Project Association                     *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+#ifndef _PreComp_
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <ctime>
+#include <future>
+#include <istream>
+#include <limits>
+#include <memory>
+#include <set>
+#include <thread>
+#include <unordered_set>
+#include <zlib.h>
+#include <QCoreApplication>
+#include <Poly_Triangle.hxx>
+#include <Standard_Failure.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#endif
+
+#include <zipios++/zipfile.h>
+#include <zipios++/zipoutputstream.h>
+
+#include <App/Application.h>
+#include <App/Document.h>
+#include <App/DocumentObject.h>
+#include <App/Material.h>
+#include <App/ProjectFile.h>
+#include <Base/BoundBox.h>
+#include <Base/Console.h>
+#include <Base/FileInfo.h>
+#include <Base/Stream.h>
+#include <Base/Tools.h>
+#include <Base/Uuid.h>
+#include <Base/Vector3D.h>
+#include <Base/Writer.h>
+
+#include "ThumbnailRenderer.h"
+#include "PartFeature.h"
+#include "TessellationCache.h"
+#include "Tools.h"
+
+
+FC_LOG_LEVEL_INIT("Part", true, true)
+
+using namespace Part;
+
+namespace
+{
+
+constexpr int superSampling = 2;
+constexpr double margin = 0.05;
+
+struct Triangle
+{
+    std::array<Base::Vector3d, 3> points;
+    float shade;
+};
+
+struct RenderSettings
+{
+    double deviation;
+    double angularDeflection;
+    App::Color color;
+};
+
+RenderSettings getRenderSettings()
+{
+    ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Part");
+    RenderSettings settings;
+    settings.deviation = hGrp->GetFloat("MeshDeviation", 0.2);
+    settings.angularDeflection = Base::toRadians(hGrp->GetFloat("MeshAngularDeflection", 28.65));
+    settings.color = App::Material::getDefaultAppearance().diffuseColor;
+    return settings;
+}
+
+// Isometric view as used by the 3D view, z points towards the viewer
+Base::Vector3d toView(const gp_Pnt& pnt)
+{
+    static const Base::Vector3d right = Base::Vector3d(1, 1, 0).Normalize();
+    static const Base::Vector3d up = Base::Vector3d(-1, 1, 2).Normalize();
+    static const Base::Vector3d back = Base::Vector3d(1, -1, 1).Normalize();
+    Base::Vector3d vec(pnt.X(), pnt.Y(), pnt.Z());
+    return Base::Vector3d(vec * right, vec * up, vec * back);
+}
+
+float getShade(const std::array<Base::Vector3d, 3>& points)
+{
+    static const Base::Vector3d light = Base::Vector3d(-0.3, 0.5, 1.0).Normalize();
+    Base::Vector3d normal = (points[1] - points[0]) % (points[2] - points[0]);
+    if (normal.Length() < std::numeric_limits<double>::epsilon()) {
+        return -1.0F;
+    }
+    normal.Normalize();
+    // lit from both sides to cope with open shells and wrongly oriented faces
+    return static_cast<float>(0.3 + 0.7 * std::fabs(normal * light));
+}
+
+void appendUInt32(std::string& data, uint32_t value)
+{
+    data.push_back(static_cast<char>((value >> 24) & 0xff));
+    data.push_back(static_cast<char>((value >> 16) & 0xff));
+    data.push_back(static_cast<char>((value >> 8) & 0xff));
+    data.push_back(static_cast<char>(value & 0xff));
+}
+
+void appendChunk(std::string& png, const char* type, const std::string& data)
+{
+    std::string chunk(type);
+    chunk += data;
+    appendUInt32(png, static_cast<uint32_t>(data.size()));
+    png += chunk;
+    appendUInt32(png,
+                 crc32(0L, reinterpret_cast<const Bytef*>(chunk.data()),
+                       static_cast<uInt>(chunk.size())));
+}
+
+std::string encodePng(int width, int height, const std::vector<unsigned char>& rgba)
+{
+    // each row starts with the filter type, 0 means no filter
+    std::string raw;
+    std::size_t rowSize = static_cast<std::size_t>(width) * 4;
+    raw.reserve(height * (rowSize + 1));
+    for (int y = 0; y < height; ++y) {
+        raw.push_back('\0');
+        raw.append(reinterpret_cast<const char*>(rgba.data()) + y * rowSize, rowSize);
+    }
+
+    uLongf length = compressBound(static_cast<uLong>(raw.size()));
+    std::string compressed(length, '\0');
+    if (compress2(reinterpret_cast<Bytef*>(&compressed[0]),
+                  &length,
+                  reinterpret_cast<const Bytef*>(raw.data()),
+                  static_cast<uLong>(raw.size()),
+                  Z_BEST_COMPRESSION)
+        != Z_OK) {
+        return {};
+    }
+    compressed.resize(length);
+
+    std::string header;
+    appendUInt32(header, width);
+    appendUInt32(header, height);
+    header.push_back(8);  // bit depth
+    header.push_back(6);  // RGBA
+    header.append(3, '\0');
+
+    std::string png("\x89PNG\r\n\x1a\n", 8);
+    appendChunk(png, "IHDR", header);
+    // the same meta-information as written by Gui::Thumbnail
+    appendChunk(png, "tEXt", std::string("Thumb::Mimetype\0application/x-extension-fcstd", 45));
+    appendChunk(png, "tEXt",
+                std::string("Thumb::MTime", 13) + std::to_string(std::time(nullptr)));
+    appendChunk(png, "IDAT", compressed);
+    appendChunk(png, "IEND", {});
+    return png;
+}
+
+/*!
+ * Rasterizes the triangles in view coordinates with a z-buffer at a higher resolution and
+ * averages the samples to smooth the silhouette against the transparent background.
+ */
+std::vector<unsigned char>
+rasterize(const std::vector<Triangle>& triangles, const App::Color& color, int size)
+{
+    Base::BoundBox3d bounds;
+    for (const auto& triangle : triangles) {
+        for (const auto& pnt : triangle.points) {
+            bounds.Add(pnt);
+        }
+    }
+
+    const int width = size * superSampling;
+    double extent = std::max(bounds.LengthX(), bounds.LengthY());
+    double scale = extent > 0.0 ? width * (1.0 - 2.0 * margin) / extent : 1.0;
+    Base::Vector3d center = bounds.GetCenter();
+
+    std::vector<float> depth(width * width, -std::numeric_limits<float>::max());
+    std::vector<float> shade(width * width, -1.0F);
+
+    auto edge = [](const Base::Vector3d& a, const Base::Vector3d& b, double x, double y) {
+        return (b.x - a.x) * (y - a.y) - (b.y - a.y) * (x - a.x);
+    };
+
+    for (const auto& triangle : triangles) {
+        std::array<Base::Vector3d, 3> pts;
+        for (int i = 0; i < 3; ++i) {
+            const auto& pnt = triangle.points[i];
+            pts[i].x = (pnt.x - center.x) * scale + width / 2.0;
+            pts[i].y = width / 2.0 - (pnt.y - center.y) * scale;
+            pts[i].z = pnt.z;
+        }
+        double area = edge(pts[0], pts[1], pts[2].x, pts[2].y);
+        if (std::fabs(area) < std::numeric_limits<double>::epsilon()) {
+            continue;
+        }
+
+        int xMin = std::max(0, static_cast<int>(std::floor(
+                                   std::min({pts[0].x, pts[1].x, pts[2].x}))));
+        int xMax = std::min(width - 1, static_cast<int>(std::ceil(
+                                           std::max({pts[0].x, pts[1].x, pts[2].x}))));
+        int yMin = std::max(0, static_cast<int>(std::floor(
+                                   std::min({pts[0].y, pts[1].y, pts[2].y}))));
+        int yMax = std::min(width - 1, static_cast<int>(std::ceil(
+                                           std::max({pts[0].y, pts[1].y, pts[2].y}))));
+
+        for (int y = yMin; y <= yMax; ++y) {
+            for (int x = xMin; x <= xMax; ++x) {
+                double px = x + 0.5;
+                double py = y + 0.5;
+                double w0 = edge(pts[1], pts[2], px, py) / area;
+                double w1 = edge(pts[2], pts[0], px, py) / area;
+                double w2 = edge(pts[0], pts[1], px, py) / area;
+                if (w0 < 0.0 || w1 < 0.0 || w2 < 0.0) {
+                    continue;
+                }
+                auto z = static_cast<float>(w0 * pts[0].z + w1 * pts[1].z + w2 * pts[2].z);
+                std::size_t index = y * width + x;
+                if (z > depth[index]) {
+                    depth[index] = z;
+                    shade[index] = triangle.shade;
+                }
+            }
+        }
+    }
+
+    std::vector<unsigned char> rgba(size * size * 4, 0);
+    for (int y = 0; y < size; ++y) {
+        for (int x = 0; x < size; ++x) {
+            int count = 0;
+            float sum = 0.0F;
+            for (int sy = 0; sy < superSampling; ++sy) {
+                for (int sx = 0; sx < superSampling; ++sx) {
+                    float value = shade[(y * superSampling + sy) * width + x * superSampling + sx];
+                    if (value >= 0.0F) {
+                        sum += value;
+                        ++count;
+                    }
+                }
+            }
+            if (count == 0) {
+                continue;
+            }
+            float value = sum / count;
+            unsigned char* pixel = &rgba[(y * size + x) * 4];
+            pixel[0] = static_cast<unsigned char>(std::min(color.r * value, 1.0F) * 255.0F);
+            pixel[1] = static_cast<unsigned char>(std::min(color.g * value, 1.0F) * 255.0F);
+            pixel[2] = static_cast<unsigned char>(std::min(color.b * value, 1.0F) * 255.0F);
+            pixel[3] = static_cast<unsigned char>(255 * count / (superSampling * superSampling));
+        }
+    }
+    return rgba;
+}
+
+bool isGuiUp()
+{
+    auto app = QCoreApplication::instance();
+    return app && app->inherits("QApplication");
+}
+
+constexpr const char* thumbnailEntry = "thumbnails/Thumbnail.png";
+
+/*!
+ * Copies all entries of the project file \a fileName to a new file, where the thumbnail is
+ * replaced by \a image or added if there is none yet, and puts the new file in its place.
+ */
+bool replaceThumbnail(const std::string& fileName, const std::string& image)
+{
+    // create a new zip file with the name '<zipfile>.<uuid>'
+    std::string newName = fileName + "." + Base::Uuid::createUuid();
+    Base::FileInfo tmp(newName);
+    try {
+        Base::ofstream newZip(tmp, std::ios::out | std::ios::binary);
+
+        // standard compression
+        const int compressionLevel = 6;
+        zipios::ZipOutputStream outZip(newZip);
+        outZip.setComment("FreeCAD Document");
+        outZip.setLevel(compressionLevel);
+
+        zipios::ZipFile project(fileName);
+        for (const auto& it : project.entries()) {
+            std::string file = it->getFileName();
+            if (file == thumbnailEntry) {
+                continue;
+            }
+            outZip.putNextEntry(file);
+            std::unique_ptr<std::istream> str(project.getInputStream(file));
+            if (str) {
+                *str >> outZip.rdbuf();
+            }
+        }
+        project.close();
+
+        outZip.putNextEntry(thumbnailEntry);
+        outZip.write(image.data(), static_cast<std::streamsize>(image.size()));
+        outZip.close();
+        newZip.close();
+    }
+    catch (const std::exception& e) {
+        FC_ERR("Failed to write thumbnail of " << fileName << ": " << e.what());
+        tmp.deleteFile();
+        return false;
+    }
+
+    App::ProjectFile project(fileName);
+    return project.replaceProjectFile(newName);
+}
+
+/*!
+ * Writes the thumbnail of a document saved without GUI, the counterpart of Gui::Thumbnail.
+ */
+class ThumbnailFile: public Base::Persistence
+{
+public:
+    explicit ThumbnailFile(const App::Document* doc)
+        : doc(doc)
+    {}
+
+    void onSaveDocument(Base::Writer& writer)
+    {
+        image.clear();
+        // the GUI writes the thumbnail from the 3D view
+        if (isGuiUp()) {
+            return;
+        }
+        ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+            "User parameter:BaseApp/Preferences/Document");
+        if (!hGrp->GetBool("SaveThumbnail", true)) {
+            return;
+        }
+        int size = Base::clamp<int>(hGrp->GetInt("ThumbnailSize", 256), 64, 512);
+        ThumbnailRenderer renderer(size);
+        renderer.addDocument(doc);
+        image = renderer.renderPng();
+        if (!image.empty()) {
+            Save(writer);
+        }
+    }
+
+    unsigned int getMemSize() const override
+    {
+        return static_cast<unsigned int>(image.size());
+    }
+    void Save(Base::Writer& writer) const override
+    {
+        if (!writer.isForceXML()) {
+            writer.addFile(thumbnailEntry, this);
+        }
+    }
+    void Restore(Base::XMLReader& /*reader*/) override
+    {}
+    void SaveDocFile(Base::Writer& writer) const override
+    {
+        writer.Stream().write(image.data(), static_cast<std::streamsize>(image.size()));
+    }
+
+private:
+    const App::Document* doc;
+    std::string image;
+};
+
+void connectDocument(const App::Document& doc)
+{
+    auto file = std::make_shared<ThumbnailFile>(&doc);
+    const_cast<App::Document&>(doc).signalSaveDocument.connect(  // NOLINT
+        [file](Base::Writer& writer) {
+            file->onSaveDocument(writer);
+        });
+}
+
+}  // namespace
+
+ThumbnailRenderer::ThumbnailRenderer(int size)
+    : size(size)
+{}
+
+void ThumbnailRenderer::addDocument(const App::Document* doc)
+{
+    for (auto obj : doc->getRootObjects()) {
+        if (!obj->Visibility.getValue()) {
+            continue;
+        }
+        addShape(Feature::getShape(obj));
+    }
+}
+
+void ThumbnailRenderer::addShape(const TopoDS_Shape& shape)
+{
+    if (!shape.IsNull()) {
+        shapes.push_back(shape);
+    }
+}
+
+bool ThumbnailRenderer::isEmpty() const
+{
+    return shapes.empty();
+}
+
+std::string ThumbnailRenderer::renderPng() const
+{
+    return renderPng(std::vector<ThumbnailRenderer> {*this}).front();
+}
+
+std::vector<std::string>
+ThumbnailRenderer::renderPng(const std::vector<ThumbnailRenderer>& renderers)
+{
+    // the parameters are read once here as the rendering runs in worker threads
+    RenderSettings settings = getRenderSettings();
+
+    // BRepMesh stores the triangulation in the faces, which may be shared by the shapes of
+    // several renderers. So the shapes are meshed here, each TShape once, and the worker
+    // threads only read the triangulations.
+    std::unordered_set<const TopoDS_TShape*> meshed;
+    for (const auto& renderer : renderers) {
+        for (const auto& shape : renderer.shapes) {
+            if (!meshed.insert(shape.TShape().get()).second) {
+                continue;
+            }
+            try {
+                double deflection = TessellationCache::getDeflection(shape, settings.deviation);
+                TessellationCache::triangulate(shape, deflection, settings.angularDeflection);
+            }
+            catch (const Standard_Failure& e) {
+                FC_ERR("Failed to triangulate shape of thumbnail: " << e.GetMessageString());
+            }
+        }
+    }
+
+    auto render = [&settings](const ThumbnailRenderer& renderer) -> std::string {
+        std::vector<Triangle> triangles;
+        for (const auto& shape : renderer.shapes) {
+            std::vector<gp_Pnt> points;
+            std::vector<Poly_Triangle> facets;
+            for (TopExp_Explorer xp(shape, TopAbs_FACE); xp.More(); xp.Next()) {
+                points.clear();
+                facets.clear();
+                if (!Tools::getTriangulation(TopoDS::Face(xp.Current()), points, facets)) {
+                    continue;
+                }
+                for (const auto& facet : facets) {
+                    Standard_Integer n1 {}, n2 {}, n3 {};
+                    facet.Get(n1, n2, n3);
+                    Triangle triangle;
+                    triangle.points[0] = toView(points[n1]);
+                    triangle.points[1] = toView(points[n2]);
+                    triangle.points[2] = toView(points[n3]);
+                    triangle.shade = getShade(triangle.points);
+                    if (triangle.shade >= 0.0F) {
+                        triangles.push_back(triangle);
+                    }
+                }
+            }
+        }
+        if (triangles.empty()) {
+            return {};
+        }
+        return encodePng(renderer.size,
+                         renderer.size,
+                         rasterize(triangles, settings.color, renderer.size));
+    };
+
+    std::vector<std::string> images(renderers.size());
+    std::atomic<std::size_t> next {0};
+    auto worker = [&]() {
+        for (std::size_t i = next++; i < renderers.size(); i = next++) {
+            try {
+                images[i] = render(renderers[i]);
+            }
+            catch (const Standard_Failure& e) {
+                FC_ERR("Failed to render thumbnail: " << e.GetMessageString());
+            }
+        }
+    };
+
+    std::size_t count =
+        std::min<std::size_t>(renderers.size(), std::max(1U, std::thread::hardware_concurrency()));
+    std::vector<std::future<void>> tasks;
+    for (std::size_t i = 1; i < count; ++i) {
+        tasks.push_back(std::async(std::launch::async, worker));
+    }
+    worker();
+    for (auto& task : tasks) {
+        task.get();
+    }
+    return images;
+}
+
+void ThumbnailRenderer::setupConsoleMode()
+{
+    App::Application& app = App::GetApplication();
+    for (auto doc : app.getDocuments()) {
+        connectDocument(*doc);
+    }
+    app.signalNewDocument.connect([](const App::Document& doc, bool) {
+        connectDocument(doc);
+    });
+}
+
+int ThumbnailRenderer::updateFiles(const std::vector<std::string>& fileNames, int size)
+{
+    FC_TIME_INIT(t);
+    App::Application& app = App::GetApplication();
+
+    // The files are handled in batches so that only a few documents are open at a time
+    const std::size_t batchSize = std::max(1U, std::thread::hardware_concurrency());
+    int count = 0;
+    for (std::size_t first = 0; first < fileNames.size(); first += batchSize) {
+        std::size_t last = std::min(first + batchSize, fileNames.size());
+        auto openDocs = app.getDocuments();
+        std::set<App::Document*> wasOpen(openDocs.begin(), openDocs.end());
+
+        // Opening documents and collecting the shapes must happen in the main thread
+        std::vector<std::string> files;
+        std::vector<ThumbnailRenderer> renderers;
+        for (std::size_t i = first; i < last; ++i) {
+            App::Document* doc = nullptr;
+            try {
+                doc = app.openDocument(fileNames[i].c_str());
+            }
+            catch (const Base::Exception& e) {
+                e.ReportException();
+            }
+            if (!doc) {
+                continue;
+            }
+            files.push_back(doc->FileName.getValue());
+            renderers.emplace_back(size);
+            renderers.back().addDocument(doc);
+        }
+
+        // The collected shapes don't depend on the documents. Close all documents opened
+        // by the batch, including those that the files link to.
+        std::vector<std::string> opened;
+        for (auto doc : app.getDocuments()) {
+            if (wasOpen.find(doc) == wasOpen.end()) {
+                opened.emplace_back(doc->getName());
+            }
+        }
+        for (const auto& name : opened) {
+            // closing a document may close others as well
+            if (app.getDocument(name.c_str())) {
+                app.closeDocument(name.c_str());
+            }
+        }
+
+        std::vector<std::string> images = renderPng(renderers);
+        for (std::size_t i = 0; i < files.size(); ++i) {
+            if (!images[i].empty() && replaceThumbnail(files[i], images[i])) {
+                ++count;
+            }
+        }
+    }
+    FC_TIME_LOG(t, "Updated " << count << " thumbnails");
+    return count;
+}
@@ -0,0 +1,87 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2024 The FreeCAD Project Association                     *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#ifndef PART_THUMBNAILRENDERER_H
+#define PART_THUMBNAILRENDERER_H
+
+#include <string>
+#include <vector>
+
+#include <TopoDS_Shape.hxx>
+
+#include <Mod/Part/PartGlobal.h>
+
+namespace App
+{
+class Document;
+}
+
+namespace Part
+{
+
+/*!
+ * The class ThumbnailRenderer creates the preview image of a project file without a 3D view.
+ *
+ * The shapes are triangulated through the TessellationCache, projected in isometric view and
+ * rasterized in software, so it works in console mode where neither OpenGL nor Coin is
+ * available. The shapes are collected on the main thread. renderPng() doesn't access the
+ * documents, it meshes the collected shapes in the calling thread and rasterizes in parallel.
+ */
+class PartExport ThumbnailRenderer
+{
+public:
+    explicit ThumbnailRenderer(int size = 256);
+
+    /// Adds the shapes of the visible top-level objects of \a doc
+    void addDocument(const App::Document* doc);
+    void addShape(const TopoDS_Shape& shape);
+    bool isEmpty() const;
+
+    /// Returns the PNG encoded image or an empty string if there is nothing to show
+    std::string renderPng() const;
+
+    /// Renders all \a renderers, the images in parallel. The result is in the same order
+    static std::vector<std::string> renderPng(const std::vector<ThumbnailRenderer>& renderers);
+
+    /*!
+     * Writes the thumbnail of documents saved in console mode, where Gui::Thumbnail
+     * is not available. While the GUI is running the documents are left to it.
+     */
+    static void setupConsoleMode();
+    /*!
+     * Renders the thumbnails of the project files in parallel and replaces the thumbnail
+     * entry of each file, all other entries are copied unchanged. The files are opened in
+     * batches of one per hardware thread. Each batch is closed before the next one is opened,
+     * together with the documents that the files link to.
+     * \return the number of files that were updated
+     */
+    static int updateFiles(const std::vector<std::string>& fileNames, int size);
+
+private:
+    int size;
+    std::vector<TopoDS_Shape> shapes;
+};
+
+}  // namespace Part
+
+#endif  // PART_THUMBNAILRENDERER_H
@@ -476,8 +476,8 @@ public:
     void exportIges(const char* FileName) const;
     void exportStep(const char* FileName) const;
     void exportBrep(const char* FileName) const;
-    void exportBrep(std::ostream&) const;
-    void exportBinary(std::ostream&) const;
+    void exportBrep(std::ostream&, bool withTriangles = false) const;
+    void exportBinary(std::ostream&, bool withTriangles = false) const;
     void exportStl(const char* FileName, double deflection) const;
     void exportFaceSet(double, double, const std::vector<App::Color>&, std::ostream&) const;
     void exportLineSet(std::ostream&) const;
@@ -1918,6 +1918,61 @@ public:
         return TopoShape(0, Hasher).makeElementBoolean(maker, *this, op, tol);
     }
 
+    /** Fuse, cut or intersect with tool shapes that are known not to touch each other
+     *
+     * @param maker: one of OpCodes::Fuse, OpCodes::Cut or OpCodes::Common
+     * @param sources: list of source shapes. The first one is the base shape,
+     *                 the rest are the tools. The caller must make sure that
+     *                 no two tools intersect or touch.
+     * @param op: optional string to be encoded into topo naming for indicating
+     *            the operation
+     * @param tol: fuzzy value of the boolean, negative for automatic
+     *
+     * The tools are passed to OCCT as one compound, so that no intersection
+     * among them is computed, and a cut does not fuse the tools first. This is
+     * much faster than makeElementBoolean() for large patterns. The mapped
+     * element names are the same as those of makeElementBoolean(). Compound
+     * inputs and other makers fall back to makeElementBoolean().
+     *
+     * @return The original content of this TopoShape is discarded and replaced
+     *         with the new shape. The function returns the TopoShape itself as
+     *         a self reference so that multiple operations can be carried out
+     *         for the same shape in the same line of code.
+     */
+    TopoShape& makeElementDisjointBoolean(const char* maker,
+                                          const std::vector<TopoShape>& sources,
+                                          const char* op = nullptr,
+                                          double tol = -1.0);
+
+    /** Fuse, cut or intersect many shapes with a balanced tree of smaller booleans
+     *
+     * @param maker: one of OpCodes::Fuse, OpCodes::Cut or OpCodes::Common
+     * @param sources: list of source shapes
+     * @param op: optional string to be encoded into topo naming for indicating
+     *            the operation
+     * @param tol: fuzzy value of the booleans, negative for automatic
+     *
+     * The shapes are clustered by the position of their bounding boxes, and
+     * each cluster is fused on its own. The booleans of one level of the tree
+     * run in parallel, then their results are fused in turn. A cut or common
+     * applies the first shape to the union of the others built this way, the
+     * same as makeElementBoolean() does.
+     *
+     * makeElementBoolean() switches to this function once the number of
+     * inputs reaches the "TreeThreshold" parameter of the Part boolean
+     * preferences. The mapped element names include the intermediate fuses,
+     * so they differ from those of a single boolean.
+     *
+     * @return The original content of this TopoShape is discarded and replaced
+     *         with the new shape. The function returns the TopoShape itself as
+     *         a self reference so that multiple operations can be carried out
+     *         for the same shape in the same line of code.
+     */
+    TopoShape& makeElementTreeBoolean(const char* maker,
+                                      const std::vector<TopoShape>& sources,
+                                      const char* op = nullptr,
+                                      double tol = -1.0);
+
     /** Make a mirrored shape
      *
      * @param source: the source shape
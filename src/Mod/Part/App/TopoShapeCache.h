@@ -37,6 +37,7 @@
 #include <TopExp.hxx>
 #include <TopExp_Explorer.hxx>
 #include <TopTools_ListIteratorOfListOfShape.hxx>
+#include <functional>
 #include <utility>
 #endif
 
@@ -66,6 +67,11 @@ public:
     /// generated.
     Data::ElementMapPtr cachedElementMap;
 
+    /// Deferred builder of the element map. It is set instead of generating
+    /// the map at once when lazy element mapping is enabled, and is invoked
+    /// the first time the owner TopoShape flushes its element map.
+    std::function<Data::ElementMapPtr()> pendingElementMap;
+
     /// Location of the original cached TopoDS_Shape.
     TopLoc_Location subLocation;
 
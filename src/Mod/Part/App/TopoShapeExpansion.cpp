@@ -29,6 +29,8 @@
 
 #include <BRepAdaptor_Curve.hxx>
 #include <BRepAdaptor_CompCurve.hxx>
+#include <BRepBndLib.hxx>
+#include <Bnd_Box.hxx>
 #if OCC_VERSION_HEX < 0x070600
 #include <BRepAdaptor_HCurve.hxx>
 #include <BRepAdaptor_HCompCurve.hxx>
@@ -79,6 +81,7 @@
 #include <ShapeFix_ShapeTolerance.hxx>
 #include <gp_Pln.hxx>
 
+#include <future>
 #include <utility>
 
 #endif
@@ -94,11 +97,13 @@
 #include "TopoShapeCache.h"
 #include "TopoShapeMapper.h"
 #include "FaceMaker.h"
+#include "FuzzyHelper.h"
 #include "Geometry.h"
 #include "BRepOffsetAPI_MakeOffsetFix.h"
 #include "Base/Tools.h"
 #include "Base/BoundBox.h"
 
+#include <App/Application.h>
 #include <App/ElementMap.h>
 #include <App/ElementNamingUtils.h>
 #include <ShapeAnalysis_FreeBoundsProperties.hxx>
@@ -154,6 +159,7 @@ Data::ElementMapPtr TopoShape::resetElementMap(Data::ElementMapPtr elementMap)
     }
     if (elementMap) {
         _cache->cachedElementMap = elementMap;
+        _cache->pendingElementMap = nullptr;
         _cache->subLocation.Identity();
         _subLocation.Identity();
         _parentCache.reset();
@@ -168,6 +174,12 @@ void TopoShape::flushElementMap() const
         if (this->_cache->cachedElementMap) {
             const_cast<TopoShape*>(this)->resetElementMap(this->_cache->cachedElementMap);
         }
+        else if (this->_cache->pendingElementMap) {
+            // Clear the builder before running it, as it queries element names of its own
+            auto build = std::move(this->_cache->pendingElementMap);
+            this->_cache->pendingElementMap = nullptr;
+            const_cast<TopoShape*>(this)->resetElementMap(build());
+        }
         else if (this->_parentCache) {
             TopoShape parent(this->Tag, this->Hasher, this->_parentCache->shape);
             parent._cache = _parentCache;
@@ -715,7 +727,8 @@ std::vector<TopoDS_Shape> TopoShape::findAncestorsShapes(const TopoDS_Shape& sub
 bool TopoShape::hasPendingElementMap() const
 {
     return !elementMap(false) && this->_cache
-        && (this->_parentCache || this->_cache->cachedElementMap);
+        && (this->_parentCache || this->_cache->cachedElementMap
+            || this->_cache->pendingElementMap);
 }
 
 bool TopoShape::canMapElement(const TopoShape& other) const
@@ -1384,6 +1397,27 @@ void checkForParallelOrCoplanar(const TopoDS_Shape& newShape,
     }
 }
 
+namespace
+{
+ParameterGrp::handle elementMapParameters()
+{
+    return App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Part/General");
+}
+
+/// Whether to postpone element map generation until an element name is queried
+bool useLazyElementMap()
+{
+    return elementMapParameters()->GetBool("LazyElementMap", false);
+}
+
+/// Whether to collect the names of vertices, edges and faces concurrently
+bool useParallelElementMap()
+{
+    return elementMapParameters()->GetBool("ParallelElementMap", false);
+}
+}  // namespace
+
 // TODO: Refactor makeShapeWithElementMap to reduce complexity
 TopoShape& TopoShape::makeShapeWithElementMap(const TopoDS_Shape& shape,
                                               const Mapper& mapper,
@@ -1400,8 +1434,10 @@ TopoShape& TopoShape::makeShapeWithElementMap(const TopoDS_Shape& shape,
     }
 
     size_t canMap = 0;
-    for (auto& incomingShape : shapes) {
-        if (canMapElement(incomingShape)) {
+    std::vector<bool> mappable(shapes.size(), false);
+    for (size_t idx = 0; idx < shapes.size(); ++idx) {
+        if (canMapElement(shapes[idx])) {
+            mappable[idx] = true;
             ++canMap;
         }
     }
@@ -1419,11 +1455,30 @@ TopoShape& TopoShape::makeShapeWithElementMap(const TopoDS_Shape& shape,
     _op += '_';
 
     initCache();
+    if (useLazyElementMap() && !dynamic_cast<const MapperSnapshot*>(&mapper)) {
+        // The maker may not outlive this call, so record its history now and
+        // leave the naming to the first query of an element name.
+        auto history = std::make_shared<MapperSnapshot>(mapper, shapes);
+        _cache->cachedElementMap.reset();
+        _cache->pendingElementMap =
+            [shape = _Shape, tag = Tag, hasher = Hasher, history, shapes, op = std::string(op)]() {
+                TopoShape res(tag, hasher);
+                res.makeShapeWithElementMap(shape, *history, shapes, op.c_str());
+                return res.elementMap(false);
+            };
+        return *this;
+    }
+
     ShapeInfo vertexInfo(_Shape, TopAbs_VERTEX, _cache->getAncestry(TopAbs_VERTEX));
     ShapeInfo edgeInfo(_Shape, TopAbs_EDGE, _cache->getAncestry(TopAbs_EDGE));
     ShapeInfo faceInfo(_Shape, TopAbs_FACE, _cache->getAncestry(TopAbs_FACE));
     mapSubElement(shapes);  // Intentionally leave the op off here
 
+    // make room for a name of each new sub-element at once
+    if (auto map = elementMap(false)) {
+        map->reserve(vertexInfo.count() + edgeInfo.count() + faceInfo.count());
+    }
+
     std::array<ShapeInfo*, 3> infos = {&vertexInfo, &edgeInfo, &faceInfo};
 
     std::array<ShapeInfo*, TopAbs_SHAPE> infoMap {};
@@ -1440,16 +1495,17 @@ TopoShape& TopoShape::makeShapeWithElementMap(const TopoDS_Shape& shape,
     std::string postfix;
     Data::MappedName newName;
 
-    std::map<Data::IndexedName, std::map<NameKey, NameInfo>> newNames;
+    using NewNameMap = std::map<Data::IndexedName, std::map<NameKey, NameInfo>>;
+    NewNameMap newNames;
 
     // First, collect names from other shapes that generates or modifies the
     // new shape
-    for (auto& pinfo : infos) {  // Walk Vertexes, then Edges, then Faces
-        auto& info = *pinfo;
-        for (const auto& incomingShape : shapes) {
-            if (!canMapElement(incomingShape)) {
+    auto collectNames = [&](ShapeInfo& info, const Mapper& shapeMapper, NewNameMap& collected) {
+        for (size_t idx = 0; idx < shapes.size(); ++idx) {
+            if (!mappable[idx]) {
                 continue;
             }
+            const auto& incomingShape = shapes[idx];
             auto& otherMap = incomingShape._cache->getAncestry(info.type);
             if (otherMap.count() == 0) {
                 continue;
@@ -1465,7 +1521,7 @@ TopoShape& TopoShape::makeShapeWithElementMap(const TopoDS_Shape& shape,
                                                 &sids));
 
                 int newShapeCounter = 0;
-                for (auto& newShape : mapper.modified(otherElement)) {
+                for (auto& newShape : shapeMapper.modified(otherElement)) {
                     ++newShapeCounter;
                     if (newShape.ShapeType() >= TopAbs_SHAPE) {
                         // NOLINTNEXTLINE
@@ -1506,7 +1562,7 @@ TopoShape& TopoShape::makeShapeWithElementMap(const TopoDS_Shape& shape,
                     }
 
                     key.tag = incomingShape.Tag;
-                    auto& name_info = newNames[element][key];
+                    auto& name_info = collected[element][key];
                     name_info.sids = sids;
                     name_info.index = newShapeCounter;
                     name_info.shapetype = info.shapetype;
@@ -1518,7 +1574,7 @@ TopoShape& TopoShape::makeShapeWithElementMap(const TopoDS_Shape& shape,
                 // Find all new objects that were generated from an old object
                 // (e.g. a face generated from an edge)
                 newShapeCounter = 0;
-                for (auto& newShape : mapper.generated(otherElement)) {
+                for (auto& newShape : shapeMapper.generated(otherElement)) {
                     if (newShape.ShapeType() >= TopAbs_SHAPE) {
                         // NOLINTNEXTLINE
                         FC_ERR("unknown generated shape type " << newShape.ShapeType() << " from "
@@ -1588,7 +1644,7 @@ TopoShape& TopoShape::makeShapeWithElementMap(const TopoDS_Shape& shape,
                         }
 
                         key.tag = incomingShape.Tag;
-                        auto& name_info = newNames[element][key];
+                        auto& name_info = collected[element][key];
                         name_info.sids = sids;
                         if (newShapeCounter == parallelFace) {
                             name_info.index = std::numeric_limits<int>::min();
@@ -1605,6 +1661,53 @@ TopoShape& TopoShape::makeShapeWithElementMap(const TopoDS_Shape& shape,
                 }
             }
         }
+    };
+
+    if (!useParallelElementMap() || !_Shape.Location().IsIdentity()) {
+        for (auto& pinfo : infos) {  // Walk Vertexes, then Edges, then Faces
+            collectNames(*pinfo, mapper, newNames);
+        }
+    }
+    else {
+        // OCC makers are not safe to query concurrently, so work on a recorded
+        // history. Everything the collection step would otherwise build on
+        // demand is prepared here, leaving only reads for the worker threads.
+        std::shared_ptr<MapperSnapshot> history;
+        const Mapper* shapeMapper = dynamic_cast<const MapperSnapshot*>(&mapper);
+        if (!shapeMapper) {
+            history = std::make_shared<MapperSnapshot>(mapper, shapes);
+            shapeMapper = history.get();
+        }
+        flushElementMap();
+        for (size_t idx = 0; idx < shapes.size(); ++idx) {
+            if (mappable[idx]) {
+                shapes[idx].flushElementMap();
+                for (auto& pinfo : infos) {
+                    shapes[idx]._cache->getAncestry(pinfo->type);
+                }
+            }
+        }
+
+        std::array<NewNameMap, 3> collected;
+        std::vector<std::future<void>> tasks;
+        for (size_t i = 0; i < infos.size(); ++i) {
+            tasks.push_back(std::async(std::launch::async, [&, i]() {
+                collectNames(*infos[i], *shapeMapper, collected[i]);
+            }));
+        }
+        for (auto& task : tasks) {
+            task.get();
+        }
+
+        // Merge in the order of the serial walk, so that later entries win as before
+        for (auto& names : collected) {
+            for (auto& [element, keys] : names) {
+                auto& target = newNames[element];
+                for (auto& [key, nameInfo] : keys) {
+                    target[key] = std::move(nameInfo);
+                }
+            }
+        }
     }
 
     // We shall first exclude those names generated from high level mapping. If
@@ -5562,6 +5665,58 @@ bool TopoShape::fixSolidOrientation()
     return false;
 }
 
+/// Minimum number of shapes for makeElementBoolean() to switch to makeElementTreeBoolean(), 0 to
+/// never switch
+int getTreeBooleanThreshold()
+{
+    return static_cast<int>(App::GetApplication()
+                                .GetParameterGroupByPath(
+                                    "User parameter:BaseApp/Preferences/Mod/Part/Boolean")
+                                ->GetInt("TreeThreshold", 0));
+}
+
+namespace
+{
+/// Maximum number of shapes handed to one boolean by makeElementTreeBoolean()
+constexpr std::size_t TreeBooleanFanout = 8;
+
+using ShapeCenter = std::pair<gp_XYZ, const TopoShape*>;
+
+/// Split the shapes at the median of their bounding box centers along the longest extent, until
+/// each group holds no more than TreeBooleanFanout shapes. Neighbouring groups stay close.
+void clusterShapes(std::vector<ShapeCenter>::iterator begin,
+                   std::vector<ShapeCenter>::iterator end,
+                   std::vector<std::vector<TopoShape>>& groups)
+{
+    if (end - begin <= static_cast<std::ptrdiff_t>(TreeBooleanFanout)) {
+        auto& group = groups.emplace_back();
+        for (auto it = begin; it != end; ++it) {
+            group.push_back(*it->second);
+        }
+        return;
+    }
+
+    Bnd_Box bounds;
+    for (auto it = begin; it != end; ++it) {
+        bounds.Add(gp_Pnt(it->first));
+    }
+    gp_XYZ extent = bounds.CornerMax().XYZ() - bounds.CornerMin().XYZ();
+    int axis = 1;
+    if (extent.Y() > extent.Coord(axis)) {
+        axis = 2;
+    }
+    if (extent.Z() > extent.Coord(axis)) {
+        axis = 3;
+    }
+    auto middle = begin + (end - begin) / 2;
+    std::nth_element(begin, middle, end, [axis](const ShapeCenter& a, const ShapeCenter& b) {
+        return a.first.Coord(axis) < b.first.Coord(axis);
+    });
+    clusterShapes(begin, middle, groups);
+    clusterShapes(middle, end, groups);
+}
+}  // namespace
+
 TopoShape& TopoShape::makeElementBoolean(const char* maker,
                                          const TopoShape& shape,
                                          const char* op,
@@ -5709,6 +5864,12 @@ TopoShape& TopoShape::makeElementBoolean(const char* maker,
         return *this;
     }
 
+    int treeThreshold = getTreeBooleanThreshold();
+    if (treeThreshold > 0 && inputs.size() >= static_cast<std::size_t>(treeThreshold)
+        && inputs.size() > TreeBooleanFanout && strcmp(maker, Part::OpCodes::Section) != 0) {
+        return makeElementTreeBoolean(maker, inputs, op, tolerance);
+    }
+
     std::unique_ptr<BRepAlgoAPI_BooleanOperation> mk;
     if (strcmp(maker, Part::OpCodes::Fuse) == 0) {
         mk.reset(new FCBRepAlgoAPI_Fuse);
@@ -5770,6 +5931,211 @@ TopoShape& TopoShape::makeElementBoolean(const char* maker,
     return *this;
 }
 
+TopoShape& TopoShape::makeElementTreeBoolean(const char* maker,
+                                             const std::vector<TopoShape>& shapes,
+                                             const char* op,
+                                             double tolerance)
+{
+    if (!maker) {
+        FC_THROWM(Base::CADKernelError, "no maker");
+    }
+
+    bool fuse = strcmp(maker, Part::OpCodes::Fuse) == 0;
+    if ((!fuse && strcmp(maker, Part::OpCodes::Cut) != 0
+         && strcmp(maker, Part::OpCodes::Common) != 0)
+        || shapes.size() <= TreeBooleanFanout) {
+        return makeElementBoolean(maker, shapes, op, tolerance);
+    }
+    for (const auto& shape : shapes) {
+        if (shape.isNull()) {
+            FC_THROWM(NullShapeException, "Null input shape");
+        }
+    }
+
+    if (!op) {
+        op = maker;
+    }
+
+    // Use one fuzzy value for all the partial booleans, the same as a single boolean would get
+    if (tolerance < 0.0) {
+        Bnd_Box bounds;
+        for (const auto& shape : shapes) {
+            BRepBndLib::Add(shape.getShape(), bounds);
+        }
+        tolerance = FuzzyHelper::getBooleanFuzzy() * std::sqrt(bounds.SquareExtent())
+            * Precision::Confusion();
+    }
+
+    if (!fuse) {
+        // OCCT cuts or intersects the first shape with the union of all the others. Build that
+        // union by the tree, its solids no longer intersect each other.
+        TopoShape tools(0, Hasher);
+        tools.makeElementTreeBoolean(Part::OpCodes::Fuse,
+                                     std::vector<TopoShape>(shapes.begin() + 1, shapes.end()),
+                                     nullptr,
+                                     tolerance);
+        std::vector<TopoShape> inputs {shapes.front()};
+        expandCompound(tools, inputs);
+        return makeElementDisjointBoolean(maker, inputs, op, tolerance);
+    }
+
+    std::vector<TopoShape> inputs;
+    for (const auto& shape : shapes) {
+        expandCompound(shape, inputs);
+    }
+    std::vector<ShapeCenter> centers;
+    centers.reserve(inputs.size());
+    for (const auto& shape : inputs) {
+        Bnd_Box box;
+        BRepBndLib::Add(shape.getShape(), box);
+        gp_XYZ center;
+        if (!box.IsVoid()) {
+            center = (box.CornerMin().XYZ() + box.CornerMax().XYZ()) / 2.0;
+        }
+        centers.emplace_back(center, &shape);
+    }
+    std::vector<std::vector<TopoShape>> groups;
+    clusterShapes(centers.begin(), centers.end(), groups);
+
+    while (true) {
+        std::vector<std::unique_ptr<FCBRepAlgoAPI_Fuse>> makers(groups.size());
+        for (std::size_t i = 0; i < groups.size(); ++i) {
+            const auto& group = groups[i];
+            if (group.size() < 2) {
+                continue;
+            }
+            TopTools_ListOfShape shapeArguments, shapeTools;
+            shapeArguments.Append(group.front().getShape());
+            for (auto it = group.begin() + 1; it != group.end(); ++it) {
+                shapeTools.Append(it->getShape());
+            }
+            makers[i] = std::make_unique<FCBRepAlgoAPI_Fuse>();
+            makers[i]->SetArguments(shapeArguments);
+            makers[i]->SetTools(shapeTools);
+            if (tolerance > 0.0) {
+                makers[i]->SetFuzzyValue(tolerance);
+            }
+        }
+
+        // The partial booleans of one level are independent. The element maps are built
+        // afterwards in this thread, because the string hasher is not thread safe.
+        auto build = [&makers](int i) {
+            if (makers[i]) {
+                try {
+                    makers[i]->Build();
+                }
+                catch (Standard_Failure&) {
+                    // reported below through IsDone()
+                }
+            }
+        };
+#if OCC_VERSION_HEX >= 0x070500
+        OSD_Parallel::For(0, static_cast<int>(makers.size()), build);
+#else
+        for (int i = 0; i < static_cast<int>(makers.size()); ++i) {
+            build(i);
+        }
+#endif
+
+        std::vector<TopoShape> results;
+        results.reserve(groups.size());
+        for (std::size_t i = 0; i < groups.size(); ++i) {
+            if (!makers[i]) {
+                results.push_back(groups[i].front());
+                continue;
+            }
+            if (!makers[i]->IsDone()) {
+                FC_THROWM(Base::CADKernelError, "Partial fuse of the boolean tree failed");
+            }
+            results.emplace_back(0, Hasher).makeElementShape(*makers[i], groups[i], op);
+        }
+
+        if (results.size() == 1) {
+            *this = results.front();
+            break;
+        }
+
+        // Results of neighbouring groups are close to each other, fuse them in turn
+        groups.clear();
+        for (std::size_t i = 0; i < results.size(); i += TreeBooleanFanout) {
+            auto last = std::min(results.size(), i + TreeBooleanFanout);
+            groups.emplace_back(results.begin() + i, results.begin() + last);
+        }
+    }
+
+    makeElementShell();
+    return *this;
+}
+
+TopoShape& TopoShape::makeElementDisjointBoolean(const char* maker,
+                                                 const std::vector<TopoShape>& shapes,
+                                                 const char* op,
+                                                 double tolerance)
+{
+    if (!maker) {
+        FC_THROWM(Base::CADKernelError, "no maker");
+    }
+
+    bool fuse = strcmp(maker, Part::OpCodes::Fuse) == 0;
+    bool common = strcmp(maker, Part::OpCodes::Common) == 0;
+    if ((!fuse && !common && strcmp(maker, Part::OpCodes::Cut) != 0) || shapes.size() < 3) {
+        return makeElementBoolean(maker, shapes, op, tolerance);
+    }
+    for (const auto& shape : shapes) {
+        // A compound base shape is fine to cut or intersect, but its children would not be fused
+        if (shape.isNull()
+            || (shape.shapeType() == TopAbs_COMPOUND && (fuse || &shape != &shapes.front()))) {
+            return makeElementBoolean(maker, shapes, op, tolerance);
+        }
+    }
+
+    if (!op) {
+        op = maker;
+    }
+
+    // OCCT never intersects the sub-shapes of one and the same argument with
+    // each other, which is exactly what the caller vouched for.
+    BRep_Builder builder;
+    TopoDS_Compound comp;
+    builder.MakeCompound(comp);
+    for (auto it = shapes.begin() + 1; it != shapes.end(); ++it) {
+        builder.Add(comp, it->getShape());
+    }
+
+    // Use the plain OCCT makers, FCBRepAlgoAPI_Cut would fuse the compound of
+    // tools before cutting.
+    std::unique_ptr<BRepAlgoAPI_BooleanOperation> mk;
+    if (fuse) {
+        mk.reset(new BRepAlgoAPI_Fuse);
+    }
+    else if (common) {
+        mk.reset(new BRepAlgoAPI_Common);
+    }
+    else {
+        mk.reset(new BRepAlgoAPI_Cut);
+    }
+
+    TopTools_ListOfShape shapeArguments, shapeTools;
+    shapeArguments.Append(shapes.front().getShape());
+    shapeTools.Append(comp);
+
+    mk->SetRunParallel(Standard_True);
+    mk->SetNonDestructive(Standard_True);
+    mk->SetArguments(shapeArguments);
+    mk->SetTools(shapeTools);
+    if (tolerance > 0.0) {
+        mk->SetFuzzyValue(tolerance);
+    }
+    else if (tolerance < 0.0) {
+        FCBRepAlgoAPIHelper::setAutoFuzzy(mk.get());
+    }
+    mk->Build();
+    // The history of the compound's children is the history of the tools
+    makeElementShape(*mk, shapes, op);
+    makeElementShell();
+    return *this;
+}
+
 bool TopoShape::isSame(const Data::ComplexGeoData& _other) const
 {
     if (!_other.isDerivedFrom<TopoShape>()) {
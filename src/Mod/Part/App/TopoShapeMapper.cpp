@@ -203,4 +203,27 @@ void GenericShapeMapper::init(const TopoShape& src, const TopoDS_Shape& dst)
     }
 }
 
+MapperSnapshot::MapperSnapshot(const TopoShape::Mapper& mapper,
+                               const std::vector<TopoShape>& sources)
+{
+    for (const auto& source : sources) {
+        if (source.isNull()) {
+            continue;
+        }
+        for (auto type : {TopAbs_VERTEX, TopAbs_EDGE, TopAbs_FACE}) {
+            for (const auto& subShape : source.getSubShapes(type)) {
+                // The mapper returns a reference to a reused buffer, so copy it out at once
+                const auto& modified = mapper.modified(subShape);
+                if (!modified.empty()) {
+                    _modified.emplace(subShape, modified);
+                }
+                const auto& generated = mapper.generated(subShape);
+                if (!generated.empty()) {
+                    _generated.emplace(subShape, generated);
+                }
+            }
+        }
+    }
+}
+
 }  // namespace Part
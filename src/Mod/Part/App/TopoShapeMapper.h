@@ -22,6 +22,7 @@
  ***************************************************************************/
 
 #include <map>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -243,6 +244,46 @@ struct PartExport GenericShapeMapper: ShapeMapper {
     void init(const TopoShape &src, const TopoDS_Shape &dst);
 };
 
+/** Shape mapper holding a recorded copy of the history of another mapper
+ *
+ * The modified and generated shapes of every vertex, edge and face of the
+ * given sources are queried once at construction. The history stays
+ * available after the original maker is gone, and being read only, it can
+ * be queried from several threads at once.
+ */
+struct PartExport MapperSnapshot: TopoShape::Mapper
+{
+    /** Record the history of the given mapper
+     *
+     * @param mapper: the mapper to query
+     * @param sources: the input shapes whose sub shapes are queried
+     */
+    MapperSnapshot(const TopoShape::Mapper& mapper, const std::vector<TopoShape>& sources);
+
+    const std::vector<TopoDS_Shape>& generated(const TopoDS_Shape& s) const override
+    {
+        auto iter = _generated.find(s);
+        if (iter != _generated.end()) {
+            return iter->second;
+        }
+        return _res;
+    }
+
+    const std::vector<TopoDS_Shape>& modified(const TopoDS_Shape& s) const override
+    {
+        auto iter = _modified.find(s);
+        if (iter != _modified.end()) {
+            return iter->second;
+        }
+        return _res;
+    }
+
+    typedef std::unordered_map<TopoDS_Shape, std::vector<TopoDS_Shape>, ShapeHasher, ShapeHasher>
+        ShapeMap;
+    ShapeMap _generated;
+    ShapeMap _modified;
+};
+
 /// Parameters for TopoShape::makeElementFilledFace()
 struct PartExport TopoShape::BRepFillingParams
 {
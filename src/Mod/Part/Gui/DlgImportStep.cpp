@@ -47,6 +47,7 @@ DlgImportStep::DlgImportStep(QWidget* parent)
     ui->checkBoxUseBaseName->setChecked(settings.getUseBaseName());
     ui->checkBoxReduceObjects->setChecked(settings.getReduceObjects());
     ui->checkBoxExpandCompound->setChecked(settings.getExpandCompound());
+    ui->checkBoxShareShapes->setChecked(settings.getShareShapes());
     ui->checkBoxShowProgress->setChecked(settings.getShowProgress());
 #if OCC_VERSION_HEX >= 0x070800
     std::list<Part::OCAF::ImportExportSettings::CodePage> codepagelist;
@@ -78,6 +79,7 @@ void DlgImportStep::saveSettings()
     ui->checkBoxUseBaseName->onSave();
     ui->checkBoxReduceObjects->onSave();
     ui->checkBoxExpandCompound->onSave();
+    ui->checkBoxShareShapes->onSave();
     ui->checkBoxShowProgress->onSave();
     ui->comboBoxImportMode->onSave();
 }
@@ -94,6 +96,7 @@ void DlgImportStep::loadSettings()
     ui->checkBoxUseBaseName->onRestore();
     ui->checkBoxReduceObjects->onRestore();
     ui->checkBoxExpandCompound->onRestore();
+    ui->checkBoxShareShapes->onRestore();
     ui->checkBoxShowProgress->onRestore();
     ui->comboBoxImportMode->onRestore();
 }
@@ -109,6 +112,7 @@ StepImportSettings DlgImportStep::getSettings() const
     set.reduceObjects = settings.getReduceObjects();
     set.showProgress = settings.getShowProgress();
     set.expandCompound = settings.getExpandCompound();
+    set.shareShapes = settings.getShareShapes();
     set.mode = static_cast<int>(settings.getImportMode());
 #if OCC_VERSION_HEX >= 0x070800
     Resource_FormatType cp = settings.getImportCodePage();
@@ -36,11 +36,13 @@
 # include <Inventor/SoPrimitiveVertex.h>
 # include <Inventor/actions/SoGetBoundingBoxAction.h>
 # include <Inventor/actions/SoGLRenderAction.h>
+# include <Inventor/actions/SoRayPickAction.h>
 # include <Inventor/bundles/SoMaterialBundle.h>
 # include <Inventor/bundles/SoTextureCoordinateBundle.h>
 # include <Inventor/elements/SoLazyElement.h>
 # include <Inventor/elements/SoOverrideElement.h>
 # include <Inventor/elements/SoCoordinateElement.h>
+# include <Inventor/elements/SoPickStyleElement.h>
 # include <Inventor/elements/SoGLCoordinateElement.h>
 # include <Inventor/elements/SoGLCacheContextElement.h>
 # include <Inventor/elements/SoGLVBOElement.h>
@@ -68,6 +70,7 @@
 # include <Inventor/C/glue/gl.h>
 #endif
 
+#include <Gui/Inventor/TriangleBVH.h>
 #include <Gui/SoFCInteractiveElement.h>
 #include <Gui/Selection/SoFCSelectionAction.h>
 #include <Gui/Selection/SoFCUnifiedSelection.h>
@@ -171,6 +174,7 @@ SoBrepFaceSet::SoBrepFaceSet()
     packedColor = 0;
 
     pimpl = std::make_unique<VBO>();
+    pickTree = std::make_unique<Gui::TriangleBVH>(&coordIndex);
 }
 
 SoBrepFaceSet::~SoBrepFaceSet() = default;
@@ -1868,6 +1872,39 @@ void SoBrepFaceSet::renderShape(SoGLRenderAction * action,
     glEnd();
 }
 
+void SoBrepFaceSet::rayPick(SoRayPickAction * action)
+{
+    if (!this->shouldRayPick(action))
+        return;
+
+    // Large shapes are picked through the triangle hierarchy instead of testing every triangle
+    // generated by generatePrimitives(). Picking by bounding box is left to the base class.
+    SoState * state = action->getState();
+    const SoCoordinateElement * coords = SoCoordinateElement::getInstance(state);
+    const SbVec3f * coords3d = coords->is3D() ? coords->getArrayPtr3() : nullptr;
+    if (SoPickStyleElement::get(state) == SoPickStyleElement::BOUNDING_BOX
+        || this->vertexProperty.getValue()
+        || !pickTree->update(coords->getNodeId(), coords3d, coords->getNum())) {
+        inherited::rayPick(action);
+        return;
+    }
+
+    this->computeObjectSpaceRay(action);
+    const int32_t * indices = this->partIndex.getValues(0);
+    int num = this->partIndex.getNum();
+    pickTree->rayPick(action, this, coords3d, [indices, num](SoFaceDetail * face_detail) {
+        int index = face_detail->getFaceIndex();
+        int count = 0;
+        for (int i=0; i<num; i++) {
+            count += indices[i];
+            if (index < count) {
+                face_detail->setPartIndex(i);
+                break;
+            }
+        }
+    });
+}
+
 SoDetail * SoBrepFaceSet::createTriangleDetail(SoRayPickAction * action,
                                                const SoPrimitiveVertex * v1,
                                                const SoPrimitiveVertex * v2,
@@ -35,6 +35,9 @@
 class SoGLCoordinateElement;
 class SoTextureCoordinateBundle;
 
+namespace Gui {
+class TriangleBVH;
+}
 
 namespace PartGui {
 
@@ -95,6 +98,7 @@ protected:
         SoPickedPoint * pp) override;
     void generatePrimitives(SoAction * action) override;
     void getBoundingBox(SoGetBoundingBoxAction * action) override;
+    void rayPick(SoRayPickAction * action) override;
 
 private:
     enum Binding {
@@ -154,6 +158,9 @@ private:
     // Define some VBO pointer for the current mesh
     class VBO;
     std::unique_ptr<VBO> pimpl;
+
+    // Triangle hierarchy to speed up picking of large shapes
+    std::unique_ptr<Gui::TriangleBVH> pickTree;
 };
 
 } // namespace PartGui
@@ -33,11 +33,15 @@
 #include <TopExp_Explorer.hxx>
 #endif
 
+#include <algorithm>
 #include <array>
+#include <cmath>
 
 #include <Base/Console.h>
 #include <Base/Exception.h>
 #include <Base/Reader.h>
+#include <Base/TimeInfo.h>
+#include <Mod/Part/App/FuzzyHelper.h>
 #include <Mod/Part/App/modelRefine.h>
 
 #include "FeatureTransformed.h"
@@ -50,9 +54,66 @@
 #include "FeatureSketchBased.h"
 #include "Mod/Part/App/TopoShapeOpCode.h"
 
+FC_LOG_LEVEL_INIT("PartDesign", true, true)
 
 using namespace PartDesign;
 
+namespace
+{
+/// Whether the bounding boxes of the tool shapes, i.e. all but the first shape, are apart from
+/// each other, including the gap the boolean's fuzzy value would close
+bool areToolsApart(const std::vector<Part::TopoShape>& shapes)
+{
+    if (shapes.size() < 3) {
+        return false;
+    }
+
+    Bnd_Box bounds;
+    std::vector<Bnd_Box> boxes;
+    boxes.reserve(shapes.size() - 1);
+    for (auto it = shapes.begin(); it != shapes.end(); ++it) {
+        Bnd_Box box;
+        BRepBndLib::Add(it->getShape(), box);
+        if (box.IsVoid()) {
+            return false;
+        }
+        bounds.Add(box);
+        if (it != shapes.begin()) {
+            boxes.push_back(box);
+        }
+    }
+    double gap = Precision::Confusion()
+        * (1.0 + Part::FuzzyHelper::getBooleanFuzzy() * std::sqrt(bounds.SquareExtent()));
+    for (auto& box : boxes) {
+        box.Enlarge(gap);
+    }
+
+    // Sweep along the longest extent of the pattern, so that only boxes overlapping in that
+    // direction need a full check
+    gp_XYZ extent = bounds.CornerMax().XYZ() - bounds.CornerMin().XYZ();
+    int axis = 1;
+    if (extent.Y() > extent.Coord(axis)) {
+        axis = 2;
+    }
+    if (extent.Z() > extent.Coord(axis)) {
+        axis = 3;
+    }
+    std::sort(boxes.begin(), boxes.end(), [axis](const Bnd_Box& a, const Bnd_Box& b) {
+        return a.CornerMin().Coord(axis) < b.CornerMin().Coord(axis);
+    });
+    for (std::size_t i = 0; i < boxes.size(); ++i) {
+        double end = boxes[i].CornerMax().Coord(axis);
+        for (std::size_t j = i + 1; j < boxes.size() && boxes[j].CornerMin().Coord(axis) <= end;
+             ++j) {
+            if (!boxes[i].IsOut(boxes[j])) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+}  // namespace
+
 namespace PartDesign
 {
 extern bool getPDRefineModelParameter();
@@ -198,6 +259,7 @@ short Transformed::mustExecute() const
 
 App::DocumentObjectExecReturn* Transformed::execute()
 {
+    booleanStatistics = BooleanStatistics();
     if (isMultiTransformChild()) {
         return App::DocumentObject::StdReturn;
     }
@@ -285,6 +347,26 @@ App::DocumentObjectExecReturn* Transformed::execute()
         return shapes;
     };
 
+    // Instances that are apart from each other can go into a single boolean without the
+    // intersections among them, which is what makes large patterns of holes or pads slow
+    auto applyBoolean = [&](const char* maker, const std::vector<TopoShape>& shapes) {
+        Base::TimeElapsed start;
+        bool apart = areToolsApart(shapes);
+        if (apart) {
+            supportShape.makeElementDisjointBoolean(maker, shapes);
+        }
+        else {
+            supportShape.makeElementBoolean(maker, shapes);
+        }
+        float seconds = Base::TimeElapsed::diffTimeF(start);
+        int instances = static_cast<int>(shapes.size()) - 1;
+        (apart ? booleanStatistics.separate : booleanStatistics.overlapping) += instances;
+        booleanStatistics.seconds += seconds;
+        FC_LOG(getFullName() << ": " << maker << " of " << instances
+                             << (apart ? " separate" : " overlapping") << " instances time: "
+                             << seconds << 's');
+    };
+
     switch (mode) {
         case Mode::TransformToolShapes:
             // NOTE: It would be possible to build a compound from all original addShapes/subShapes
@@ -319,15 +401,17 @@ App::DocumentObjectExecReturn* Transformed::execute()
                     cutShape = cutShape.makeElementTransform(trsf);
                 }
                 if (!fuseShape.isNull()) {
-                    supportShape.makeElementFuse(getTransformedCompShape(supportShape, fuseShape));
+                    applyBoolean(Part::OpCodes::Fuse,
+                                 getTransformedCompShape(supportShape, fuseShape));
                 }
                 if (!cutShape.isNull()) {
-                    supportShape.makeElementCut(getTransformedCompShape(supportShape, cutShape));
+                    applyBoolean(Part::OpCodes::Cut,
+                                 getTransformedCompShape(supportShape, cutShape));
                 }
             }
             break;
         case Mode::TransformBody: {
-            supportShape.makeElementFuse(getTransformedCompShape(supportShape, supportShape));
+            applyBoolean(Part::OpCodes::Fuse, getTransformedCompShape(supportShape, supportShape));
             break;
         }
     }
@@ -99,6 +99,17 @@ public:
      */
     TopoDS_Shape rejected;
 
+    /** The booleans of the last execute, shown in the status of the feature. Instances that
+     * are apart from each other are added without computing their intersections.
+     */
+    struct BooleanStatistics
+    {
+        int separate {0};
+        int overlapping {0};
+        float seconds {0.0F};
+    };
+    BooleanStatistics booleanStatistics;
+
 protected:
     void Restore(Base::XMLReader& reader) override;
     void handleChangedPropertyType(Base::XMLReader& reader,
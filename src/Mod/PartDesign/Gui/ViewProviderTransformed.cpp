@@ -189,6 +189,13 @@ void ViewProviderTransformed::recomputeFeature(bool recompute)
     } else {
         msg = msg.arg(QStringLiteral("<font color='green'>%1<br/></font>"));
         msg = msg.arg(QObject::tr("Transformation succeeded"));
+        const auto& stats = pcTransformed->booleanStatistics;
+        if (stats.separate > 0 || stats.overlapping > 0) {
+            msg += QObject::tr("%1 separate and %2 overlapping instances added in %3 s")
+                       .arg(stats.separate)
+                       .arg(stats.overlapping)
+                       .arg(stats.seconds, 0, 'f', 2);
+        }
     }
     diagMessage = msg;
     signalDiagnosis(msg);
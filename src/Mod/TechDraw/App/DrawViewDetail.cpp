@@ -33,7 +33,6 @@
 #include <BRepTools.hxx>
 #include <BRep_Builder.hxx>
 #include <Bnd_Box.hxx>
-#include <QtConcurrentRun>
 #include <TopExp_Explorer.hxx>
 #include <TopoDS.hxx>
 #include <TopoDS_Compound.hxx>
@@ -60,6 +59,7 @@
 #include "DrawViewSection.h"
 #include "GeometryObject.h"
 #include "Preferences.h"
+#include "ProjectionScheduler.h"
 #include "ShapeUtils.h"
 
 
@@ -189,20 +189,14 @@ void DrawViewDetail::detailExec(TopoDS_Shape& shape, DrawViewPart* dvp, DrawView
         return;
     }
 
-    //note that &m_detailWatcher in the third parameter is not strictly required, but using the
-    //4 parameter signature instead of the 3 parameter signature prevents clazy warning:
-    //https://github.com/KDE/clazy/blob/1.11/docs/checks/README-connect-3arg-lambda.md
-    connectDetailWatcher =
-        QObject::connect(&m_detailWatcher, &QFutureWatcherBase::finished, &m_detailWatcher,
-                         [this] { this->onMakeDetailFinished(); });
-
     // We create a lambda closure to hold a copy of shape.
     // This is important because this variable might be local to the calling
     // function and might get destructed before the parallel processing finishes.
     // TODO: What about dvp and dvs? Do they live past makeDetailShape?
     auto lambda = [this, shape, dvp, dvs]{this->makeDetailShape(shape, dvp, dvs);};
-    m_detailFuture = QtConcurrent::run(std::move(lambda));
-    m_detailWatcher.setFuture(m_detailFuture);
+    m_detailFuture = ProjectionScheduler::instance().schedule(
+        this, ProjectionScheduler::Stage::ShapePreparation, std::move(lambda),
+        [this] { this->onMakeDetailFinished(); });
     waitingForDetail(true);
 }
 
@@ -402,7 +396,6 @@ void DrawViewDetail::postHlrTasks(void)
 void DrawViewDetail::onMakeDetailFinished(void)
 {
     waitingForDetail(false);
-    QObject::disconnect(connectDetailWatcher);
 
     //ancestor's buildGeometryObject will run HLR and face finding in a separate thread
     m_tempGeometryObject = buildGeometryObject(m_scaledShape, m_viewAxis);
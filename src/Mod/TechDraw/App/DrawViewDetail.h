@@ -105,8 +105,6 @@ protected:
     TopoDS_Shape m_scaledShape;
     gp_Ax2 m_viewAxis;
 
-    QMetaObject::Connection connectDetailWatcher;
-    QFutureWatcher<void> m_detailWatcher;
     QFuture<void> m_detailFuture;
     bool m_waitingForDetail;
 
@@ -48,7 +48,6 @@
 #include <BRep_Tool.hxx>
 #include <Bnd_Box.hxx>
 #include <HLRAlgo_Projector.hxx>
-#include <QtConcurrentRun>
 #include <ShapeAnalysis.hxx>
 #include <TopExp.hxx>
 #include <TopExp_Explorer.hxx>
@@ -89,6 +88,7 @@
 #include "GeometryObject.h"
 #include "ShapeExtractor.h"
 #include "Preferences.h"
+#include "ProjectionScheduler.h"
 #include "ShapeUtils.h"
 
 using namespace TechDraw;
@@ -148,6 +148,15 @@ DrawViewPart::DrawViewPart()
     ADD_PROPERTY_TYPE(ScrubCount, (Preferences::scrubCount()), sgroup, App::Prop_None,
                       "The number of times FreeCAD should try to clean the HLR result.");
 
+    //the result of the last HLR run is saved with the document, so views with unchanged shape
+    //and projection don't need to run HLR again
+    ADD_PROPERTY_TYPE(HlrCache, (TopoDS_Shape()), sgroup,
+                      (App::PropertyType)(App::Prop_Hidden | App::Prop_Output),
+                      "The result of the last hidden line removal");
+    ADD_PROPERTY_TYPE(HlrCacheKey, (""), sgroup,
+                      (App::PropertyType)(App::Prop_Hidden | App::Prop_Output),
+                      "The shape and projection the HLR result belongs to");
+
     //initialize bbox to non-garbage
     bbox = Base::BoundBox3d(Base::Vector3d(0.0, 0.0, 0.0), 0.0);
 }
@@ -163,6 +172,7 @@ DrawViewPart::~DrawViewPart()
         Base::Console().Message("%s is waiting for face finding to finish\n", Label.getValue());
         m_faceFuture.waitForFinished();
     }
+    ProjectionScheduler::instance().forget(this);
     removeAllReferencesFromGeom();
 }
 
@@ -351,6 +361,9 @@ TechDraw::GeometryObjectPtr DrawViewPart::buildGeometryObject(TopoDS_Shape& shap
     go->setFocus(Focus.getValue());
     go->usePolygonHLR(CoarseView.getValue());
     go->setScrubCount(ScrubCount.getValue());
+    if (Preferences::cacheHlrResult()) {
+        go->setHlrCache(HlrCacheKey.getValue(), HlrCache.getValue());
+    }
 
     if (CoarseView.getValue()) {
         //the polygon approximation HLR process runs quickly, so doesn't need to be in a
@@ -359,18 +372,13 @@ TechDraw::GeometryObjectPtr DrawViewPart::buildGeometryObject(TopoDS_Shape& shap
     }
     else {
         //projectShape (the HLR process) runs in a separate thread since it can take a long time
-        //note that &m_hlrWatcher in the third parameter is not strictly required, but using the
-        //4 parameter signature instead of the 3 parameter signature prevents clazy warning:
-        //https://github.com/KDE/clazy/blob/1.11/docs/checks/README-connect-3arg-lambda.md
-        connectHlrWatcher = QObject::connect(&m_hlrWatcher, &QFutureWatcherBase::finished,
-                                             &m_hlrWatcher, [this] { this->onHlrFinished(); });
-
         // We create a lambda closure to hold a copy of go, shape and viewAxis.
         // This is important because those variables might be local to the calling
         // function and might get destructed before the parallel processing finishes.
         auto lambda = [go, shape, viewAxis]{go->projectShape(shape, viewAxis);};
-        m_hlrFuture = QtConcurrent::run(std::move(lambda));
-        m_hlrWatcher.setFuture(m_hlrFuture);
+        m_hlrFuture = ProjectionScheduler::instance().schedule(
+            this, ProjectionScheduler::Stage::Hlr, std::move(lambda),
+            [this] { this->onHlrFinished(); });
         waitingForHlr(true);
     }
     return go;
@@ -399,25 +407,25 @@ void DrawViewPart::onHlrFinished()
     bbox = geometryObject->calcBoundingBox();
 
     waitingForHlr(false);
-    QObject::disconnect(connectHlrWatcher);
     showProgressMessage(getNameInDocument(), "has finished finding hidden lines");
 
+    //keep the HLR output for the next recompute
+    std::string hlrKey = geometryObject->getHlrKey();
+    if (!hlrKey.empty() && hlrKey != HlrCacheKey.getValue()) {
+        HlrCache.setValue(geometryObject->getHlrResult());
+        HlrCacheKey.setValue(hlrKey);
+    }
+
     postHlrTasks();//application level tasks that depend on HLR/GO being complete
 
     //start face finding in a separate thread.  We don't find faces when using the polygon
     //HLR method.
     if (handleFaces() && !CoarseView.getValue()) {
         try {
-            //note that &m_faceWatcher in the third parameter is not strictly required, but using the
-            //4 parameter signature instead of the 3 parameter signature prevents clazy warning:
-            //https://github.com/KDE/clazy/blob/1.11/docs/checks/README-connect-3arg-lambda.md
-            connectFaceWatcher =
-                QObject::connect(&m_faceWatcher, &QFutureWatcherBase::finished, &m_faceWatcher,
-                                 [this] { this->onFacesFinished(); });
-
             auto lambda = [this]{this->extractFaces();};
-            m_faceFuture = QtConcurrent::run(std::move(lambda));
-            m_faceWatcher.setFuture(m_faceFuture);
+            m_faceFuture = ProjectionScheduler::instance().schedule(
+                this, ProjectionScheduler::Stage::FaceFinding, std::move(lambda),
+                [this] { this->onFacesFinished(); });
             waitingForFaces(true);
         }
         catch (Standard_Failure& e) {
@@ -698,7 +706,6 @@ void DrawViewPart::onFacesFinished()
 {
     //    Base::Console().Message("DVP::onFacesFinished() - %s\n", getNameInDocument());
     waitingForFaces(false);
-    QObject::disconnect(connectFaceWatcher);
     showProgressMessage(getNameInDocument(), "has finished extracting faces");
 
     // Now we can recompute Dimensions and do other tasks possibly depending on Face extraction
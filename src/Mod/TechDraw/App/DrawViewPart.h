@@ -35,6 +35,7 @@
 #include <App/FeaturePython.h>
 #include <App/PropertyLinks.h>
 #include <Base/BoundBox.h>
+#include <Mod/Part/App/PropertyTopoShape.h>
 #include <Mod/TechDraw/TechDrawGlobal.h>
 
 #include "CosmeticExtension.h"
@@ -111,6 +112,9 @@ public:
 
     App::PropertyInteger ScrubCount;
 
+    Part::PropertyPartShape HlrCache;
+    App::PropertyString HlrCacheKey;
+
     short mustExecute() const override;
     App::DocumentObjectExecReturn* execute() override;
     const char* getViewProviderName() const override { return "TechDrawGui::ViewProviderViewPart"; }
@@ -251,11 +255,7 @@ private:
     bool m_waitingForFaces;
     bool m_waitingForHlr;
 
-    QMetaObject::Connection connectHlrWatcher;
-    QFutureWatcher<void> m_hlrWatcher;
     QFuture<void> m_hlrFuture;
-    QMetaObject::Connection connectFaceWatcher;
-    QFutureWatcher<void> m_faceWatcher;
     QFuture<void> m_faceFuture;
 
 };
@@ -56,7 +56,6 @@
 #include <BRepTools.hxx>
 #include <BRep_Builder.hxx>
 #include <Bnd_Box.hxx>
-#include <QtConcurrentRun>
 #include <ShapeAnalysis.hxx>
 #include <ShapeFix_Shape.hxx>
 #include <TopExp.hxx>
@@ -91,6 +90,7 @@
 #include "EdgeWalker.h"
 #include "GeometryObject.h"
 #include "Preferences.h"
+#include "ProjectionScheduler.h"
 
 #include "DrawViewSection.h"
 
@@ -460,21 +460,13 @@ void DrawViewSection::sectionExec(TopoDS_Shape& baseShape)
     m_cuttingTool = makeCuttingTool(m_shapeSize);
 
     try {
-        // note that &m_cutWatcher in the third parameter is not strictly required,
-        // but using the 4 parameter signature instead of the 3 parameter signature
-        // prevents clazy warning:
-        // https://github.com/KDE/clazy/blob/1.11/docs/checks/README-connect-3arg-lambda.md
-        connectCutWatcher =
-            QObject::connect(&m_cutWatcher, &QFutureWatcherBase::finished, &m_cutWatcher, [this] {
-                this->onSectionCutFinished();
-            });
-
         // We create a lambda closure to hold a copy of baseShape.
         // This is important because this variable might be local to the calling
         // function and might get destructed before the parallel processing finishes.
         auto lambda = [this, baseShape]{this->makeSectionCut(baseShape);};
-        m_cutFuture = QtConcurrent::run(std::move(lambda));
-        m_cutWatcher.setFuture(m_cutFuture);
+        m_cutFuture = ProjectionScheduler::instance().schedule(
+            this, ProjectionScheduler::Stage::ShapePreparation, std::move(lambda),
+            [this] { this->onSectionCutFinished(); });
         waitingForCut(true);
     }
     catch (...) {
@@ -617,8 +609,6 @@ void DrawViewSection::onSectionCutFinished()
 {
     //    Base::Console().Message("DVS::onSectionCutFinished() - %s\n",
     //    getNameInDocument());
-    QObject::disconnect(connectCutWatcher);
-
     showProgressMessage(getNameInDocument(), "has finished making section cut");
 
     m_preparedShape = prepareShape(getShapeToPrepare(), m_shapeSize);
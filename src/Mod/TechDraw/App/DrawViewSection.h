@@ -201,8 +201,6 @@ protected:
     gp_Ax2 m_projectionCS;
     TopoDS_Shape m_preparedShape;//the shape after cutting, centering, scaling etc
 
-    QMetaObject::Connection connectCutWatcher;
-    QFutureWatcher<void> m_cutWatcher;
     QFuture<void> m_cutFuture;
     bool m_waitingForCut;
     TopoDS_Shape m_cuttingTool;
@@ -26,6 +26,8 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+#include <sstream>
+#include <QCryptographicHash>
 #include <BRepAlgo_NormalProjection.hxx>
 #include <BRepBndLib.hxx>
 #include <BRepBuilderAPI_Copy.hxx>
@@ -37,6 +39,7 @@
 #include <BRepLib.hxx>
 #include <BRepMesh_IncrementalMesh.hxx>
 #include <BRepTools.hxx>
+#include <BRepTools_ShapeSet.hxx>
 #include <BRep_Builder.hxx>
 #include <BRep_Tool.hxx>
 #include <Bnd_Box.hxx>
@@ -50,7 +53,9 @@
 #include <TopExp_Explorer.hxx>
 #include <TopoDS.hxx>
 #include <TopoDS_Edge.hxx>
+#include <TopoDS_Compound.hxx>
 #include <TopoDS_Face.hxx>
+#include <TopoDS_Iterator.hxx>
 #include <TopoDS_Shape.hxx>
 #include <TopoDS_Vertex.hxx>
 #include <gp_Ax1.hxx>
@@ -83,7 +88,7 @@ using DU = DrawUtil;
 
 GeometryObject::GeometryObject(const string& parent, TechDraw::DrawView* parentObj)
     : m_parentName(parent), m_parent(parentObj), m_isoCount(0), m_isPersp(false), m_focus(100.0),
-      m_usePolygonHLR(false), m_scrubCount(0)
+      m_usePolygonHLR(false), m_scrubCount(0), m_useHlrCache(false)
 
 {}
 
@@ -144,6 +149,14 @@ void GeometryObject::projectShape(const TopoDS_Shape& inShape, const gp_Ax2& vie
 {
     clear();
 
+    if (m_useHlrCache) {
+        m_hlrKey = makeHlrKey(inShape, viewAxis);
+        if (m_hlrKey == m_cacheKey && setHlrResult(m_cacheResult)) {
+            makeTDGeometry();
+            return;
+        }
+    }
+
     Handle(HLRBRep_Algo) brep_hlr;
     try {
         brep_hlr = new HLRBRep_Algo();
@@ -247,6 +260,94 @@ void GeometryObject::projectShape(const TopoDS_Shape& inShape, const gp_Ax2& vie
     makeTDGeometry();
 }
 
+//! supply the result of a previous HLR run. projectShape will use it instead of running HLR if
+//! the key matches the shape and projection parameters.
+void GeometryObject::setHlrCache(const std::string& key, const TopoDS_Shape& result)
+{
+    m_useHlrCache = true;
+    m_cacheKey = key;
+    m_cacheResult = result;
+}
+
+//! make a key identifying the HLR output for this shape and projection.  The key is based on the
+//! geometry of the shape, not on its identity, so it survives saving and restoring the document.
+//! Triangulations are left out, they are irrelevant for HLR and change whenever the shape is
+//! meshed again for display.
+std::string GeometryObject::makeHlrKey(const TopoDS_Shape& shape, const gp_Ax2& viewAxis) const
+{
+    std::stringstream ss;
+    BRepTools_ShapeSet shapeSet(Standard_False);
+    shapeSet.Add(shape);
+    shapeSet.Write(ss);
+    shapeSet.Write(shape, ss);
+    std::string brep = ss.str();
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    hash.addData(QByteArray::fromRawData(brep.data(), static_cast<int>(brep.size())));
+
+    std::stringstream key;
+    key.precision(17);
+    key << hash.result().toHex().constData();
+    const gp_Pnt& loc = viewAxis.Location();
+    const gp_Dir& dir = viewAxis.Direction();
+    const gp_Dir& xDir = viewAxis.XDirection();
+    key << " " << loc.X() << " " << loc.Y() << " " << loc.Z();
+    key << " " << dir.X() << " " << dir.Y() << " " << dir.Z();
+    key << " " << xDir.X() << " " << xDir.Y() << " " << xDir.Z();
+    key << " " << m_isoCount << " " << m_isPersp << " " << (m_isPersp ? m_focus : 0.0);
+    return key.str();
+}
+
+//! returns the HLR output as a compound of the edge compounds in a fixed order
+TopoDS_Shape GeometryObject::getHlrResult() const
+{
+    BRep_Builder builder;
+    TopoDS_Compound result;
+    builder.MakeCompound(result);
+    for (auto& shape : {visHard, visOutline, visSmooth, visSeam, visIso,
+                        hidHard, hidOutline, hidSmooth, hidSeam, hidIso}) {
+        if (shape.IsNull()) {
+            //keep the position of the missing compounds
+            TopoDS_Compound empty;
+            builder.MakeCompound(empty);
+            builder.Add(result, empty);
+        }
+        else {
+            builder.Add(result, shape);
+        }
+    }
+    return result;
+}
+
+//! restore the HLR output from a compound made by getHlrResult
+bool GeometryObject::setHlrResult(const TopoDS_Shape& result)
+{
+    std::vector<TopoDS_Shape> shapes;
+    if (!result.IsNull()) {
+        for (TopoDS_Iterator it(result); it.More(); it.Next()) {
+            TopoDS_Shape shape = it.Value();
+            if (!TopoDS_Iterator(shape).More()) {
+                shape.Nullify();
+            }
+            shapes.push_back(shape);
+        }
+    }
+    if (shapes.size() != 10) {
+        return false;
+    }
+
+    visHard = shapes[0];
+    visOutline = shapes[1];
+    visSmooth = shapes[2];
+    visSeam = shapes[3];
+    visIso = shapes[4];
+    hidHard = shapes[5];
+    hidOutline = shapes[6];
+    hidSmooth = shapes[7];
+    hidSeam = shapes[8];
+    hidIso = shapes[9];
+    return true;
+}
+
 //convert the hlr output into TD Geometry
 void GeometryObject::makeTDGeometry()
 {
@@ -99,6 +99,10 @@ public:
     double getFocus() { return m_focus; }
     void setScrubCount(int count) { m_scrubCount = count; }
 
+    void setHlrCache(const std::string& key, const TopoDS_Shape& result);
+    std::string getHlrKey() const { return m_hlrKey; }
+    TopoDS_Shape getHlrResult() const;
+
 
     void pruneVertexGeom(Base::Vector3d center, double radius);
 
@@ -158,6 +162,9 @@ protected:
 
     bool findVertex(Base::Vector3d v);
 
+    std::string makeHlrKey(const TopoDS_Shape& shape, const gp_Ax2& viewAxis) const;
+    bool setHlrResult(const TopoDS_Shape& result);
+
     std::string m_parentName;
     TechDraw::DrawView* m_parent;
     int m_isoCount;
@@ -165,6 +172,11 @@ protected:
     double m_focus;
     bool m_usePolygonHLR;
     int m_scrubCount;
+
+    bool m_useHlrCache;
+    std::string m_hlrKey;     //key of the last projectShape
+    std::string m_cacheKey;   //key and output of a previous HLR run
+    TopoDS_Shape m_cacheResult;
 };
 
 using GeometryObjectPtr = std::shared_ptr<GeometryObject>;
@@ -35,11 +35,14 @@
 #include <algorithm>
 #include <cstdio>
 #include <chrono>
+#include <condition_variable>
+#include <deque>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <limits>
 #include <map>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -59,9 +62,13 @@
 #include <QDateTime>
 #include <QDomDocument>
 #include <QFile>
+#include <QFutureInterface>
 #include <QLocale>
 #include <QRegularExpression>
 #include <QRegularExpressionMatch>
+#include <QRunnable>
+#include <QThread>
+#include <QThreadPool>
 #include <QtConcurrentRun>
 
 // OpenCasCade
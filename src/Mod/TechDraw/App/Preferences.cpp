@@ -657,6 +657,20 @@ bool Preferences::enforceISODate()
     return getPreferenceGroup("Standards")->GetBool("EnforceISODate", false);
 }
 
+//! if true, the output of HLR is saved with the view and reused while shape and projection
+//! are unchanged.
+bool Preferences::cacheHlrResult()
+{
+    return getPreferenceGroup("HLR")->GetBool("CacheHlrResult", true);
+}
+
+//! the number of threads used for HLR and face finding of all views. 0 uses all cores.
+int Preferences::projectionThreadCount()
+{
+    return getPreferenceGroup("HLR")->GetInt("ProjectionThreads", 0);
+}
+
+
 //! if true, shapes are validated before use and problematic ones are skipped.
 //! validating shape takes time, but can prevent crashes/bad results in occt.
 //! this would normally be set to false and set to true to aid in debugging/support.
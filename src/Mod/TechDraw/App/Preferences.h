@@ -155,6 +155,9 @@ public:
     static bool enforceISODate();
     static bool switchOnClick();
 
+    static bool cacheHlrResult();
+    static int projectionThreadCount();
+
     static bool checkShapesBeforeUse();
     static bool debugBadShape();
 
@@ -0,0 +1,219 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2024 The FreeCAD Project Association                     *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+#ifndef _PreComp_
+#include <QCoreApplication>
+#include <QFutureInterface>
+#include <QRunnable>
+#include <QThread>
+#include <Standard_Failure.hxx>
+#endif
+
+#include <App/Application.h>
+#include <Base/Console.h>
+#include <Base/Exception.h>
+
+#include "DrawViewPart.h"
+#include "Preferences.h"
+#include "ProjectionScheduler.h"
+
+
+using namespace TechDraw;
+
+namespace
+{
+//! runs a task in the pool and reports to the scheduler when it is done
+class ProjectionTask: public QRunnable
+{
+public:
+    ProjectionTask(std::function<void()> task, std::function<void()> finished)
+        : m_task(std::move(task)), m_finished(std::move(finished))
+    {
+        m_future.reportStarted();
+    }
+
+    QFuture<void> future() { return m_future.future(); }
+
+    void run() override
+    {
+        try {
+            m_task();
+        }
+        catch (const Base::Exception& e) {
+            Base::Console().Error("TechDraw projection task failed - %s\n", e.what());
+        }
+        catch (const Standard_Failure& e) {
+            Base::Console().Error("TechDraw projection task failed - OCC error - %s\n",
+                                  e.GetMessageString());
+        }
+        catch (const std::exception& e) {
+            Base::Console().Error("TechDraw projection task failed - %s\n", e.what());
+        }
+        catch (...) {
+            Base::Console().Error("TechDraw projection task failed - unknown error\n");
+        }
+        m_finished();
+        m_future.reportFinished();
+    }
+
+private:
+    std::function<void()> m_task;
+    std::function<void()> m_finished;
+    QFutureInterface<void> m_future;
+};
+}// namespace
+
+ProjectionScheduler::ProjectionScheduler() : m_running(0)
+{
+    setMaxThreadCount(Preferences::projectionThreadCount());
+
+    //there is no event loop to deliver the continuations in console mode. Wait for the views at
+    //the end of a recompute instead.
+    connectRecomputed = App::GetApplication().signalRecomputed.connect(
+        [this](const App::Document& doc) { slotRecomputed(doc); });
+}
+
+ProjectionScheduler::~ProjectionScheduler()
+{
+    m_pool.waitForDone();
+}
+
+ProjectionScheduler& ProjectionScheduler::instance()
+{
+    static ProjectionScheduler scheduler;
+    return scheduler;
+}
+
+void ProjectionScheduler::setMaxThreadCount(int count)
+{
+    if (count <= 0) {
+        count = QThread::idealThreadCount();
+    }
+    m_pool.setMaxThreadCount(count);
+}
+
+//! views that are shown are done first. Within those, later steps of a view go before earlier
+//! steps of others, so finished views appear as soon as possible.
+int ProjectionScheduler::priority(const DrawViewPart* view, Stage stage)
+{
+    // Stage is declared in reverse order, the last step (face finding) has the value 0
+    int result = static_cast<int>(Stage::ShapePreparation) - static_cast<int>(stage);
+    if (view->Visibility.getValue()) {
+        result += 3;
+    }
+    return result;
+}
+
+QFuture<void> ProjectionScheduler::schedule(const DrawViewPart* view, Stage stage,
+                                            std::function<void()> task,
+                                            std::function<void()> whenDone)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ++m_running;
+    }
+
+    Continuation continuation {view, std::move(whenDone)};
+    auto finished = [this, continuation] { taskFinished(continuation); };
+    auto runnable = new ProjectionTask(std::move(task), std::move(finished));
+    QFuture<void> future = runnable->future();
+    m_pool.start(runnable, priority(view, stage));
+    return future;
+}
+
+//! called in the worker thread
+void ProjectionScheduler::taskFinished(Continuation continuation)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_continuations.push_back(std::move(continuation));
+        --m_running;
+    }
+    m_taskDone.notify_all();
+
+    if (QCoreApplication::instance()) {
+        QMetaObject::invokeMethod(
+            QCoreApplication::instance(), [this] { runContinuations(); }, Qt::QueuedConnection);
+    }
+}
+
+void ProjectionScheduler::runContinuations()
+{
+    while (true) {
+        Continuation continuation;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_continuations.empty()) {
+                return;
+            }
+            continuation = std::move(m_continuations.front());
+            m_continuations.pop_front();
+        }
+
+        try {
+            continuation.whenDone();
+        }
+        catch (const Base::Exception& e) {
+            Base::Console().Error("%s\n", e.what());
+        }
+        catch (const Standard_Failure& e) {
+            Base::Console().Error("TechDraw - OCC error - %s\n", e.GetMessageString());
+        }
+    }
+}
+
+void ProjectionScheduler::forget(const DrawViewPart* view)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto it = m_continuations.begin(); it != m_continuations.end();) {
+        if (it->view == view) {
+            it = m_continuations.erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
+}
+
+void ProjectionScheduler::waitForDone()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (m_running > 0 || !m_continuations.empty()) {
+        if (m_continuations.empty()) {
+            m_taskDone.wait(lock);
+            continue;
+        }
+        //the continuations may schedule further tasks
+        lock.unlock();
+        runContinuations();
+        lock.lock();
+    }
+}
+
+void ProjectionScheduler::slotRecomputed(const App::Document& /*doc*/)
+{
+    if (!QCoreApplication::instance()) {
+        waitForDone();
+    }
+}
@@ -0,0 +1,102 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2024 The FreeCAD Project Association                     *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#ifndef TECHDRAW_PROJECTIONSCHEDULER_H
+#define TECHDRAW_PROJECTIONSCHEDULER_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+
+#include <boost/signals2.hpp>
+#include <QFuture>
+#include <QThreadPool>
+
+#include <Mod/TechDraw/TechDrawGlobal.h>
+
+
+namespace App
+{
+class Document;
+}
+
+namespace TechDraw
+{
+class DrawViewPart;
+
+//! Runs the hidden line removal and face finding of all views on one bounded thread pool.
+//! The continuation of a task is called in the main thread. With a gui it is posted to the
+//! event loop, in console mode it is called when the document has finished its recompute, so
+//! a headless recompute returns with all views complete.
+class TechDrawExport ProjectionScheduler
+{
+public:
+    //! the steps of making a view, in reverse order
+    enum class Stage
+    {
+        FaceFinding,
+        Hlr,
+        ShapePreparation//section or detail cut
+    };
+
+    static ProjectionScheduler& instance();
+
+    //! run task in the pool, followed by whenDone in the main thread
+    QFuture<void> schedule(const DrawViewPart* view, Stage stage, std::function<void()> task,
+                           std::function<void()> whenDone);
+    //! discard the continuations of a view that is going away
+    void forget(const DrawViewPart* view);
+    //! block until all scheduled tasks, and the tasks started by their continuations, are done
+    void waitForDone();
+
+    int maxThreadCount() const { return m_pool.maxThreadCount(); }
+    void setMaxThreadCount(int count);
+
+private:
+    ProjectionScheduler();
+    ~ProjectionScheduler();
+
+    struct Continuation
+    {
+        const DrawViewPart* view = nullptr;
+        std::function<void()> whenDone;
+    };
+
+    static int priority(const DrawViewPart* view, Stage stage);
+    void taskFinished(Continuation continuation);
+    void runContinuations();
+    void slotRecomputed(const App::Document& doc);
+
+    QThreadPool m_pool;
+    std::mutex m_mutex;
+    std::condition_variable m_taskDone;
+    std::deque<Continuation> m_continuations;
+    int m_running;
+
+    boost::signals2::scoped_connection connectRecomputed;
+};
+
+}//namespace TechDraw
+
+#endif
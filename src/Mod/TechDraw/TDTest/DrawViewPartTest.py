@@ -50,5 +50,60 @@ class DrawViewPartTest(unittest.TestCase):
         self.assertEqual(len(edges), 4, "DrawViewPart has wrong number of edges")
         self.assertTrue("Up-to-date" in view.State, "DrawViewPart is not Up-to-date")
 
+    def testHlrResultReuse(self):
+        """Tests if the HLR result is reused while shape and projection are unchanged"""
+        print("testing DrawViewPart HLR cache")
+        import Part
+
+        view = FreeCAD.ActiveDocument.addObject("TechDraw::DrawViewPart", "View")
+        self.page.addView(view)
+        view.Source = [FreeCAD.ActiveDocument.Box]
+        FreeCAD.ActiveDocument.recompute()
+        self.waitForThreads()
+        self.assertEqual(len(view.getVisibleEdges()), 4)
+        key = view.HlrCacheKey
+        self.assertNotEqual(key, "")
+
+        # A cached result with a single visible edge shows if HLR runs again or not
+        def fakeHlrResult():
+            line = Part.makeCompound([Part.makeLine((0, 0, 0), (10, 0, 0))])
+            return Part.makeCompound([line] + [Part.makeCompound([]) for _ in range(9)])
+
+        view.HlrCache = fakeHlrResult()
+        view.touch()
+        FreeCAD.ActiveDocument.recompute()
+        self.waitForThreads()
+        self.assertEqual(len(view.getVisibleEdges()), 1, "HLR result was not reused")
+        self.assertEqual(view.HlrCacheKey, key)
+
+        # A new direction invalidates the cached result
+        view.HlrCache = fakeHlrResult()
+        view.Direction = FreeCAD.Vector(0, -1, 0)
+        FreeCAD.ActiveDocument.recompute()
+        self.waitForThreads()
+        self.assertEqual(len(view.getVisibleEdges()), 4, "HLR result of old direction was used")
+        self.assertNotEqual(view.HlrCacheKey, key)
+        key = view.HlrCacheKey
+
+        # And so does a new scale
+        view.HlrCache = fakeHlrResult()
+        view.ScaleType = "Custom"
+        view.Scale = 2.0
+        FreeCAD.ActiveDocument.recompute()
+        self.waitForThreads()
+        self.assertEqual(len(view.getVisibleEdges()), 4, "HLR result of old scale was used")
+        self.assertNotEqual(view.HlrCacheKey, key)
+
+    def waitForThreads(self):
+        """Waits for the projection threads to complete"""
+        loop = QtCore.QEventLoop()
+
+        timer = QtCore.QTimer()
+        timer.setSingleShot(True)
+        timer.timeout.connect(loop.quit)
+
+        timer.start(2000)   #2 second delay
+        loop.exec_()
+
 if __name__ == "__main__":
     unittest.main()
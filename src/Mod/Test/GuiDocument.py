@@ -21,6 +21,7 @@
 *                                                                          *
 ***************************************************************************/"""
 
+import time
 import FreeCAD, FreeCADGui, unittest
 
 # ---------------------------------------------------------------------------
@@ -55,3 +56,75 @@ class TestGuiDocument(unittest.TestCase):
         # Check if the new function returns the correct root objects
         expected_root_objects = [group1, group2, obj1, part1]
         self.assertEqual(set(root_objects), set(expected_root_objects))
+
+    def testRenderStatistics(self):
+        # All elements of a link array share the scene graph of the box
+        box = self.doc.addObject("Part::Box", "Box")
+        array = self.doc.addObject("App::Link", "Array")
+        array.LinkedObject = box
+        array.ElementCount = 100
+        self.doc.recompute()
+
+        # Always cache, so that the shared cache is recorded on the first frame
+        param = FreeCAD.ParamGet("User parameter:BaseApp/Preferences/View")
+        renderCache = param.GetInt("RenderCache", 0)
+        param.SetInt("RenderCache", 1)
+        try:
+            view = FreeCADGui.getDocument("TestDoc").activeView()
+            view.fitAll()
+
+            def render():
+                for _ in range(3):
+                    view.redraw()
+                    FreeCADGui.updateGui()
+                return view.getRenderStatistics()
+
+            stats = render()
+            self.assertEqual(set(stats.keys()), {"DrawTime", "FramesPerSecond", "Shapes"})
+            self.assertGreaterEqual(stats["DrawTime"], 0.0)
+            self.assertGreaterEqual(stats["FramesPerSecond"], 0.0)
+            shared = stats["Shapes"]
+
+            # A selected array renders its elements in the selection color, so each of
+            # them is traversed instead of replaying the shared cache
+            FreeCADGui.Selection.addSelection(array)
+            traversed = render()["Shapes"]
+            FreeCADGui.Selection.clearSelection()
+
+            self.assertGreaterEqual(traversed, array.ElementCount)
+            self.assertLess(shared, traversed)
+        finally:
+            param.SetInt("RenderCache", renderCache)
+
+    def testTreeStatusWithoutNotification(self):
+        from PySide import QtCore, QtGui
+
+        def processEvents(until, timeout):
+            end = time.time() + timeout
+            while not until() and time.time() < end:
+                FreeCADGui.updateGui()
+                time.sleep(0.05)
+            return until()
+
+        obj = self.doc.addObject("App::FeatureTest", "StatusTest")
+        self.doc.recompute()
+        # Let the tree create the item and finish the updates that follow the recompute
+        processEvents(lambda: False, 2.0)
+        items = []
+        for tree in FreeCADGui.getMainWindow().findChildren(QtGui.QTreeWidget):
+            items += tree.findItems(obj.Label, QtCore.Qt.MatchExactly | QtCore.Qt.MatchRecursive)
+        self.assertTrue(items)
+        item = items[0]
+
+        def icon():
+            return item.icon(0).pixmap(16, 16).toImage()
+
+        untouched = icon()
+
+        # Touching the object is notified and shows the recompute overlay
+        obj.touch()
+        self.assertTrue(processEvents(lambda: icon() != untouched, 5.0))
+
+        # Purging the touched state is no modification, but must be picked up as well
+        obj.purgeTouched()
+        self.assertTrue(processEvents(lambda: icon() == untouched, 5.0))
@@ -155,4 +155,34 @@ TEST_F(DocumentObjectTest, getSubObjectList)
     EXPECT_EQ(sizesFlatten[1], strlen(fuseName) + strlen(boxName) + 2);
 }
 
+TEST_F(DocumentObjectTest, statusChangesAreSignaled)
+{
+    // Arrange
+    auto obj {_doc->addObject("App::FeatureTest")};
+    _doc->recompute();
+    int count {0};
+    auto connection {_doc->signalChangedObjectStatus.connect(
+        [&count, obj](const App::DocumentObject& changed) {
+            if (&changed == obj) {
+                ++count;
+            }
+        })};
+
+    // Act and Assert
+    obj->touch();
+    obj->purgeTouched();
+    EXPECT_EQ(count, 1);
+    obj->setStatus(App::Error, true);
+    EXPECT_EQ(count, 2);
+    // Setting a status bit to its current value is no change
+    obj->setStatus(App::Error, true);
+    EXPECT_EQ(count, 2);
+    obj->purgeError();
+    EXPECT_EQ(count, 3);
+    // Other status bits are not shown anywhere
+    obj->setStatus(App::Expand, true);
+    EXPECT_EQ(count, 3);
+    connection.disconnect();
+}
+
 // NOLINTEND(readability-magic-numbers, cppcoreguidelines-avoid-magic-numbers)
@@ -1,5 +1,8 @@
 #include <gtest/gtest.h>
 #include <boost/core/ignore_unused.hpp>
+#include <chrono>
+#include <iostream>
+#include <thread>
 #include <QLockFile>
 #include <Base/FileInfo.h>
 #include <Base/Parameter.h>
@@ -462,4 +465,95 @@ TEST_F(ParameterTest, TestLockFile)
     lockFile2.unlock();
 }
 
+TEST_F(ParameterTest, TestCachedValues)
+{
+    auto cfg = getCreateConfig();
+    auto grp = cfg->GetGroup("TopLevelGroup");
+    EXPECT_EQ(grp->GetInt("Int", 5), 5);
+
+    grp->SetInt("Int", 1);
+    grp->SetASCII("String", "Text");
+    EXPECT_EQ(grp->GetInt("Int", 5), 1);
+    EXPECT_EQ(grp->GetASCII("String"), "Text");
+
+    grp->SetInt("Int", 2);
+    EXPECT_EQ(grp->GetInt("Int", 5), 2);
+
+    grp->RemoveInt("Int");
+    EXPECT_EQ(grp->GetInt("Int", 5), 5);
+    EXPECT_EQ(grp->GetASCII("String"), "Text");
+
+    grp->Clear();
+    EXPECT_EQ(grp->GetASCII("String", "Default"), "Default");
+}
+
+TEST_F(ParameterTest, TestCachedValuesAfterImport)
+{
+    auto cfg = getCreateConfig();
+    auto grp = cfg->GetGroup("TopLevelGroup/Sub1");
+    grp->SetFloat("Float", 1.0);
+    EXPECT_DOUBLE_EQ(grp->GetFloat("Float"), 1.0);
+
+    std::string fn = getFileName();
+    cfg->exportTo(fn.c_str());
+
+    grp->SetFloat("Float", 2.0);
+    EXPECT_DOUBLE_EQ(grp->GetFloat("Float"), 2.0);
+
+    cfg->importFrom(fn.c_str());
+    EXPECT_DOUBLE_EQ(cfg->GetGroup("TopLevelGroup/Sub1")->GetFloat("Float"), 1.0);
+}
+
+TEST_F(ParameterTest, TestConcurrentRead)
+{
+    auto cfg = getCreateConfig();
+    auto grp = cfg->GetGroup("TopLevelGroup");
+    grp->SetBool("Bool", true);
+    grp->SetUnsigned("Unsigned", 42);
+
+    std::vector<std::thread> threads;
+    std::vector<int> errors(4);
+    for (std::size_t i = 0; i < errors.size(); i++) {
+        threads.emplace_back([&grp, &errors, i]() {
+            for (int j = 0; j < 1000; j++) {
+                if (!grp->GetBool("Bool") || grp->GetUnsigned("Unsigned") != 42) {
+                    errors[i]++;
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (int error : errors) {
+        EXPECT_EQ(error, 0);
+    }
+}
+
+// Run with --gtest_also_run_disabled_tests to measure the parameter lookups
+TEST_F(ParameterTest, DISABLED_BenchmarkLookup)
+{
+    auto cfg = getCreateConfig();
+    auto grp = cfg->GetGroup("BaseApp/Preferences/Document");
+    for (int i = 0; i < 100; i++) {
+        grp->SetBool(("Bool" + std::to_string(i)).c_str(), (i % 2) != 0);
+    }
+
+    const int count = 1000000;
+    int hits = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < count; i++) {
+        auto hGrp = cfg->GetGroup("BaseApp/Preferences/Document");
+        if (hGrp->GetBool("Bool99") && !hGrp->GetBool("Missing")) {
+            hits++;
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+    EXPECT_EQ(hits, count);
+
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+    std::cout << "Parameter lookup: " << ns / count << " ns per iteration" << std::endl;
+}
+
 // NOLINTEND(cppcoreguidelines-*,readability-*)
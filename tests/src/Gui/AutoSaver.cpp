@@ -0,0 +1,215 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <future>
+#include <thread>
+#include <QDir>
+#include <QFile>
+#include <QRunnable>
+#include <QTemporaryDir>
+#include <QTest>
+#include <QThreadPool>
+
+#include <App/Application.h>
+#include <App/Document.h>
+#include <App/FeatureTest.h>
+#include <App/PropertyFile.h>
+#include <Base/FileInfo.h>
+#include <Base/Stream.h>
+
+#include "Gui/AutoSaver.h"
+#include <src/App/InitApplication.h>
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+// Writes a recovery file on a worker thread while the main thread keeps on editing
+// the document and checks that the restored file holds the state of the snapshot.
+class testAutoSaver: public QObject
+{
+    Q_OBJECT
+
+public:
+    testAutoSaver()
+    {
+        tests::initApplication();
+        // the documents are only saved when a test starts the timers
+        Gui::AutoSaver::instance()->setTimeout(0);
+        Gui::AutoSaver::instance()->setCompressed(true);
+    }
+
+private Q_SLOTS:
+
+    void init()
+    {
+        docName = App::GetApplication().getUniqueDocumentName("AutoSaver");
+        doc = App::GetApplication().newDocument(docName.c_str(), "testUser");
+        feature = static_cast<App::FeatureTest*>(doc->addObject("App::FeatureTest", "Test"));
+        std::vector<double> values(Size);
+        for (int i = 0; i < Size; i++) {
+            values[i] = i;
+        }
+        feature->FloatList.setValues(values);
+        feature->Integer.setValue(1);
+    }
+
+    void cleanup()
+    {
+        Gui::AutoSaver::instance()->setTimeout(0);
+        QThreadPool::globalInstance()->waitForDone();
+        QCoreApplication::processEvents();
+        App::GetApplication().closeDocument(docName.c_str());
+    }
+
+    void test_WriteWhileEditing()  // NOLINT
+    {
+        QTemporaryDir dir;
+        QVERIFY(dir.isValid());
+        std::string path = dir.filePath(QStringLiteral("fc_recovery_file.fcstd")).toStdString();
+
+        Gui::RecoverySnapshotWriter writer;
+        takeSnapshot(writer);
+
+        std::thread worker([&writer, &path]() {
+            writeArchive(writer, path);
+        });
+        for (int i = 0; i < 20; i++) {
+            feature->FloatList.setValues(std::vector<double>(Size, -1.0));
+            feature->Integer.setValue(i + 2);
+        }
+        worker.join();
+
+        App::Document* restored = App::GetApplication().openDocument(path.c_str());
+        QVERIFY(restored);
+        std::string restoredName = restored->getName();
+        auto copy = dynamic_cast<App::FeatureTest*>(restored->getObject("Test"));
+        bool valid = copy && copy->Integer.getValue() == 1 && copy->FloatList.getSize() == Size
+            && copy->FloatList[Size - 1] == double(Size - 1);
+        App::GetApplication().closeDocument(restoredName.c_str());
+        QVERIFY(valid);
+    }
+
+    void test_IncludedFileOfSnapshot()  // NOLINT
+    {
+        QTemporaryDir dir;
+        QVERIFY(dir.isValid());
+        std::string path = dir.filePath(QStringLiteral("fc_recovery_file.fcstd")).toStdString();
+        auto prop = static_cast<App::PropertyFileIncluded*>(
+            feature->addDynamicProperty("App::PropertyFileIncluded", "File"));
+        prop->setValue(writeFile(dir, "included.txt", "snapshot").c_str());
+
+        Gui::RecoverySnapshotWriter writer;
+        takeSnapshot(writer);
+
+        // change the included file of the document before the archive is written
+        QFile included(QString::fromUtf8(prop->getValue()));
+        included.setPermissions(QFile::ReadOwner | QFile::WriteOwner);
+        QVERIFY(included.open(QFile::WriteOnly));
+        included.write("changed");
+        included.close();
+
+        writeArchive(writer, path);
+
+        App::Document* restored = App::GetApplication().openDocument(path.c_str());
+        QVERIFY(restored);
+        std::string restoredName = restored->getName();
+        QByteArray text;
+        auto copy = restored->getObject("Test");
+        auto file = copy ? dynamic_cast<App::PropertyFileIncluded*>(
+                               copy->getPropertyByName("File")) : nullptr;
+        if (file) {
+            QFile restoredFile(QString::fromUtf8(file->getValue()));
+            if (restoredFile.open(QFile::ReadOnly)) {
+                text = restoredFile.readAll();
+            }
+        }
+        App::GetApplication().closeDocument(restoredName.c_str());
+        QCOMPARE(text, QByteArray("snapshot"));
+    }
+
+    void test_SkipBusyDocument()  // NOLINT
+    {
+        // Keep the only thread of the pool busy, so that the recovery file is not written
+        QThreadPool* pool = QThreadPool::globalInstance();
+        int maxThreads = pool->maxThreadCount();
+        pool->setMaxThreadCount(1);
+        std::promise<void> release;
+        std::shared_future<void> released = release.get_future().share();
+        pool->start(QRunnable::create([released]() {
+            released.wait();
+        }));
+
+        QString meta = transientFile("fc_recovery_file.xml");
+        Gui::AutoSaver::instance()->setTimeout(50);
+        QTRY_VERIFY(QFile::exists(meta));
+
+        // The next timer events skip the document while its recovery file is written
+        QFile::remove(meta);
+        feature->Integer.setValue(2);
+        QTest::qWait(300);
+        bool skipped = !QFile::exists(meta);
+
+        release.set_value();
+        pool->waitForDone();
+        pool->setMaxThreadCount(maxThreads);
+        QVERIFY(skipped);
+        QTRY_VERIFY(QFile::exists(meta));
+        QTRY_VERIFY(QFile::exists(transientFile("fc_recovery_file.fcstd")));
+    }
+
+    void test_RetryAfterFailure()  // NOLINT
+    {
+        // Without the transient directory the recovery file can't be written
+        QString transientDir = QString::fromUtf8(doc->TransientDir.getValue());
+        QVERIFY(QDir(transientDir).removeRecursively());
+        Gui::AutoSaver::instance()->setTimeout(50);
+        QTest::qWait(300);
+        Gui::AutoSaver::instance()->setTimeout(0);
+        QThreadPool::globalInstance()->waitForDone();
+        QCoreApplication::processEvents();
+
+        // The changes are kept, so the file is written once it is possible again
+        QVERIFY(QDir().mkpath(transientDir));
+        Gui::AutoSaver::instance()->setTimeout(50);
+        QTRY_VERIFY(QFile::exists(transientFile("fc_recovery_file.fcstd")));
+    }
+
+private:
+    void takeSnapshot(Gui::RecoverySnapshotWriter& writer)
+    {
+        writer.setMode("BinaryBrep");
+        writer.putNextEntry("Document.xml");
+        doc->Save(writer);
+        writer.writeFiles();
+    }
+
+    static void writeArchive(const Gui::RecoverySnapshotWriter& writer, const std::string& path)
+    {
+        Base::FileInfo fi(path);
+        Base::ofstream file(fi, std::ios::out | std::ios::binary);
+        writer.writeArchive(file);
+    }
+
+    static std::string writeFile(const QTemporaryDir& dir, const char* name, const char* text)
+    {
+        QFile file(dir.filePath(QString::fromLatin1(name)));
+        file.open(QFile::WriteOnly);
+        file.write(text);
+        return file.fileName().toStdString();
+    }
+
+    QString transientFile(const char* name) const
+    {
+        return QStringLiteral("%1/%2").arg(QString::fromUtf8(doc->TransientDir.getValue()),
+                                           QString::fromLatin1(name));
+    }
+
+    static constexpr int Size = 100000;
+    std::string docName;
+    App::Document* doc {};
+    App::FeatureTest* feature {};
+};
+
+// NOLINTEND(readability-magic-numbers)
+
+QTEST_MAIN(testAutoSaver)
+
+#include "AutoSaver.moc"
@@ -0,0 +1,251 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <cmath>
+#include <memory>
+#include <QTest>
+
+#include <Inventor/SbViewportRegion.h>
+#include <Inventor/SoDB.h>
+#include <Inventor/SoPickedPoint.h>
+#include <Inventor/actions/SoRayPickAction.h>
+#include <Inventor/details/SoFaceDetail.h>
+#include <Inventor/nodes/SoCoordinate3.h>
+#include <Inventor/nodes/SoIndexedFaceSet.h>
+#include <Inventor/nodes/SoPickStyle.h>
+#include <Inventor/nodes/SoSeparator.h>
+
+#include <Gui/Selection/SoFCUnifiedSelection.h>
+#include <Mod/Mesh/Gui/SoFCIndexedFaceSet.h>
+#include <Mod/Part/Gui/SoBrepFaceSet.h>
+#include <src/App/InitApplication.h>
+
+// NOLINTBEGIN(readability-magic-numbers,cppcoreguidelines-*)
+
+// Picks a wavy grid of triangles with a hole in the middle through Coin's SoIndexedFaceSet
+// and through the face sets of Part and Mesh, which use Gui::TriangleBVH. Needs no OpenGL
+// context, so it runs headless.
+class testFaceSetPick: public QObject
+{
+    Q_OBJECT
+
+public:
+    testFaceSetPick()
+    {
+        tests::initApplication();
+        SoDB::init();
+        Gui::SoFCSeparator::initClass();
+        Gui::SoFCSelectionRoot::initClass();
+        PartGui::SoBrepFaceSet::initClass();
+        MeshGui::SoFCIndexedFaceSet::initClass();
+    }
+
+private Q_SLOTS:
+
+    void initTestCase()
+    {
+        coords = new SoCoordinate3;
+        coords->ref();
+        makeGrid(coords, 0.0F);
+
+        plain = new SoIndexedFaceSet;
+        plain->ref();
+        brep = new PartGui::SoBrepFaceSet;
+        brep->ref();
+        mesh = new MeshGui::SoFCIndexedFaceSet;
+        mesh->ref();
+        makeFaces(plain->coordIndex);
+        makeFaces(brep->coordIndex);
+        makeFaces(mesh->coordIndex);
+
+        // One part for each row of cells
+        brep->partIndex.setNum(Size);
+        for (int j = 0; j < Size; ++j) {
+            brep->partIndex.set1Value(j, rowTriangles(j));
+        }
+    }
+
+    void cleanupTestCase()
+    {
+        coords->unref();
+        plain->unref();
+        brep->unref();
+        mesh->unref();
+    }
+
+    void test_BrepFaceSetSameResultAsCoin()  // NOLINT
+    {
+        for (int i = 0; i < 50; ++i) {
+            SbVec3f start = rayStart(i);
+            auto plainAction = pick(plain, start);
+            auto action = pick(brep, start);
+            SoPickedPoint* expected = plainAction->getPickedPoint();
+            SoPickedPoint* actual = action->getPickedPoint();
+            QCOMPARE(actual != nullptr, expected != nullptr);
+            if (!expected) {
+                continue;
+            }
+            QVERIFY(expected->getPoint().equals(actual->getPoint(), 1e-4F));
+            auto expectedFace = static_cast<const SoFaceDetail*>(expected->getDetail());
+            auto actualFace = static_cast<const SoFaceDetail*>(actual->getDetail(brep));
+            QVERIFY(actualFace);
+            QCOMPARE(actualFace->getFaceIndex(), expectedFace->getFaceIndex());
+            QCOMPARE(actualFace->getPartIndex(), int(std::floor(start[1])));
+        }
+    }
+
+    void test_MeshFaceSetSameResultAsCoin()  // NOLINT
+    {
+        for (int i = 0; i < 50; ++i) {
+            SbVec3f start = rayStart(i);
+            auto plainAction = pick(plain, start);
+            auto action = pick(mesh, start);
+            SoPickedPoint* expected = plainAction->getPickedPoint();
+            SoPickedPoint* actual = action->getPickedPoint();
+            QCOMPARE(actual != nullptr, expected != nullptr);
+            if (!expected) {
+                continue;
+            }
+            QVERIFY(expected->getPoint().equals(actual->getPoint(), 1e-4F));
+            auto expectedFace = static_cast<const SoFaceDetail*>(expected->getDetail());
+            auto actualFace = static_cast<const SoFaceDetail*>(actual->getDetail(mesh));
+            QVERIFY(actualFace);
+            QCOMPARE(actualFace->getFaceIndex(), expectedFace->getFaceIndex());
+        }
+    }
+
+    void test_PickHole()  // NOLINT
+    {
+        const SbVec3f hole(Size / 2.0F + 0.3F, Size / 2.0F + 0.1F, 10);
+        QVERIFY(!pick(plain, hole)->getPickedPoint());
+        QVERIFY(!pick(brep, hole)->getPickedPoint());
+        QVERIFY(!pick(mesh, hole)->getPickedPoint());
+    }
+
+    void test_PickByBoundingBox()  // NOLINT
+    {
+        // The hole is inside the bounding box, so it is hit when picking by bounding box
+        const SbVec3f hole(Size / 2.0F + 0.3F, Size / 2.0F + 0.1F, 10);
+        QVERIFY(pick(plain, hole, SoPickStyle::BOUNDING_BOX)->getPickedPoint());
+        QVERIFY(pick(brep, hole, SoPickStyle::BOUNDING_BOX)->getPickedPoint());
+        QVERIFY(pick(mesh, hole, SoPickStyle::BOUNDING_BOX)->getPickedPoint());
+    }
+
+    void test_SelectionRootPickedThroughEachPath()  // NOLINT
+    {
+        // The same selection root is reached through two paths, each one with its own
+        // coordinates, so that its bounding box depends on the path.
+        auto selRoot = new Gui::SoFCSelectionRoot;
+        selRoot->addChild(brep);
+        auto moved = new SoCoordinate3;
+        makeGrid(moved, Offset);
+
+        auto root = new SoSeparator;
+        root->ref();
+        auto first = new SoSeparator;
+        first->addChild(coords);
+        first->addChild(selRoot);
+        auto second = new SoSeparator;
+        second->addChild(moved);
+        second->addChild(selRoot);
+        root->addChild(first);
+        root->addChild(second);
+
+        for (int i = 0; i < 2; ++i) {
+            SoRayPickAction rp(SbViewportRegion(100, 100));
+            rp.setRay(SbVec3f(5.5F, 5.5F, 10), SbVec3f(0, 0, -1));
+            rp.apply(root);
+            QVERIFY(rp.getPickedPoint());
+            QVERIFY(rp.getPickedPoint()->getPoint()[0] < Offset);
+
+            rp.setRay(SbVec3f(Offset + 5.5F, 5.5F, 10), SbVec3f(0, 0, -1));
+            rp.apply(root);
+            QVERIFY(rp.getPickedPoint());
+            QVERIFY(rp.getPickedPoint()->getPoint()[0] > Offset);
+        }
+        root->unref();
+    }
+
+private:
+    std::unique_ptr<SoRayPickAction>
+    pick(SoNode* faces, const SbVec3f& start, SoPickStyle::Style style = SoPickStyle::SHAPE)
+    {
+        auto root = new SoSeparator;
+        root->ref();
+        auto pickStyle = new SoPickStyle;
+        pickStyle->style = style;
+        root->addChild(pickStyle);
+        root->addChild(coords);
+        root->addChild(faces);
+
+        auto action = std::make_unique<SoRayPickAction>(SbViewportRegion(100, 100));
+        action->setRay(start, SbVec3f(0, 0, -1));
+        action->apply(root);
+        root->unref();
+        return action;
+    }
+
+    static SbVec3f rayStart(int i)
+    {
+        float x = float(Size) * float((i * 37) % 100) / 100.0F + 0.3F;
+        float y = float(Size) * float((i * 61) % 100) / 100.0F + 0.1F;
+        return {x, y, 10};
+    }
+
+    static bool isHole(int i, int j)
+    {
+        return i >= HoleBegin && i < HoleEnd && j >= HoleBegin && j < HoleEnd;
+    }
+
+    static int rowTriangles(int j)
+    {
+        return j >= HoleBegin && j < HoleEnd ? 2 * (Size - (HoleEnd - HoleBegin)) : 2 * Size;
+    }
+
+    // The points of a grid of size x size cells
+    static void makeGrid(SoCoordinate3* points, float offset)
+    {
+        points->point.setNum((Size + 1) * (Size + 1));
+        SbVec3f* values = points->point.startEditing();
+        for (int j = 0; j <= Size; ++j) {
+            for (int i = 0; i <= Size; ++i) {
+                float z = std::sin(float(i) * 0.1F) * std::cos(float(j) * 0.1F);
+                values[j * (Size + 1) + i].setValue(float(i) + offset, float(j), z);
+            }
+        }
+        points->point.finishEditing();
+    }
+
+    // Two triangles for each cell of the grid that isn't part of the hole
+    static void makeFaces(SoMFInt32& indices)
+    {
+        indices.setNum(0);
+        int n = 0;
+        for (int j = 0; j < Size; ++j) {
+            for (int i = 0; i < Size; ++i) {
+                if (isHole(i, j)) {
+                    continue;
+                }
+                int32_t v = j * (Size + 1) + i;
+                const int32_t cell[] =
+                    {v, v + 1, v + Size + 2, -1, v, v + Size + 2, v + Size + 1, -1};
+                indices.setValues(n, 8, cell);
+                n += 8;
+            }
+        }
+    }
+
+    static constexpr int Size = 100;
+    static constexpr int HoleBegin = 40;
+    static constexpr int HoleEnd = 60;
+    static constexpr float Offset = 1000.0F;
+    SoCoordinate3* coords {};
+    SoIndexedFaceSet* plain {};
+    PartGui::SoBrepFaceSet* brep {};
+    MeshGui::SoFCIndexedFaceSet* mesh {};
+};
+
+// NOLINTEND(readability-magic-numbers,cppcoreguidelines-*)
+
+QTEST_GUILESS_MAIN(testFaceSetPick)
+
+#include "FaceSetPick.moc"
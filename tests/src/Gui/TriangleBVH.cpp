@@ -0,0 +1,208 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <cmath>
+#include <memory>
+#include <QTest>
+
+#include <Inventor/SbViewportRegion.h>
+#include <Inventor/SoDB.h>
+#include <Inventor/SoPickedPoint.h>
+#include <Inventor/actions/SoRayPickAction.h>
+#include <Inventor/details/SoFaceDetail.h>
+#include <Inventor/nodes/SoCallback.h>
+#include <Inventor/nodes/SoCoordinate3.h>
+#include <Inventor/nodes/SoIndexedFaceSet.h>
+#include <Inventor/nodes/SoSeparator.h>
+
+#include "Gui/Inventor/TriangleBVH.h"
+
+// NOLINTBEGIN(readability-magic-numbers,cppcoreguidelines-*)
+
+// Picks a wavy grid of triangles once through Coin's SoIndexedFaceSet and once through
+// Gui::TriangleBVH. Needs no OpenGL context, so it runs headless.
+class testTriangleBVH: public QObject
+{
+    Q_OBJECT
+
+public:
+    testTriangleBVH()
+    {
+        SoDB::init();
+    }
+
+private Q_SLOTS:
+
+    void initTestCase()
+    {
+        coords = new SoCoordinate3;
+        faces = new SoIndexedFaceSet;
+        makeGrid(Size);
+
+        plainRoot = new SoSeparator;
+        plainRoot->ref();
+        plainRoot->addChild(coords);
+        plainRoot->addChild(faces);
+
+        bvh = std::make_unique<Gui::TriangleBVH>(&faces->coordIndex);
+        bvhNode = new SoCallback;
+        bvhNode->setCallback(pickCallback, this);
+        bvhRoot = new SoSeparator;
+        bvhRoot->ref();
+        bvhRoot->addChild(coords);
+        bvhRoot->addChild(bvhNode);
+    }
+
+    void cleanupTestCase()
+    {
+        bvh.reset();
+        plainRoot->unref();
+        bvhRoot->unref();
+    }
+
+    void test_SameResultAsCoin()  // NOLINT
+    {
+        for (int i = 0; i < 50; ++i) {
+            float x = float(Size) * float((i * 37) % 100) / 100.0F + 0.3F;
+            float y = float(Size) * float((i * 61) % 100) / 100.0F + 0.1F;
+            SoRayPickAction plain(SbViewportRegion(100, 100));
+            plain.setRay(SbVec3f(x, y, 10), SbVec3f(0, 0, -1));
+            plain.apply(plainRoot);
+            SoRayPickAction fast(SbViewportRegion(100, 100));
+            fast.setRay(SbVec3f(x, y, 10), SbVec3f(0, 0, -1));
+            fast.apply(bvhRoot);
+
+            SoPickedPoint* expected = plain.getPickedPoint();
+            SoPickedPoint* actual = fast.getPickedPoint();
+            QVERIFY(expected);
+            QVERIFY(actual);
+            QVERIFY(expected->getPoint().equals(actual->getPoint(), 1e-4F));
+            auto expectedFace = static_cast<const SoFaceDetail*>(expected->getDetail());
+            auto actualFace = static_cast<const SoFaceDetail*>(actual->getDetail(bvhNode));
+            QVERIFY(actualFace);
+            QCOMPARE(actualFace->getFaceIndex(), expectedFace->getFaceIndex());
+        }
+    }
+
+    void test_Miss()  // NOLINT
+    {
+        SoRayPickAction fast(SbViewportRegion(100, 100));
+        fast.setRay(SbVec3f(-5, -5, 10), SbVec3f(0, 0, -1));
+        fast.apply(bvhRoot);
+        QVERIFY(!fast.getPickedPoint());
+    }
+
+    void test_IndexChangeInvalidates()  // NOLINT
+    {
+        QVERIFY(pick(bvhRoot, SbVec3f(5.5F, 5.5F, 10)));
+
+        // Keep only the first row of cells while the coordinates stay the same
+        const int32_t* values = faces->coordIndex.getValues(0);
+        std::vector<int32_t> all(values, values + faces->coordIndex.getNum());
+        faces->coordIndex.setNum(Size * 8);
+        QVERIFY(!pick(bvhRoot, SbVec3f(5.5F, 5.5F, 10)));
+        QVERIFY(pick(bvhRoot, SbVec3f(5.5F, 0.5F, 10)));
+
+        faces->coordIndex.setValues(0, int(all.size()), all.data());
+        QVERIFY(pick(bvhRoot, SbVec3f(5.5F, 5.5F, 10)));
+    }
+
+    void test_PolygonsAreNotHandled()  // NOLINT
+    {
+        SoMFInt32 quads;
+        quads.setNum(5 * Gui::TriangleBVH::MinTriangles);
+        for (int i = 0; i < quads.getNum(); i += 5) {
+            quads.set1Value(i, 0);
+            quads.set1Value(i + 1, 1);
+            quads.set1Value(i + 2, Size + 2);
+            quads.set1Value(i + 3, Size + 1);
+            quads.set1Value(i + 4, -1);
+        }
+        Gui::TriangleBVH tree(&quads);
+        QVERIFY(!tree.update(coords->getNodeId(),
+                             coords->point.getValues(0),
+                             coords->point.getNum()));
+    }
+
+    void benchmarkCoinPick()  // NOLINT
+    {
+        QBENCHMARK {
+            pick(plainRoot, SbVec3f(Size / 2.0F + 0.3F, Size / 3.0F + 0.1F, 10));
+        }
+    }
+
+    void benchmarkBVHPick()  // NOLINT
+    {
+        QBENCHMARK {
+            pick(bvhRoot, SbVec3f(Size / 2.0F + 0.3F, Size / 3.0F + 0.1F, 10));
+        }
+    }
+
+private:
+    static bool pick(SoNode* root, const SbVec3f& start)
+    {
+        SoRayPickAction rp(SbViewportRegion(100, 100));
+        rp.setRay(start, SbVec3f(0, 0, -1));
+        rp.apply(root);
+        return rp.getPickedPoint() != nullptr;
+    }
+
+    static void pickCallback(void* data, SoAction* action)
+    {
+        if (!action->isOfType(SoRayPickAction::getClassTypeId())) {
+            return;
+        }
+        auto self = static_cast<testTriangleBVH*>(data);
+        auto pickAction = static_cast<SoRayPickAction*>(action);
+        const SbVec3f* points = self->coords->point.getValues(0);
+        if (self->bvh->update(self->coords->getNodeId(), points, self->coords->point.getNum())) {
+            pickAction->setObjectSpace();
+            self->bvh->rayPick(pickAction, self->bvhNode, points);
+        }
+    }
+
+    // A grid of size x size cells of two triangles each
+    void makeGrid(int size)
+    {
+        coords->point.setNum((size + 1) * (size + 1));
+        SbVec3f* points = coords->point.startEditing();
+        for (int j = 0; j <= size; ++j) {
+            for (int i = 0; i <= size; ++i) {
+                float z = std::sin(float(i) * 0.1F) * std::cos(float(j) * 0.1F);
+                points[j * (size + 1) + i].setValue(float(i), float(j), z);
+            }
+        }
+        coords->point.finishEditing();
+
+        faces->coordIndex.setNum(size * size * 8);
+        int32_t* indices = faces->coordIndex.startEditing();
+        for (int j = 0; j < size; ++j) {
+            for (int i = 0; i < size; ++i) {
+                int32_t v = j * (size + 1) + i;
+                int32_t* cell = indices + (j * size + i) * 8;
+                cell[0] = v;
+                cell[1] = v + 1;
+                cell[2] = v + size + 2;
+                cell[3] = -1;
+                cell[4] = v;
+                cell[5] = v + size + 2;
+                cell[6] = v + size + 1;
+                cell[7] = -1;
+            }
+        }
+        faces->coordIndex.finishEditing();
+    }
+
+    static constexpr int Size = 500;
+    SoCoordinate3* coords {};
+    SoIndexedFaceSet* faces {};
+    SoCallback* bvhNode {};
+    SoSeparator* plainRoot {};
+    SoSeparator* bvhRoot {};
+    std::unique_ptr<Gui::TriangleBVH> bvh;
+};
+
+// NOLINTEND(readability-magic-numbers,cppcoreguidelines-*)
+
+QTEST_GUILESS_MAIN(testTriangleBVH)
+
+#include "TriangleBVH.moc"
@@ -0,0 +1,90 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+
+#include <Mod/Assembly/App/InterferenceChecker.h>
+
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <BRepPrimAPI_MakeCylinder.hxx>
+
+namespace
+{
+
+Base::Placement at(double x, double y, double z)
+{
+    return Base::Placement(Base::Vector3d(x, y, z), Base::Rotation());
+}
+
+}  // namespace
+
+class InterferenceCheckerTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        Part::TopoShape box(BRepPrimAPI_MakeBox(10.0, 10.0, 10.0).Shape());
+        _checker.addPart(box);
+        _checker.addPart(box);
+    }
+
+    Assembly::InterferenceChecker _checker;
+};
+
+TEST_F(InterferenceCheckerTest, overlappingParts)  // NOLINT
+{
+    // Act
+    auto result = _checker.findInterferences({at(0, 0, 0), at(5, 5, 5)});
+
+    // Assert
+    ASSERT_EQ(result.size(), 1);
+    EXPECT_EQ(result[0], std::make_pair(0, 1));
+}
+
+TEST_F(InterferenceCheckerTest, overlappingAlignedParts)  // NOLINT
+{
+    // Act
+    auto result = _checker.findInterferences({at(0, 0, 0), at(9, 0, 0)}, true);
+
+    // Assert
+    EXPECT_EQ(result.size(), 1);
+}
+
+TEST_F(InterferenceCheckerTest, coincidentParts)  // NOLINT
+{
+    // Act
+    auto result = _checker.findInterferences({at(0, 0, 0), at(0, 0, 0)}, true);
+
+    // Assert
+    EXPECT_EQ(result.size(), 1);
+}
+
+TEST_F(InterferenceCheckerTest, touchingParts)  // NOLINT
+{
+    // Act
+    auto result = _checker.findInterferences({at(0, 0, 0), at(10, 0, 0)});
+
+    // Assert
+    EXPECT_TRUE(result.empty());
+}
+
+TEST_F(InterferenceCheckerTest, separatedParts)  // NOLINT
+{
+    // Act
+    auto result = _checker.findInterferences({at(0, 0, 0), at(10.5, 2, 2)});
+
+    // Assert
+    EXPECT_TRUE(result.empty());
+}
+
+TEST_F(InterferenceCheckerTest, partInsideOther)  // NOLINT
+{
+    // Arrange
+    _checker.addPart(Part::TopoShape(BRepPrimAPI_MakeCylinder(1.0, 2.0).Shape()));
+
+    // Act
+    auto result = _checker.findInterferences({at(0, 0, 0), at(20, 0, 0), at(5, 5, 5)}, true);
+
+    // Assert
+    ASSERT_EQ(result.size(), 1);
+    EXPECT_EQ(result[0], std::make_pair(0, 2));
+}
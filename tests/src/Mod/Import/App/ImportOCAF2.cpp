@@ -0,0 +1,271 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <FCConfig.h>
+
+#include <gtest/gtest.h>
+#include <src/App/InitApplication.h>
+
+#include <App/Application.h>
+#include <App/Document.h>
+#include <Base/Interpreter.h>
+#include <Mod/Import/App/ImportOCAF2.h>
+#include <Mod/Part/App/PartFeature.h>
+#include <Mod/Part/App/TopoShape.h>
+
+#include <BRep_Builder.hxx>
+#include <BRepBuilderAPI_Transform.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <BRepPrimAPI_MakeCylinder.hxx>
+#include <gp.hxx>
+#include <gp_Ax1.hxx>
+#include <gp_Ax2.hxx>
+#include <gp_Trsf.hxx>
+#include <Quantity_Color.hxx>
+#include <TDocStd_Document.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopLoc_Location.hxx>
+#include <TopoDS_Compound.hxx>
+#include <XCAFApp_Application.hxx>
+#include <XCAFDoc_ColorTool.hxx>
+#include <XCAFDoc_DocumentTool.hxx>
+#include <XCAFDoc_ShapeTool.hxx>
+
+// NOLINTBEGIN(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
+
+namespace
+{
+// Three arms of different lengths along the axes, it has no plane of symmetry.
+TopoDS_Shape makeTripod()
+{
+    BRep_Builder builder;
+    TopoDS_Compound compound;
+    builder.MakeCompound(compound);
+    builder.Add(compound, BRepPrimAPI_MakeBox(gp_Pnt(1.0, 0.0, 0.0), 10.0, 1.0, 1.0).Shape());
+    builder.Add(compound, BRepPrimAPI_MakeBox(gp_Pnt(0.0, 1.0, 0.0), 1.0, 5.0, 1.0).Shape());
+    builder.Add(compound, BRepPrimAPI_MakeBox(gp_Pnt(0.0, 0.0, 1.0), 1.0, 1.0, 2.0).Shape());
+    return compound;
+}
+
+TopoDS_Shape transformed(const TopoDS_Shape& shape, const gp_Trsf& trsf)
+{
+    // A copy, as the geometry of identical shapes written separately in a file.
+    return BRepBuilderAPI_Transform(shape, trsf, Standard_True).Shape();
+}
+
+Base::Placement toPlacement(const gp_Trsf& trsf)
+{
+    return Base::Placement(Part::TopoShape::convert(trsf));
+}
+}  // namespace
+
+class ImportOCAF2Test: public ::testing::Test
+{
+protected:
+    struct ImportedShape
+    {
+        TopoDS_Shape shape;
+        std::vector<App::Color> colors;
+    };
+
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+
+    void SetUp() override
+    {
+        Base::Interpreter().runString("import Part");
+        Handle(XCAFApp_Application) app = XCAFApp_Application::GetApplication();
+        app->NewDocument(TCollection_ExtendedString("MDTV-CAF"), _hDoc);
+
+        // An assembly of two instances of a box with a colored face and of a colored cylinder.
+        Handle(XCAFDoc_ShapeTool) shapeTool = XCAFDoc_DocumentTool::ShapeTool(_hDoc->Main());
+        Handle(XCAFDoc_ColorTool) colorTool = XCAFDoc_DocumentTool::ColorTool(_hDoc->Main());
+
+        TopoDS_Shape box = BRepPrimAPI_MakeBox(10.0, 20.0, 30.0).Shape();
+        TDF_Label boxLabel = shapeTool->AddShape(box, Standard_False);
+        colorTool->SetColor(boxLabel, Quantity_Color(1.0, 0.0, 0.0, Quantity_TOC_RGB),
+                            XCAFDoc_ColorSurf);
+        TopExp_Explorer xp(box, TopAbs_FACE);
+        xp.Next();
+        TDF_Label faceLabel = shapeTool->AddSubShape(boxLabel, xp.Current());
+        colorTool->SetColor(faceLabel, Quantity_Color(0.0, 1.0, 0.0, Quantity_TOC_RGB),
+                            XCAFDoc_ColorSurf);
+
+        TopoDS_Shape cylinder = BRepPrimAPI_MakeCylinder(5.0, 10.0).Shape();
+        TDF_Label cylinderLabel = shapeTool->AddShape(cylinder, Standard_False);
+        colorTool->SetColor(cylinderLabel, Quantity_Color(0.0, 0.0, 1.0, Quantity_TOC_RGB),
+                            XCAFDoc_ColorSurf);
+
+        TDF_Label assembly = shapeTool->NewShape();
+        gp_Trsf move;
+        shapeTool->AddComponent(assembly, boxLabel, TopLoc_Location(move));
+        move.SetTranslation(gp_Vec(50.0, 0.0, 0.0));
+        shapeTool->AddComponent(assembly, boxLabel, TopLoc_Location(move));
+        move.SetTranslation(gp_Vec(0.0, 50.0, 0.0));
+        shapeTool->AddComponent(assembly, cylinderLabel, TopLoc_Location(move));
+        shapeTool->UpdateAssemblies();
+    }
+
+    void TearDown() override
+    {
+        for (auto& name : _docNames) {
+            App::GetApplication().closeDocument(name.c_str());
+        }
+        XCAFApp_Application::GetApplication()->Close(_hDoc);
+    }
+
+    std::vector<ImportedShape> importShapes(bool parallel)
+    {
+        _docNames.push_back(App::GetApplication().getUniqueDocumentName("test"));
+        App::Document* doc =
+            App::GetApplication().newDocument(_docNames.back().c_str(), "testUser");
+
+        Import::ImportOCAFExt ocaf(_hDoc, doc, "test");
+        ocaf.setUseLinkGroup(true);
+        ocaf.setParallel(parallel);
+        ocaf.loadShapes();
+
+        std::vector<ImportedShape> result;
+        for (auto* obj : doc->getObjectsOfType(Part::Feature::getClassTypeId())) {
+            auto* feature = static_cast<Part::Feature*>(obj);
+            result.push_back({feature->Shape.getShape().getShape(), ocaf.partColors[feature]});
+        }
+        return result;
+    }
+
+private:
+    Handle(TDocStd_Document) _hDoc;
+    std::vector<std::string> _docNames;
+};
+
+TEST_F(ImportOCAF2Test, parallelMatchesSerialImport)
+{
+    // Act
+    auto serial = importShapes(false);
+    auto parallel = importShapes(true);
+
+    // Assert
+    ASSERT_FALSE(serial.empty());
+    ASSERT_EQ(parallel.size(), serial.size());
+    bool hasFaceColors = false;
+    for (size_t i = 0; i < serial.size(); ++i) {
+        EXPECT_TRUE(parallel[i].shape.IsPartner(serial[i].shape));
+        EXPECT_EQ(parallel[i].colors, serial[i].colors);
+        hasFaceColors = hasFaceColors || serial[i].colors.size() == 6;
+    }
+    EXPECT_TRUE(hasFaceColors);
+}
+
+TEST(ImportOCAF2, fingerprintOfMovedCopies)
+{
+    // Arrange
+    TopoDS_Shape box = BRepPrimAPI_MakeBox(10.0, 20.0, 30.0).Shape();
+    gp_Trsf trsf;
+    trsf.SetRotation(gp_Ax1(gp_Pnt(), gp_Dir(1.0, 1.0, 0.0)), 0.7);
+    trsf.SetTranslationPart(gp_Vec(5.0, -3.0, 8.0));
+
+    // Act
+    auto fingerprint = Import::ImportOCAF2::computeFingerprint(box);
+    auto moved = Import::ImportOCAF2::computeFingerprint(transformed(box, trsf));
+    auto cylinder = Import::ImportOCAF2::computeFingerprint(
+        BRepPrimAPI_MakeCylinder(10.0, 30.0).Shape());
+
+    // Assert
+    EXPECT_FALSE(fingerprint.key.empty());
+    EXPECT_EQ(fingerprint.key, moved.key);
+    EXPECT_NE(fingerprint.key, cylinder.key);
+    // The vertices and the middle of the edges and faces
+    EXPECT_EQ(fingerprint.points.size(), size_t(8 + 12 + 6));
+    EXPECT_TRUE(Import::ImportOCAF2::computeFingerprint(TopoDS_Shape()).key.empty());
+}
+
+TEST(ImportOCAF2, findOffsetOfMovedCopy)
+{
+    // Arrange
+    TopoDS_Shape tripod = makeTripod();
+    gp_Trsf trsf;
+    trsf.SetRotation(gp_Ax1(gp_Pnt(1.0, 2.0, 3.0), gp_Dir(0.3, -0.5, 1.0)), 1.2);
+    trsf.SetTranslationPart(gp_Vec(40.0, 10.0, -20.0));
+    auto fingerprint = Import::ImportOCAF2::computeFingerprint(tripod);
+    auto moved = Import::ImportOCAF2::computeFingerprint(transformed(tripod, trsf));
+    Base::Placement offset;
+
+    // Act
+    bool found = Import::ImportOCAF2::findOffset(fingerprint, moved, offset);
+
+    // Assert
+    ASSERT_TRUE(found);
+    EXPECT_TRUE(offset.isSame(toPlacement(trsf), 1e-6));
+}
+
+TEST(ImportOCAF2, findOffsetWithPermutedAxes)
+{
+    // Arrange: turning the box swaps its principal axes of inertia
+    TopoDS_Shape box = BRepPrimAPI_MakeBox(10.0, 20.0, 30.0).Shape();
+    auto fingerprint = Import::ImportOCAF2::computeFingerprint(box);
+    for (const auto& axis : {gp::DZ(), gp::DX(), gp::DY()}) {
+        gp_Trsf trsf;
+        trsf.SetRotation(gp_Ax1(gp_Pnt(), axis), M_PI / 2.0);
+        auto turned = Import::ImportOCAF2::computeFingerprint(transformed(box, trsf));
+        Base::Placement offset;
+
+        // Act
+        bool found = Import::ImportOCAF2::findOffset(fingerprint, turned, offset);
+
+        // Assert
+        ASSERT_TRUE(found);
+        EXPECT_EQ(fingerprint.key, turned.key);
+        // The box has symmetries, any offset moving it onto the other one will do.
+        auto check = Import::ImportOCAF2::computeFingerprint(
+            transformed(box, Part::TopoShape::convert(offset.toMatrix())));
+        Base::Placement identity;
+        EXPECT_TRUE(Import::ImportOCAF2::findOffset(check, turned, identity));
+        EXPECT_TRUE(identity.isSame(Base::Placement(), 1e-6));
+    }
+}
+
+TEST(ImportOCAF2, findOffsetRejectsMirror)
+{
+    // Arrange
+    TopoDS_Shape tripod = makeTripod();
+    gp_Trsf trsf;
+    trsf.SetMirror(gp_Ax2(gp_Pnt(0.0, 0.0, 0.0), gp_Dir(1.0, 0.0, 0.0)));
+    auto fingerprint = Import::ImportOCAF2::computeFingerprint(tripod);
+    auto mirrored = Import::ImportOCAF2::computeFingerprint(transformed(tripod, trsf));
+    Base::Placement offset;
+
+    // Act
+    bool found = Import::ImportOCAF2::findOffset(fingerprint, mirrored, offset);
+
+    // Assert
+    EXPECT_EQ(fingerprint.key, mirrored.key);
+    EXPECT_FALSE(found);
+}
+
+TEST(ImportOCAF2, findOffsetComparesEdgeGeometry)
+{
+    // Arrange: the two halves of a cylinder have the same vertices but not the same arcs.
+    TopoDS_Shape half =
+        BRepPrimAPI_MakeCylinder(gp_Ax2(gp_Pnt(), gp::DZ()), 5.0, 10.0, M_PI).Shape();
+    gp_Trsf mirror;
+    mirror.SetMirror(gp_Ax2(gp_Pnt(), gp::DY()));
+    TopoDS_Shape otherHalf = transformed(half, mirror);
+    auto fingerprint = Import::ImportOCAF2::computeFingerprint(half);
+    auto other = Import::ImportOCAF2::computeFingerprint(otherHalf);
+    Base::Placement offset;
+
+    // Act
+    bool found = Import::ImportOCAF2::findOffset(fingerprint, other, offset);
+
+    // Assert: the halves are turned onto each other, not left in place.
+    ASSERT_TRUE(found);
+    EXPECT_FALSE(offset.isSame(Base::Placement(), 1e-6));
+    auto check = Import::ImportOCAF2::computeFingerprint(
+        transformed(half, Part::TopoShape::convert(offset.toMatrix())));
+    Base::Placement identity;
+    EXPECT_TRUE(Import::ImportOCAF2::findOffset(check, other, identity));
+    EXPECT_TRUE(identity.isSame(Base::Placement(), 1e-6));
+}
+
+// NOLINTEND(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
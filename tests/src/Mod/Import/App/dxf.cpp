@@ -0,0 +1,166 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include <src/App/InitApplication.h>
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <Base/FileInfo.h>
+#include <Mod/Import/App/dxf/dxf.h>
+
+// NOLINTBEGIN(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
+
+namespace
+{
+// The size of the blocks the file is read in.
+constexpr std::size_t BlockSize = 1 << 20;
+
+class LineReader: public CDxfRead
+{
+public:
+    using CDxfRead::CDxfRead;
+
+    void
+    OnReadLine(const Base::Vector3d& start, const Base::Vector3d& end, bool /*hidden*/) override
+    {
+        lines.emplace_back(start, end);
+    }
+
+    std::vector<std::pair<Base::Vector3d, Base::Vector3d>> lines;
+};
+
+std::string lineEntity(double x1, double y1, double x2, double y2, const char* eol = "\n")
+{
+    std::string text;
+    for (const auto& [code, value] : std::vector<std::pair<const char*, std::string>> {
+             {"0", "LINE"},
+             {"8", "0"},
+             {"10", std::to_string(x1)},
+             {"20", std::to_string(y1)},
+             {"30", "0.0"},
+             {"11", std::to_string(x2)},
+             {"21", std::to_string(y2)},
+             {"31", "0.0"}}) {
+        text += std::string(code) + eol + value + eol;
+    }
+    return text;
+}
+}  // namespace
+
+class DxfReadTest: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+
+    void SetUp() override
+    {
+        _fileInfo.setFile(Base::FileInfo::getTempFileName() + ".dxf");
+    }
+
+    void TearDown() override
+    {
+        _fileInfo.deleteFile();
+    }
+
+    std::vector<std::pair<Base::Vector3d, Base::Vector3d>> read(const std::string& content)
+    {
+        {
+            std::ofstream file(_fileInfo.filePath(), std::ios::binary);
+            file.write(content.data(), std::streamsize(content.size()));
+        }
+        LineReader reader(_fileInfo.filePath());
+        EXPECT_FALSE(reader.Failed());
+        reader.DoRead();
+        return reader.lines;
+    }
+
+    static std::string entities(const std::string& body, const char* eol = "\n")
+    {
+        std::string eolText(eol);
+        return "0" + eolText + "SECTION" + eolText + "2" + eolText + "ENTITIES" + eolText + body
+            + "0" + eolText + "ENDSEC" + eolText + "0" + eolText + "EOF" + eolText;
+    }
+
+private:
+    Base::FileInfo _fileInfo;
+};
+
+TEST_F(DxfReadTest, readLines)
+{
+    // Act
+    auto lines = read(entities(lineEntity(1.0, 2.0, 3.0, 4.0) + lineEntity(5.0, 6.0, 7.0, 8.0)));
+
+    // Assert
+    ASSERT_EQ(lines.size(), 2);
+    EXPECT_EQ(lines[0].first, Base::Vector3d(1.0, 2.0, 0.0));
+    EXPECT_EQ(lines[0].second, Base::Vector3d(3.0, 4.0, 0.0));
+    EXPECT_EQ(lines[1].first, Base::Vector3d(5.0, 6.0, 0.0));
+    EXPECT_EQ(lines[1].second, Base::Vector3d(7.0, 8.0, 0.0));
+}
+
+TEST_F(DxfReadTest, readCrLfLines)
+{
+    // Arrange: group codes may also be padded with blanks
+    std::string body = lineEntity(1.0, 2.0, 3.0, 4.0, "\r\n");
+    body.replace(body.find("10\r\n"), 4, "  10 \r\n");
+
+    // Act
+    auto lines = read(entities(body, "\r\n"));
+
+    // Assert
+    ASSERT_EQ(lines.size(), 1);
+    EXPECT_EQ(lines[0].first, Base::Vector3d(1.0, 2.0, 0.0));
+    EXPECT_EQ(lines[0].second, Base::Vector3d(3.0, 4.0, 0.0));
+}
+
+TEST_F(DxfReadTest, readLineAcrossBlocks)
+{
+    // Arrange: a comment fills the first block so that each line of the entity in turn is split
+    // between two blocks.
+    const std::string head = entities("").substr(0, entities("").find("0\nENDSEC")) + "999\n";
+    const std::string entity = lineEntity(12345.5, 2.0, 3.0, 4.0);
+    for (std::size_t shift = 1; shift < entity.size(); shift += 3) {
+        std::string comment(BlockSize - shift - head.size() - 1, 'x');
+
+        // Act
+        auto lines = read(entities("999\n" + comment + "\n" + entity));
+
+        // Assert
+        ASSERT_EQ(lines.size(), 1) << "split at " << shift;
+        EXPECT_EQ(lines[0].first, Base::Vector3d(12345.5, 2.0, 0.0)) << "split at " << shift;
+        EXPECT_EQ(lines[0].second, Base::Vector3d(3.0, 4.0, 0.0)) << "split at " << shift;
+    }
+}
+
+TEST_F(DxfReadTest, readInBinaryMode)
+{
+    // Arrange: in text mode, some platforms stop reading at a Ctrl-Z or drop a lone CR.
+    std::string comment = "999\nend of text\x1a here\n999\nlone\rCR\n";
+
+    // Act
+    auto lines = read(entities(comment + lineEntity(1.0, 2.0, 3.0, 4.0)));
+
+    // Assert
+    ASSERT_EQ(lines.size(), 1);
+    EXPECT_EQ(lines[0].second, Base::Vector3d(3.0, 4.0, 0.0));
+}
+
+TEST_F(DxfReadTest, readLastLineWithoutNewline)
+{
+    // Arrange
+    std::string content = entities(lineEntity(1.0, 2.0, 3.0, 4.0));
+    content.pop_back();
+
+    // Act
+    auto lines = read(content);
+
+    // Assert
+    EXPECT_EQ(lines.size(), 1);
+}
+
+// NOLINTEND(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
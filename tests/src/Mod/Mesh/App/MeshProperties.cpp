@@ -0,0 +1,212 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <src/App/InitApplication.h>
+
+#include <App/Application.h>
+#include <App/Document.h>
+#include <Base/Interpreter.h>
+#include <Mod/Mesh/App/Core/Elements.h>
+#include <Mod/Mesh/App/MeshFeature.h>
+#include <Mod/Mesh/App/MeshPy.h>
+
+class MeshPropertiesTest: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+
+    void SetUp() override
+    {
+        Base::Interpreter().runString("import Mesh");
+        _docName = App::GetApplication().getUniqueDocumentName("test");
+        _doc = App::GetApplication().newDocument(_docName.c_str(), "testUser");
+        _doc->setUndoMode(1);
+        _mesh = _doc->addObject<Mesh::Feature>("Mesh");
+        addFacet(0.0F);
+    }
+
+    void TearDown() override
+    {
+        App::GetApplication().closeDocument(_docName.c_str());
+    }
+
+    void addFacet(float z)
+    {
+        Mesh::MeshObject* mesh = _mesh->Mesh.startEditing();
+        mesh->addFacet(MeshCore::MeshGeomFacet(Base::Vector3f(0.0F, 0.0F, z),
+                                               Base::Vector3f(1.0F, 0.0F, z),
+                                               Base::Vector3f(0.0F, 1.0F, z)));
+        _mesh->Mesh.finishEditing();
+    }
+
+    unsigned long countFacets() const
+    {
+        return _mesh->Mesh.getValue().countFacets();
+    }
+
+    App::Document* _doc {};  // NOLINT Can't be private in a test framework
+    Mesh::Feature* _mesh {};  // NOLINT Can't be private in a test framework
+    std::string _docName;  // NOLINT Can't be private in a test framework
+};
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+TEST_F(MeshPropertiesTest, editInPlaceWhileDisplayed)
+{
+    // Arrange: the view provider keeps a reference to the mesh object
+    Base::Reference<const Mesh::MeshObject> display(_mesh->Mesh.getValuePtr());
+
+    // Act
+    addFacet(1.0F);
+
+    // Assert: without an undo snapshot the mesh isn't copied
+    EXPECT_EQ(_mesh->Mesh.getValuePtr(), static_cast<const Mesh::MeshObject*>(display));
+    EXPECT_EQ(countFacets(), 2);
+}
+
+TEST_F(MeshPropertiesTest, copyDetachesOnEdit)
+{
+    // Arrange
+    std::unique_ptr<App::Property> copy(_mesh->Mesh.Copy());
+    auto snapshot = static_cast<Mesh::PropertyMeshKernel*>(copy.get());
+    EXPECT_EQ(snapshot->getValuePtr(), _mesh->Mesh.getValuePtr());
+
+    // Act
+    addFacet(1.0F);
+
+    // Assert
+    EXPECT_NE(snapshot->getValuePtr(), _mesh->Mesh.getValuePtr());
+    EXPECT_EQ(snapshot->getValue().countFacets(), 1);
+    EXPECT_EQ(countFacets(), 2);
+
+    // Act: the copy is no longer shared and is edited in place
+    const Mesh::MeshObject* current = _mesh->Mesh.getValuePtr();
+    copy.reset();
+    addFacet(2.0F);
+
+    // Assert
+    EXPECT_EQ(_mesh->Mesh.getValuePtr(), current);
+    EXPECT_EQ(countFacets(), 3);
+}
+
+TEST_F(MeshPropertiesTest, holdersFollowEditOfSharedMesh)
+{
+    // Arrange: like a Python facet, the holder references the mesh shared with the snapshots
+    Base::Reference<const Mesh::MeshObject> holder(_mesh->Mesh.getValuePtr());
+    Mesh::MeshObject twoFacets(_mesh->Mesh.getValue());
+    twoFacets.addFacet(MeshCore::MeshGeomFacet(Base::Vector3f(0.0F, 0.0F, 1.0F),
+                                               Base::Vector3f(1.0F, 0.0F, 1.0F),
+                                               Base::Vector3f(0.0F, 1.0F, 1.0F)));
+
+    // Act
+    std::unique_ptr<App::Property> first(_mesh->Mesh.Copy());
+    _mesh->Mesh.setValue(twoFacets);
+    std::unique_ptr<App::Property> second(_mesh->Mesh.Copy());
+    addFacet(2.0F);
+
+    // Assert: the property keeps its mesh object, the snapshots get the old content
+    EXPECT_EQ(_mesh->Mesh.getValuePtr(), static_cast<const Mesh::MeshObject*>(holder));
+    EXPECT_EQ(holder->countFacets(), 3);
+    EXPECT_EQ(static_cast<Mesh::PropertyMeshKernel*>(first.get())->getValue().countFacets(), 1);
+    EXPECT_EQ(static_cast<Mesh::PropertyMeshKernel*>(second.get())->getValue().countFacets(), 2);
+}
+
+TEST_F(MeshPropertiesTest, pasteMovesOnlyPythonWrapper)
+{
+    // Arrange
+    std::unique_ptr<App::Property> copy(_mesh->Mesh.Copy());
+    addFacet(1.0F);
+    Base::Reference<const Mesh::MeshObject> holder(_mesh->Mesh.getValuePtr());
+    Py::Object mesh(_mesh->Mesh.getPyObject(), true);
+
+    // Act: like undo
+    _mesh->Mesh.Paste(*copy);
+
+    // Assert: the holder keeps the mesh it was taken from
+    auto meshPy = static_cast<Mesh::MeshPy*>(mesh.ptr());
+    EXPECT_EQ(meshPy->getMeshObjectPtr(), _mesh->Mesh.getValuePtr());
+    EXPECT_EQ(meshPy->getMeshObjectPtr()->countFacets(), 1);
+    EXPECT_EQ(holder->countFacets(), 2);
+}
+
+TEST_F(MeshPropertiesTest, undoRedo)
+{
+    // Arrange
+    _doc->openTransaction("first");
+    addFacet(1.0F);
+    _doc->commitTransaction();
+    _doc->openTransaction("second");
+    addFacet(2.0F);
+    _doc->commitTransaction();
+
+    // Act & Assert
+    EXPECT_EQ(countFacets(), 3);
+    EXPECT_TRUE(_doc->undo());
+    EXPECT_EQ(countFacets(), 2);
+    EXPECT_TRUE(_doc->undo());
+    EXPECT_EQ(countFacets(), 1);
+    EXPECT_TRUE(_doc->redo());
+    EXPECT_EQ(countFacets(), 2);
+
+    // an edit after undo must not change the snapshots still in the undo stack
+    _doc->openTransaction("third");
+    addFacet(3.0F);
+    _doc->commitTransaction();
+    EXPECT_EQ(countFacets(), 3);
+    EXPECT_TRUE(_doc->undo());
+    EXPECT_EQ(countFacets(), 2);
+    EXPECT_TRUE(_doc->undo());
+    EXPECT_EQ(countFacets(), 1);
+    EXPECT_TRUE(_doc->redo());
+    EXPECT_TRUE(_doc->redo());
+    EXPECT_EQ(countFacets(), 3);
+}
+TEST_F(MeshPropertiesTest, undoMemSize)
+{
+    // Arrange
+    unsigned int first = _mesh->Mesh.getMemSize();
+    _doc->openTransaction("first");
+    addFacet(1.0F);
+    _doc->commitTransaction();
+    unsigned int second = _mesh->Mesh.getMemSize();
+
+    // Act & Assert: the saved mesh is no longer shared with the property
+    EXPECT_EQ(_doc->getUndoMemSize(), first);
+
+    _doc->openTransaction("second");
+    addFacet(2.0F);
+    _doc->commitTransaction();
+    unsigned int third = _mesh->Mesh.getMemSize();
+    EXPECT_EQ(_doc->getUndoMemSize(), first + second);
+
+    // the property takes the saved mesh of the undone transaction, the redo saves the current one
+    EXPECT_TRUE(_doc->undo());
+    EXPECT_EQ(_doc->getUndoMemSize(), first + third);
+}
+
+TEST_F(MeshPropertiesTest, undoMemSizeCountsSharedMeshOnce)
+{
+    // Arrange: two transactions save the same mesh object
+    _doc->openTransaction("first");
+    std::unique_ptr<App::Property> copy(_mesh->Mesh.Copy());
+    _mesh->Mesh.Paste(*copy);
+    _doc->commitTransaction();
+    _doc->openTransaction("second");
+    _mesh->Mesh.Paste(*copy);
+    _doc->commitTransaction();
+
+    // Act & Assert: the mesh is still the one of the property, so it takes no extra memory
+    EXPECT_EQ(_doc->getUndoMemSize(), 0);
+
+    // once the property has its own mesh, the saved one is counted once
+    unsigned int size = _mesh->Mesh.getMemSize();
+    copy.reset();
+    _doc->openTransaction("third");
+    addFacet(1.0F);
+    _doc->commitTransaction();
+    EXPECT_EQ(_doc->getUndoMemSize(), size);
+}
+// NOLINTEND(cppcoreguidelines-*,readability-*)
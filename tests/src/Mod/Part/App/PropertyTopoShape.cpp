@@ -269,3 +269,30 @@ TEST_F(PropertyTopoShapeTest, testRestore)
     EXPECT_TRUE(reader.isValid());
     EXPECT_TRUE(reader.isEndOfElement());
 }
+
+TEST_F(PropertyTopoShapeTest, testUndoMemSizeOfSharedShape)
+{
+    // Arrange
+    _doc->recompute();
+    _doc->setUndoMode(1);
+    auto box = _boxes[0];
+    unsigned int shapeSize = box->Shape.getMemSize();
+    ASSERT_GT(shapeSize, 0);
+
+    // Act: moving the box only changes the location of its shape
+    _doc->openTransaction("move");
+    box->Placement.setValue(Base::Placement(Base::Vector3d(0, 0, 10), Base::Rotation()));
+    _doc->commitTransaction();
+
+    // Assert: the saved shape shares the geometry with the current one
+    EXPECT_LT(_doc->getUndoMemSize(), shapeSize);
+
+    // Act: a new geometry
+    _doc->openTransaction("resize");
+    box->Length.setValue(5);
+    _doc->recompute();
+    _doc->commitTransaction();
+
+    // Assert
+    EXPECT_GE(_doc->getUndoMemSize(), shapeSize);
+}
@@ -0,0 +1,173 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include <sstream>
+#include <vector>
+#include <Mod/Part/App/TessellationCache.h>
+#include <Mod/Part/App/Tools.h>
+#include <Mod/Part/App/TopoShape.h>
+
+#include <BRep_Builder.hxx>
+#include <BRep_Tool.hxx>
+#include <BRepMesh_IncrementalMesh.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <BRepPrimAPI_MakeCylinder.hxx>
+#include <BRepTools.hxx>
+#include <Geom_CylindricalSurface.hxx>
+#include <gp_Trsf.hxx>
+#include <TopExp.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Compound.hxx>
+#include <TopTools_IndexedDataMapOfShapeListOfShape.hxx>
+
+// NOLINTBEGIN(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
+
+namespace
+{
+bool isTriangulated(const TopoDS_Shape& shape)
+{
+    for (TopExp_Explorer xp(shape, TopAbs_FACE); xp.More(); xp.Next()) {
+        TopLoc_Location loc;
+        if (BRep_Tool::Triangulation(TopoDS::Face(xp.Current()), loc).IsNull()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Checks that each edge has the same points in the triangulations of all its faces
+bool hasConnectedTriangulation(const TopoDS_Shape& shape)
+{
+    TopTools_IndexedDataMapOfShapeListOfShape edgeFaces;
+    TopExp::MapShapesAndAncestors(shape, TopAbs_EDGE, TopAbs_FACE, edgeFaces);
+    for (int i = 1; i <= edgeFaces.Extent(); ++i) {
+        const TopoDS_Edge& edge = TopoDS::Edge(edgeFaces.FindKey(i));
+        if (BRep_Tool::Degenerated(edge)) {
+            continue;
+        }
+        std::vector<gp_Pnt> first;
+        for (const auto& face : edgeFaces(i)) {
+            std::vector<gp_Pnt> points;
+            if (!Part::Tools::getPolygonOnTriangulation(edge, TopoDS::Face(face), points)) {
+                return false;
+            }
+            if (first.empty()) {
+                first = points;
+                continue;
+            }
+            if (points.size() != first.size()) {
+                return false;
+            }
+            for (std::size_t j = 0; j < points.size(); ++j) {
+                if (!points[j].IsEqual(first[j], 1e-7)) {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+}  // namespace
+
+TEST(TessellationCache, reuseTriangulation)
+{
+    // Arrange
+    TopoDS_Shape box = BRepPrimAPI_MakeBox(10.0, 20.0, 30.0).Shape();
+    Part::TessellationCache::resetStatistics();
+
+    // Act
+    auto first = Part::TessellationCache::triangulate(box, 0.1, 0.5);
+    auto second = Part::TessellationCache::triangulate(box, 0.1, 0.5);
+    auto coarser = Part::TessellationCache::triangulate(box, 1.0, 0.5);
+    auto stats = Part::TessellationCache::getStatistics();
+
+    // Assert
+    EXPECT_EQ(first, 6U);
+    EXPECT_EQ(second, 0U);
+    EXPECT_EQ(coarser, 0U);
+    EXPECT_EQ(stats.misses, 6U);
+    EXPECT_EQ(stats.hits, 12U);
+    EXPECT_TRUE(isTriangulated(box));
+}
+
+TEST(TessellationCache, refineTriangulation)
+{
+    // Arrange
+    TopoDS_Shape box = BRepPrimAPI_MakeBox(10.0, 20.0, 30.0).Shape();
+    Part::TessellationCache::triangulate(box, 1.0, 0.5);
+
+    // Act
+    auto finer = Part::TessellationCache::triangulate(box, 0.01, 0.5);
+
+    // Assert
+    EXPECT_EQ(finer, 6U);
+}
+
+TEST(TessellationCache, refineOneFaceKeepsEdgesConnected)
+{
+    // Arrange: the side of a finely meshed cylinder is meshed again coarsely on its own
+    TopoDS_Shape cylinder = BRepPrimAPI_MakeCylinder(10.0, 20.0).Shape();
+    Part::TessellationCache::triangulate(cylinder, 0.01, 0.1);
+    TopoDS_Face side;
+    for (TopExp_Explorer xp(cylinder, TopAbs_FACE); xp.More(); xp.Next()) {
+        const TopoDS_Face& face = TopoDS::Face(xp.Current());
+        if (BRep_Tool::Surface(face)->IsKind(STANDARD_TYPE(Geom_CylindricalSurface))) {
+            side = face;
+        }
+    }
+    ASSERT_FALSE(side.IsNull());
+    BRepTools::Clean(side);
+    BRepMesh_IncrementalMesh(side, 1.0, Standard_False, 0.5);
+
+    // Act
+    auto refined = Part::TessellationCache::triangulate(cylinder, 0.01, 0.1);
+
+    // Assert
+    EXPECT_EQ(refined, 1U);
+    EXPECT_TRUE(isTriangulated(cylinder));
+    EXPECT_TRUE(hasConnectedTriangulation(cylinder));
+}
+
+TEST(TessellationCache, sharedFacesAreMeshedOnce)
+{
+    // Arrange
+    TopoDS_Shape box = BRepPrimAPI_MakeBox(10.0, 20.0, 30.0).Shape();
+    gp_Trsf trsf;
+    trsf.SetTranslation(gp_Vec(100.0, 0.0, 0.0));
+    TopoDS_Compound comp;
+    BRep_Builder builder;
+    builder.MakeCompound(comp);
+    builder.Add(comp, box);
+    builder.Add(comp, box.Moved(TopLoc_Location(trsf)));
+
+    // Act
+    auto meshed = Part::TessellationCache::triangulate(comp, 0.1, 0.5);
+
+    // Assert
+    EXPECT_EQ(meshed, 6U);
+    EXPECT_TRUE(isTriangulated(comp));
+}
+
+TEST(TessellationCache, exportBinaryWithTriangles)
+{
+    // Arrange
+    TopoDS_Shape box = BRepPrimAPI_MakeBox(10.0, 20.0, 30.0).Shape();
+    Part::TessellationCache::triangulate(box, 0.1, 0.5);
+    std::stringstream with;
+    std::stringstream without;
+
+    // Act
+    Part::TopoShape(box).exportBinary(with, true);
+    Part::TopoShape(box).exportBinary(without);
+    Part::TopoShape restoredWith;
+    restoredWith.importBinary(with);
+    Part::TopoShape restoredWithout;
+    restoredWithout.importBinary(without);
+
+    // Assert
+    EXPECT_TRUE(isTriangulated(restoredWith.getShape()));
+    EXPECT_FALSE(isTriangulated(restoredWithout.getShape()));
+}
+
+// NOLINTEND(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
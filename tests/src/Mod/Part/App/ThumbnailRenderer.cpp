@@ -0,0 +1,228 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <sstream>
+
+#include <src/App/InitApplication.h>
+#include <App/Document.h>
+#include <App/Link.h>
+#include <App/ProjectFile.h>
+#include <Base/FileInfo.h>
+#include <Base/Stream.h>
+#include <Mod/Part/App/TessellationCache.h>
+#include <Mod/Part/App/ThumbnailRenderer.h>
+
+#include <zipios++/zipfile.h>
+#include <zipios++/zipoutputstream.h>
+
+#include <BRepPrimAPI_MakeBox.hxx>
+
+#include "PartTestHelpers.h"
+
+// NOLINTBEGIN(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
+
+namespace
+{
+const std::string pngSignature("\x89PNG\r\n\x1a\n", 8);
+
+int pngWidth(const std::string& png)
+{
+    // the IHDR chunk directly follows the signature, the width is its first field
+    int width = 0;
+    if (png.size() < 24) {
+        return width;
+    }
+    for (std::size_t i = 16; i < 20; ++i) {
+        width = (width << 8) | static_cast<unsigned char>(png[i]);
+    }
+    return width;
+}
+
+// Adds an entry the way the GUI does when saving, which the console mode can't write itself
+void addEntry(const std::string& fileName, const std::string& entry, const std::string& content)
+{
+    Base::FileInfo tmp(fileName + ".tmp");
+    {
+        Base::ofstream newZip(tmp, std::ios::out | std::ios::binary);
+        zipios::ZipOutputStream outZip(newZip);
+        zipios::ZipFile project(fileName);
+        for (const auto& it : project.entries()) {
+            outZip.putNextEntry(it->getFileName());
+            std::unique_ptr<std::istream> str(project.getInputStream(it->getFileName()));
+            *str >> outZip.rdbuf();
+        }
+        project.close();
+        outZip.putNextEntry(entry);
+        outZip << content;
+        outZip.close();
+    }
+    App::ProjectFile(fileName).replaceProjectFile(tmp.filePath());
+}
+
+int countEntries(const std::string& fileName, const std::string& entry)
+{
+    zipios::ZipFile project(fileName);
+    int count = 0;
+    for (const auto& it : project.entries()) {
+        if (it->getFileName() == entry) {
+            ++count;
+        }
+    }
+    return count;
+}
+}  // namespace
+
+class ThumbnailRendererTest: public ::testing::Test, public PartTestHelpers::PartTestHelperClass
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+
+    void SetUp() override
+    {
+        createTestDoc();
+        _doc->recompute();
+    }
+
+    void TearDown() override
+    {
+        App::GetApplication().closeDocument(_docName.c_str());
+    }
+};
+
+TEST_F(ThumbnailRendererTest, renderDocument)
+{
+    // Arrange
+    Part::ThumbnailRenderer renderer(64);
+    renderer.addDocument(_doc);
+
+    // Act
+    std::string png = renderer.renderPng();
+
+    // Assert
+    EXPECT_FALSE(renderer.isEmpty());
+    ASSERT_GT(png.size(), pngSignature.size() + 12);
+    EXPECT_EQ(png.substr(0, pngSignature.size()), pngSignature);
+    EXPECT_EQ(pngWidth(png), 64);
+}
+
+TEST_F(ThumbnailRendererTest, hiddenObjectsAreSkipped)
+{
+    // Arrange
+    for (auto box : _boxes) {
+        box->Visibility.setValue(false);
+    }
+    Part::ThumbnailRenderer renderer(64);
+
+    // Act
+    renderer.addDocument(_doc);
+
+    // Assert
+    EXPECT_TRUE(renderer.isEmpty());
+    EXPECT_TRUE(renderer.renderPng().empty());
+}
+
+TEST_F(ThumbnailRendererTest, renderInParallel)
+{
+    // Arrange
+    std::vector<Part::ThumbnailRenderer> renderers;
+    for (int size : {64, 128, 256}) {
+        renderers.emplace_back(size);
+        renderers.back().addShape(BRepPrimAPI_MakeBox(size, 20.0, 30.0).Shape());
+    }
+    renderers.emplace_back(64);
+
+    // Act
+    auto images = Part::ThumbnailRenderer::renderPng(renderers);
+
+    // Assert
+    ASSERT_EQ(images.size(), 4U);
+    EXPECT_EQ(pngWidth(images[0]), 64);
+    EXPECT_EQ(pngWidth(images[1]), 128);
+    EXPECT_EQ(pngWidth(images[2]), 256);
+    EXPECT_TRUE(images[3].empty());
+}
+
+TEST_F(ThumbnailRendererTest, sharedShapeIsMeshedOnce)
+{
+    // Arrange
+    TopoDS_Shape box = BRepPrimAPI_MakeBox(10.0, 20.0, 30.0).Shape();
+    std::vector<Part::ThumbnailRenderer> renderers;
+    for (int i = 0; i < 8; ++i) {
+        renderers.emplace_back(64);
+        renderers.back().addShape(box);
+    }
+    Part::TessellationCache::resetStatistics();
+
+    // Act
+    auto images = Part::ThumbnailRenderer::renderPng(renderers);
+
+    // Assert
+    EXPECT_EQ(Part::TessellationCache::getStatistics().misses, 6U);
+    for (const auto& image : images) {
+        EXPECT_EQ(pngWidth(image), 64);
+    }
+}
+
+TEST_F(ThumbnailRendererTest, updateFilesClosesLinkedDocuments)
+{
+    // Arrange: the file links to a box in another file
+    auto& app = App::GetApplication();
+    Base::FileInfo linkedFile(Base::FileInfo::getTempFileName() + ".FCStd");
+    Base::FileInfo file(Base::FileInfo::getTempFileName() + ".FCStd");
+    std::string linkedName = app.getUniqueDocumentName("Linked");
+    auto linked = app.newDocument(linkedName.c_str(), "testUser");
+    auto box = linked->addObject("Part::Box", "Box");
+    linked->recompute();
+    ASSERT_TRUE(linked->saveAs(linkedFile.filePath().c_str()));
+    auto link = static_cast<App::Link*>(_doc->addObject("App::Link", "Link"));
+    link->LinkedObject.setValue(box);
+    _doc->recompute();
+    ASSERT_TRUE(_doc->saveAs(file.filePath().c_str()));
+    app.closeDocument(_docName.c_str());
+    app.closeDocument(linkedName.c_str());
+    std::size_t openDocuments = app.getDocuments().size();
+
+    // Act
+    int count = Part::ThumbnailRenderer::updateFiles({file.filePath()}, 64);
+
+    // Assert
+    EXPECT_EQ(count, 1);
+    EXPECT_EQ(app.getDocuments().size(), openDocuments);
+    file.deleteFile();
+    linkedFile.deleteFile();
+}
+
+TEST_F(ThumbnailRendererTest, updateFilesKeepsOtherEntries)
+{
+    // Arrange
+    Base::FileInfo file(Base::FileInfo::getTempFileName() + ".FCStd");
+    std::string fileName = file.filePath();
+    ASSERT_TRUE(_doc->saveAs(fileName.c_str()));
+    const std::string guiDocument("<Document SchemaVersion=\"1\"/>");
+    addEntry(fileName, "GuiDocument.xml", guiDocument);
+
+    // Act
+    int first = Part::ThumbnailRenderer::updateFiles({fileName}, 64);
+    int second = Part::ThumbnailRenderer::updateFiles({fileName}, 64);
+
+    // Assert
+    EXPECT_EQ(first, 1);
+    EXPECT_EQ(second, 1);
+    App::ProjectFile project(fileName);
+    std::stringstream gui;
+    project.readInputFileDirect("GuiDocument.xml", gui);
+    EXPECT_EQ(gui.str(), guiDocument);
+    std::stringstream png;
+    project.readInputFileDirect("thumbnails/Thumbnail.png", png);
+    EXPECT_EQ(pngWidth(png.str()), 64);
+    EXPECT_EQ(countEntries(fileName, "thumbnails/Thumbnail.png"), 1);
+    EXPECT_TRUE(project.loadDocument());
+    file.deleteFile();
+}
+
+// NOLINTEND(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
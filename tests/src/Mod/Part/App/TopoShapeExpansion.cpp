@@ -9,6 +9,9 @@
 #include "PartTestHelpers.h"
 
 #include <boost/core/ignore_unused.hpp>
+#include <chrono>
+#include <iostream>
+#include <set>
 #include <BRepAdaptor_CompCurve.hxx>
 #include <BRepAdaptor_Surface.hxx>
 #include <BRepBuilderAPI_MakeVertex.hxx>
@@ -2096,6 +2099,72 @@ TEST_F(TopoShapeExpansionTest, makeElementCut)
                                  }));
 }
 
+TEST_F(TopoShapeExpansionTest, makeElementTreeBooleanFuse)
+{
+    // Arrange
+    std::vector<TopoShape> shapes;
+    for (int i = 0; i < 20; i++) {
+        shapes.emplace_back(BRepPrimAPI_MakeBox(gp_Pnt(1.0 * i, 0.0, 0.0), 1.5, 1.0, 1.0).Shape(),
+                            1L + i);
+    }
+    // Act
+    TopoShape result {0L};
+    result.makeElementTreeBoolean(Part::OpCodes::Fuse, shapes);
+    // Assert
+    EXPECT_EQ(result.countSubShapes(TopAbs_SOLID), 1);
+    EXPECT_FLOAT_EQ(getVolume(result.getShape()), 20.5);
+    EXPECT_GT(result.getElementMapSize(), 0);
+}
+
+TEST_F(TopoShapeExpansionTest, makeElementTreeBooleanCut)
+{
+    // Arrange
+    std::vector<TopoShape> shapes {
+        TopoShape {BRepPrimAPI_MakeBox(30.0, 1.0, 1.0).Shape(), 1L}};
+    for (int i = 0; i < 12; i++) {
+        shapes.emplace_back(
+            BRepPrimAPI_MakeBox(gp_Pnt(1.0 + 2.0 * i, 0.0, 0.5), 1.0, 1.0, 1.0).Shape(),
+            2L + i);
+    }
+    // Act
+    TopoShape tree {0L};
+    tree.makeElementTreeBoolean(Part::OpCodes::Cut, shapes);
+    TopoShape general {0L};
+    general.makeElementBoolean(Part::OpCodes::Cut, shapes);
+    // Assert
+    EXPECT_EQ(tree.countSubShapes(TopAbs_SOLID), 1);
+    EXPECT_FLOAT_EQ(getVolume(tree.getShape()), 24.0);
+    EXPECT_FLOAT_EQ(getVolume(tree.getShape()), getVolume(general.getShape()));
+}
+
+TEST_F(TopoShapeExpansionTest, makeElementDisjointBooleanMatchesBoolean)
+{
+    // Arrange
+    TopoShape plate {BRepPrimAPI_MakeBox(10.0, 1.0, 1.0).Shape(), 1L};
+    std::vector<TopoShape> shapes {plate};
+    for (int i = 0; i < 3; i++) {
+        TopoShape tool {BRepPrimAPI_MakeBox(gp_Pnt(1.0 + 3.0 * i, 0.0, 0.5), 1.0, 1.0, 1.0).Shape(),
+                        2L + i};
+        shapes.push_back(tool);
+    }
+    // Act
+    TopoShape general {0L};
+    general.makeElementBoolean(Part::OpCodes::Cut, shapes);
+    TopoShape disjoint {0L};
+    disjoint.makeElementDisjointBoolean(Part::OpCodes::Cut, shapes);
+    // Assert
+    EXPECT_FLOAT_EQ(getVolume(disjoint.getShape()), 8.5);
+    EXPECT_FLOAT_EQ(getVolume(disjoint.getShape()), getVolume(general.getShape()));
+    auto mappedNames = [](const TopoShape& shape) {
+        std::set<std::string> names;
+        for (const auto& [indexed, mapped] : elementMap(shape)) {
+            names.insert(mapped.toString());
+        }
+        return names;
+    };
+    EXPECT_EQ(mappedNames(disjoint), mappedNames(general));
+}
+
 TEST_F(TopoShapeExpansionTest, makeElementChamfer)
 {
     // Arrange
@@ -3290,4 +3359,76 @@ TEST_F(TopoShapeExpansionTest, makeElementOffset2D)
                               }));
 }
 
+TEST_F(TopoShapeExpansionTest, makeShapeWithElementMapLazyAndParallelMatchEager)
+{
+    // Arrange
+    auto hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Part/General");
+    auto run = [&hGrp](bool lazy, bool parallel) {
+        hGrp->SetBool("LazyElementMap", lazy);
+        hGrp->SetBool("ParallelElementMap", parallel);
+        TopoShape result {BRepPrimAPI_MakeBox(1.0, 1.0, 1.0).Shape(), 1L};
+        for (int i = 1; i <= 3; i++) {
+            TopoShape tool {BRepPrimAPI_MakeBox(gp_Pnt(0.5 * i, 0.0, 0.0), 1.0, 1.0, 1.0 + 0.1 * i)
+                                .Shape(),
+                            2L * i};
+            TopoShape feature {2L * i + 1};
+            feature.makeElementBoolean(Part::OpCodes::Fuse, {result, tool});
+            result = feature;
+        }
+        auto elements = result.getElementMap();
+        hGrp->RemoveBool("LazyElementMap");
+        hGrp->RemoveBool("ParallelElementMap");
+        return elements;
+    };
+
+    // Act
+    auto eager = run(false, false);
+    auto lazy = run(true, false);
+    auto parallel = run(false, true);
+    auto lazyParallel = run(true, true);
+
+    // Assert
+    EXPECT_FALSE(eager.empty());
+    EXPECT_EQ(lazy, eager);
+    EXPECT_EQ(parallel, eager);
+    EXPECT_EQ(lazyParallel, eager);
+}
+
+// Run with --gtest_also_run_disabled_tests to compare a long chain of features, like a
+// PartDesign body, with and without element mapping
+TEST_F(TopoShapeExpansionTest, DISABLED_BenchmarkElementMapChain)
+{
+    const int count = 200;
+    auto run = [](bool mapped) {
+        App::StringHasherRef hasher;
+        if (mapped) {
+            hasher = App::StringHasherRef(new App::StringHasher);
+        }
+        auto tag = [mapped](long value) {
+            return mapped ? value : 0L;
+        };
+
+        auto start = std::chrono::steady_clock::now();
+        TopoShape result {BRepPrimAPI_MakeBox(1.0, 1.0, 1.0).Shape(), tag(1), hasher};
+        for (int i = 1; i <= count; i++) {
+            TopoShape tool {BRepPrimAPI_MakeBox(gp_Pnt(0.5 * i, 0.0, 0.0), 1.0, 1.0, 1.0 + 0.01 * i)
+                                .Shape(),
+                            tag(2L * i),
+                            hasher};
+            TopoShape feature {tag(2L * i + 1), hasher};
+            feature.makeElementBoolean(Part::OpCodes::Fuse, {result, tool});
+            result = feature;
+        }
+        auto end = std::chrono::steady_clock::now();
+        EXPECT_EQ(result.countSubShapes(TopAbs_SOLID), 1);
+        return std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+    };
+
+    auto unmapped = run(false);
+    auto mapped = run(true);
+    std::cout << count << " features without element map: " << unmapped << " ms, with element map: "
+              << mapped << " ms" << std::endl;
+}
+
 // NOLINTEND(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
@@ -0,0 +1,199 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <future>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <src/App/InitApplication.h>
+#include <App/Document.h>
+#include <Base/Interpreter.h>
+#include <Mod/TechDraw/App/DrawViewPart.h>
+#include <Mod/TechDraw/App/Geometry.h>
+#include <Mod/TechDraw/App/ProjectionScheduler.h>
+
+using Stage = TechDraw::ProjectionScheduler::Stage;
+
+class ProjectionSchedulerTest: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+        Base::Interpreter().runString("import TechDraw");
+    }
+
+    void SetUp() override
+    {
+        _docName = App::GetApplication().getUniqueDocumentName("test");
+        _doc = App::GetApplication().newDocument(_docName.c_str(), "testUser");
+        _box = _doc->addObject("Part::Box", "Box");
+    }
+
+    void TearDown() override
+    {
+        TechDraw::ProjectionScheduler::instance().waitForDone();
+        TechDraw::ProjectionScheduler::instance().setMaxThreadCount(0);
+        App::GetApplication().closeDocument(_docName.c_str());
+    }
+
+    TechDraw::DrawViewPart* addView(const Base::Vector3d& direction)
+    {
+        auto view = static_cast<TechDraw::DrawViewPart*>(
+            _doc->addObject("TechDraw::DrawViewPart", "View"));
+        // the view is not on a page, which would decide if it is updated
+        view->overrideKeepUpdated(true);
+        view->Source.setValues({_box});
+        view->Direction.setValue(direction);
+        return view;
+    }
+
+    static int countVisibleEdges(const TechDraw::DrawViewPart* view)
+    {
+        int count = 0;
+        for (const auto& geom : view->getEdgeGeometry()) {
+            if (geom->getHlrVisible()) {
+                ++count;
+            }
+        }
+        return count;
+    }
+
+    App::Document* _doc {};
+    App::DocumentObject* _box {};
+
+private:
+    std::string _docName;
+};
+
+TEST_F(ProjectionSchedulerTest, continuationsRunInCallingThread)
+{
+    // Arrange
+    auto& scheduler = TechDraw::ProjectionScheduler::instance();
+    auto view = addView(Base::Vector3d(0, 0, 1));
+    std::atomic<int> tasks {0};
+    std::vector<std::thread::id> continuations;
+
+    // Act
+    for (int i = 0; i < 8; ++i) {
+        scheduler.schedule(
+            view,
+            Stage::Hlr,
+            [&tasks] {
+                ++tasks;
+            },
+            [&continuations] {
+                continuations.push_back(std::this_thread::get_id());
+            });
+    }
+    scheduler.waitForDone();
+
+    // Assert
+    EXPECT_EQ(tasks, 8);
+    ASSERT_EQ(continuations.size(), 8);
+    for (const auto& id : continuations) {
+        EXPECT_EQ(id, std::this_thread::get_id());
+    }
+}
+
+TEST_F(ProjectionSchedulerTest, waitForTasksOfContinuations)
+{
+    // Arrange
+    auto& scheduler = TechDraw::ProjectionScheduler::instance();
+    auto view = addView(Base::Vector3d(0, 0, 1));
+    bool faces = false;
+
+    // Act: like a view, the continuation of the HLR step schedules the face finding
+    scheduler.schedule(
+        view,
+        Stage::Hlr,
+        [] {},
+        [&] {
+            scheduler.schedule(
+                view,
+                Stage::FaceFinding,
+                [] {},
+                [&faces] {
+                    faces = true;
+                });
+        });
+    scheduler.waitForDone();
+
+    // Assert
+    EXPECT_TRUE(faces);
+}
+
+TEST_F(ProjectionSchedulerTest, laterStagesAndVisibleViewsFirst)
+{
+    // Arrange: a single thread that is busy until all other tasks are queued
+    auto& scheduler = TechDraw::ProjectionScheduler::instance();
+    scheduler.setMaxThreadCount(1);
+    auto shown = addView(Base::Vector3d(0, 0, 1));
+    auto hidden = addView(Base::Vector3d(0, 0, 1));
+    hidden->Visibility.setValue(false);
+
+    std::promise<void> started;
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    scheduler.schedule(
+        shown,
+        Stage::ShapePreparation,
+        [&started, released] {
+            started.set_value();
+            released.wait();
+        },
+        [] {});
+    started.get_future().wait();
+
+    std::mutex mutex;
+    std::vector<std::string> order;
+    auto add = [&](TechDraw::DrawViewPart* view, Stage stage, const char* name) {
+        scheduler.schedule(
+            view,
+            stage,
+            [&mutex, &order, name] {
+                std::lock_guard<std::mutex> lock(mutex);
+                order.emplace_back(name);
+            },
+            [] {});
+    };
+
+    // Act
+    add(hidden, Stage::ShapePreparation, "hidden cut");
+    add(hidden, Stage::FaceFinding, "hidden faces");
+    add(shown, Stage::ShapePreparation, "shown cut");
+    add(shown, Stage::Hlr, "shown hlr");
+    add(shown, Stage::FaceFinding, "shown faces");
+    release.set_value();
+    scheduler.waitForDone();
+
+    // Assert
+    std::vector<std::string> expected {"shown faces",
+                                       "shown hlr",
+                                       "shown cut",
+                                       "hidden faces",
+                                       "hidden cut"};
+    EXPECT_EQ(order, expected);
+}
+
+TEST_F(ProjectionSchedulerTest, recomputeFinishesViews)
+{
+    // Arrange
+    std::vector<TechDraw::DrawViewPart*> views {addView(Base::Vector3d(0, 0, 1)),
+                                                addView(Base::Vector3d(0, -1, 0)),
+                                                addView(Base::Vector3d(1, 0, 0))};
+
+    // Act: without an event loop the recompute waits for the projections
+    _doc->recompute();
+
+    // Assert
+    for (auto view : views) {
+        EXPECT_FALSE(view->waitingForHlr()) << view->getNameInDocument();
+        EXPECT_FALSE(view->waitingForFaces()) << view->getNameInDocument();
+        EXPECT_EQ(countVisibleEdges(view), 4) << view->getNameInDocument();
+    }
+}